@@ -0,0 +1,97 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: BenchmarkChip.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-26
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace iqrf::gpio {
+
+/**
+ * Finds the GPIO chip created by the gpio-sim kernel module
+ * @return GPIO chip name or std::nullopt if there is no simulated chip
+ */
+inline std::optional<std::string> findSimulatedChip() {
+    namespace fs = std::filesystem;
+    std::error_code error;
+    std::vector<std::string> chips;
+    for (const auto &entry : fs::directory_iterator("/sys/bus/gpio/devices", error)) {
+        // The device links to /sys/devices/platform/gpio-sim.N/gpiochipM
+        const fs::path target = fs::canonical(entry.path(), error);
+        if (!error && target.string().find("/gpio-sim.") != std::string::npos) {
+            chips.push_back(entry.path().filename().string());
+        }
+    }
+    if (chips.empty()) {
+        return std::nullopt;
+    }
+    return *std::min_element(chips.begin(), chips.end());
+}
+
+/**
+ * Returns the GPIO chip used by the benchmarks
+ *
+ * The chip is set by the IQRF_BENCHMARK_GPIOCHIP environment variable, the first gpio-sim chip is
+ * used if the variable is not set.
+ * @return GPIO chip name or std::nullopt if there is no chip
+ */
+inline std::optional<std::string> benchmarkChip() {
+    const char *chip = std::getenv("IQRF_BENCHMARK_GPIOCHIP");
+    if (chip == nullptr || *chip == '\0') {
+        static const std::optional<std::string> simulated = findSimulatedChip();
+        return simulated;
+    }
+    return std::string(chip);
+}
+
+/**
+ * Returns the GPIO chip used by the benchmarks, skips the benchmark if there is none
+ * @param state Benchmark state
+ * @return GPIO chip name or std::nullopt if the benchmark is skipped
+ */
+inline std::optional<std::string> benchmarkChip(benchmark::State &state) {
+    auto chip = benchmarkChip();
+    if (!chip) {
+        state.SkipWithError("No GPIO chip, set IQRF_BENCHMARK_GPIOCHIP or load the gpio-sim module");
+    }
+    return chip;
+}
+
+/**
+ * Reports the percentiles of the measured latencies as benchmark counters
+ * @param state Benchmark state
+ * @param samples Latencies of the single calls
+ */
+inline void reportLatency(benchmark::State &state, std::vector<std::chrono::nanoseconds> &samples) {
+    if (samples.empty()) {
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    const auto percentile = [&samples](const double fraction) {
+        const auto index = static_cast<std::size_t>(fraction * static_cast<double>(samples.size() - 1));
+        return static_cast<double>(samples[index].count());
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["max_ns"] = static_cast<double>(samples.back().count());
+}
+
+}  // namespace iqrf::gpio
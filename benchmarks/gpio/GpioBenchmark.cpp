@@ -0,0 +1,183 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioBenchmark.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-23
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <exception>
+#include <vector>
+
+#include "BenchmarkChip.h"
+#include "iqrf/gpio/BasicGpio.h"
+#include "iqrf/gpio/Gpio.h"
+
+namespace iqrf::gpio {
+
+/**
+ * Toggles the output line
+ * @tparam Line GPIO pin type
+ * @param state Benchmark state
+ * @param config GPIO pin configuration
+ */
+template<typename Line>
+static void toggle(benchmark::State &state, const GpioConfig &config) {
+    try {
+        const Line line(config);
+        line.initOutput(false);
+        bool value = false;
+        for (auto _ : state) {
+            value = !value;
+            line.setValue(value);
+        }
+    } catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Reads the output line
+ * @tparam Line GPIO pin type
+ * @param state Benchmark state
+ * @param config GPIO pin configuration
+ */
+template<typename Line>
+static void read(benchmark::State &state, const GpioConfig &config) {
+    try {
+        const Line line(config);
+        line.initOutput(true);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(line.getValue());
+        }
+    } catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Toggles the output line and measures the latency of each write
+ * @tparam Line GPIO pin type
+ * @param state Benchmark state
+ * @param config GPIO pin configuration
+ */
+template<typename Line>
+static void latency(benchmark::State &state, const GpioConfig &config) {
+    std::vector<std::chrono::nanoseconds> samples;
+    try {
+        const Line line(config);
+        line.initOutput(false);
+        bool value = false;
+        for (auto _ : state) {
+            value = !value;
+            const auto start = std::chrono::steady_clock::now();
+            line.setValue(value);
+            samples.push_back(std::chrono::steady_clock::now() - start);
+        }
+    } catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    reportLatency(state, samples);
+}
+
+/**
+ * Toggles the line of the GPIO chip
+ * @tparam Line GPIO pin type
+ */
+template<typename Line>
+static void chipToggle(benchmark::State &state) {
+    if (const auto chip = benchmarkChip(state)) {
+        toggle<Line>(state, GpioConfig(*chip, 0, "libiqrf-benchmark"));
+    }
+}
+BENCHMARK_TEMPLATE(chipToggle, Gpio);
+#if defined(__linux__) || defined(__FreeBSD__)
+BENCHMARK_TEMPLATE(chipToggle, NativeGpio);
+#endif
+
+/**
+ * Reads the line of the GPIO chip
+ * @tparam Line GPIO pin type
+ */
+template<typename Line>
+static void chipRead(benchmark::State &state) {
+    if (const auto chip = benchmarkChip(state)) {
+        read<Line>(state, GpioConfig(*chip, 0, "libiqrf-benchmark"));
+    }
+}
+BENCHMARK_TEMPLATE(chipRead, Gpio);
+#if defined(__linux__) || defined(__FreeBSD__)
+BENCHMARK_TEMPLATE(chipRead, NativeGpio);
+#endif
+
+/**
+ * Measures the write latency distribution of the line of the GPIO chip
+ * @tparam Line GPIO pin type
+ */
+template<typename Line>
+static void chipLatency(benchmark::State &state) {
+    if (const auto chip = benchmarkChip(state)) {
+        latency<Line>(state, GpioConfig(*chip, 0, "libiqrf-benchmark"));
+    }
+}
+BENCHMARK_TEMPLATE(chipLatency, Gpio);
+#if defined(__linux__) || defined(__FreeBSD__)
+BENCHMARK_TEMPLATE(chipLatency, NativeGpio);
+#endif
+
+#if IQRF_TESTING_SUPPORT
+/**
+ * Returns the configuration of the mock line
+ * @return GPIO pin configuration
+ */
+static GpioConfig mockConfig() {
+    GpioConfig config("gpiochip0", 0, "libiqrf-benchmark");
+    config.use_mock = true;
+    return config;
+}
+
+/**
+ * Toggles the mock line, measures the dispatch overhead without the syscalls
+ * @tparam Line GPIO pin type
+ */
+template<typename Line>
+static void mockToggle(benchmark::State &state) {
+    toggle<Line>(state, mockConfig());
+}
+BENCHMARK_TEMPLATE(mockToggle, Gpio);
+BENCHMARK_TEMPLATE(mockToggle, BasicGpio<GpioMock>);
+
+/**
+ * Reads the mock line
+ * @tparam Line GPIO pin type
+ */
+template<typename Line>
+static void mockRead(benchmark::State &state) {
+    read<Line>(state, mockConfig());
+}
+BENCHMARK_TEMPLATE(mockRead, Gpio);
+BENCHMARK_TEMPLATE(mockRead, BasicGpio<GpioMock>);
+
+/**
+ * Measures the write latency distribution of the mock line
+ * @tparam Line GPIO pin type
+ */
+template<typename Line>
+static void mockLatency(benchmark::State &state) {
+    latency<Line>(state, mockConfig());
+}
+BENCHMARK_TEMPLATE(mockLatency, Gpio);
+#endif
+
+}  // namespace iqrf::gpio
@@ -0,0 +1,95 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioGroupBenchmark.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-20
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "BenchmarkChip.h"
+#include "iqrf/gpio/Gpio.h"
+#include "iqrf/gpio/GpioGroup.h"
+
+namespace iqrf::gpio {
+
+/// Number of switched lines, as many as the bus enables of the bus switcher
+constexpr std::size_t LINE_COUNT = 3;
+
+/**
+ * Creates the benchmarked GPIO lines
+ * @param chip GPIO chip name
+ * @return GPIO lines 0 to LINE_COUNT - 1
+ */
+static std::vector<Gpio> createLines(const std::string &chip) {
+    std::vector<Gpio> lines;
+    for (std::size_t i = 0; i < LINE_COUNT; ++i) {
+        lines.emplace_back(GpioConfig(chip, i, "libiqrf-benchmark"));
+    }
+    return lines;
+}
+
+/**
+ * Switches the enable from one line to the next one, line by line
+ */
+static void perLineToggle(benchmark::State &state) {
+    const auto chip = benchmarkChip(state);
+    if (!chip) {
+        return;
+    }
+    try {
+        const std::vector<Gpio> lines = createLines(*chip);
+        for (const auto &line : lines) {
+            line.initOutput(false);
+        }
+        std::size_t active = 0;
+        for (auto _ : state) {
+            active = (active + 1) % LINE_COUNT;
+            for (std::size_t i = 0; i < LINE_COUNT; ++i) {
+                lines[i].setValue(i == active);
+            }
+        }
+    } catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(perLineToggle);
+
+/**
+ * Switches the enable from one line to the next one, all lines at once
+ */
+static void groupToggle(benchmark::State &state) {
+    const auto chip = benchmarkChip(state);
+    if (!chip) {
+        return;
+    }
+    try {
+        GpioGroup group(createLines(*chip));
+        group.initOutput(0);
+        std::size_t active = 0;
+        for (auto _ : state) {
+            active = (active + 1) % LINE_COUNT;
+            group.setValues(uint64_t{1} << active);
+        }
+        state.counters["atomic"] = group.isAtomic();
+    } catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(groupToggle);
+
+}  // namespace iqrf::gpio
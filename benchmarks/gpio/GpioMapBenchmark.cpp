@@ -0,0 +1,106 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioMapBenchmark.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-26
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "iqrf/gpio/GpioMap.h"
+
+namespace iqrf::gpio {
+
+/// Number of lines of each benchmarked chip
+constexpr std::size_t CHIP_LINES = 32;
+
+/**
+ * Creates the chip table of the benchmarked map
+ * @param count Number of chips
+ * @return Chip names and line counts
+ */
+static std::vector<std::pair<std::string, std::size_t>> createChips(const std::size_t count) {
+    std::vector<std::pair<std::string, std::size_t>> chips;
+    chips.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        chips.emplace_back("gpiochip" + std::to_string(i), CHIP_LINES);
+    }
+    return chips;
+}
+
+/**
+ * Names the lines of the benchmarked chips
+ * @param chip GPIO chip name
+ * @return Line names
+ */
+static std::vector<std::string> nameLines(const std::string &chip) {
+    std::vector<std::string> names;
+    names.reserve(CHIP_LINES);
+    for (std::size_t i = 0; i < CHIP_LINES; ++i) {
+        names.push_back(chip + "-line" + std::to_string(i));
+    }
+    return names;
+}
+
+/**
+ * Resolves the pins of a loaded map, spread over all chips
+ */
+static void mapFindPin(benchmark::State &state) {
+    const auto chipCount = static_cast<std::size_t>(state.range(0));
+    const GpioMap map(createChips(chipCount));
+    const std::size_t pinCount = chipCount * CHIP_LINES;
+    benchmark::DoNotOptimize(map.getChips());
+    std::size_t pin = 0;
+    for (auto _ : state) {
+        pin = (pin + 7919) % pinCount;
+        benchmark::DoNotOptimize(map.findPin(pin));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(mapFindPin)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ * Resolves the last pin of a map which has not been loaded yet, loads all chips
+ */
+static void mapFindPinCold(benchmark::State &state) {
+    const auto chipCount = static_cast<std::size_t>(state.range(0));
+    const GpioMap prototype(createChips(chipCount));
+    const std::size_t lastPin = chipCount * CHIP_LINES - 1;
+    for (auto _ : state) {
+        state.PauseTiming();
+        const GpioMap map(prototype);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(map.findPin(lastPin));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(mapFindPinCold)->RangeMultiplier(4)->Range(1, 256);
+
+/**
+ * Resolves the line names of the last chip of a loaded map
+ */
+static void mapFindLine(benchmark::State &state) {
+    const auto chipCount = static_cast<std::size_t>(state.range(0));
+    const GpioMap map(createChips(chipCount), nameLines);
+    const std::string chip = "gpiochip" + std::to_string(chipCount - 1);
+    const std::vector<std::string> names = nameLines(chip);
+    benchmark::DoNotOptimize(map.findLine(chip, names.front()));
+    std::size_t line = 0;
+    for (auto _ : state) {
+        line = (line + 1) % CHIP_LINES;
+        benchmark::DoNotOptimize(map.findLine(chip, names[line]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(mapFindLine)->RangeMultiplier(4)->Range(1, 256);
+
+}  // namespace iqrf::gpio
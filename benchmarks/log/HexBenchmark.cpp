@@ -0,0 +1,135 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: HexBenchmark.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-29
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "iqrf/log/Hex.h"
+
+namespace iqrf::log {
+
+/**
+ * Creates the benchmarked bytes
+ * @param size Number of bytes
+ * @return Bytes
+ */
+static std::vector<uint8_t> createBytes(const std::size_t size) {
+    std::vector<uint8_t> bytes(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+    return bytes;
+}
+
+/**
+ * Formats the bytes as ConnectorUtils::vectorToHexString did before the lookup table encoder
+ * @param input Bytes
+ * @return Hex dump
+ */
+static std::string streamHex(const std::vector<uint8_t> &input) {
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        ss << std::setw(2) << static_cast<int>(input[i]);
+        if (i + 1 < input.size()) {
+            ss << ".";
+        }
+    }
+    return ss.str();
+}
+
+/**
+ * Formats the bytes by a string stream with stream manipulators
+ */
+static void hexStringStream(benchmark::State &state) {
+    const std::vector<uint8_t> bytes = createBytes(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(streamHex(bytes));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(hexStringStream)->RangeMultiplier(8)->Range(8, 4096);
+
+/**
+ * Encodes the bytes into a caller buffer by the lookup table
+ */
+static void hexScalar(benchmark::State &state) {
+    const std::vector<uint8_t> bytes = createBytes(static_cast<std::size_t>(state.range(0)));
+    std::string buffer(hexLength(bytes.size()), '\0');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(toHexScalar(bytes.data(), bytes.size(), buffer.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(hexScalar)->RangeMultiplier(8)->Range(8, 4096);
+
+/**
+ * Encodes the bytes into a caller buffer, by SIMD instructions if supported
+ */
+static void hexBuffer(benchmark::State &state) {
+    const std::vector<uint8_t> bytes = createBytes(static_cast<std::size_t>(state.range(0)));
+    std::string buffer(hexLength(bytes.size()), '\0');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(toHex(bytes.data(), bytes.size(), buffer.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(hexBuffer)->RangeMultiplier(8)->Range(8, 4096);
+
+/**
+ * Formats the bytes into a new string
+ */
+static void hexString(benchmark::State &state) {
+    const std::vector<uint8_t> bytes = createBytes(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(toHex(bytes));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(hexString)->RangeMultiplier(8)->Range(8, 4096);
+
+/**
+ * Writes the bytes to a reused stream by the lazy hex view
+ */
+static void hexViewStream(benchmark::State &state) {
+    const std::vector<uint8_t> bytes = createBytes(static_cast<std::size_t>(state.range(0)));
+    std::ostringstream stream;
+    for (auto _ : state) {
+        stream.seekp(0);
+        stream << HexView(bytes);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(hexViewStream)->RangeMultiplier(8)->Range(8, 4096);
+
+/**
+ * Parses the hex dump
+ */
+static void hexParse(benchmark::State &state) {
+    const std::vector<uint8_t> bytes = createBytes(static_cast<std::size_t>(state.range(0)));
+    const std::string text = toHex(bytes);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hexToBytes(text));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+BENCHMARK(hexParse)->RangeMultiplier(8)->Range(8, 4096);
+
+}  // namespace iqrf::log
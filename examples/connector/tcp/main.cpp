@@ -25,11 +25,12 @@
 #include <boost/program_options.hpp>
 
 #include "iqrf/connector/tcp/TcpConnector.h"
-#include "iqrf/connector/ConnectorUtils.h"
+#include "iqrf/connector/dpa/DpaBuilder.h"
+#include "iqrf/log/Hex.h"
 #include "iqrf/log/Logging.h"
 
 namespace bpo = boost::program_options;
-using iqrf::connector::ConnectorUtils;
+using iqrf::log::HexView;
 
 /// IQRF TCP connector instance
 std::unique_ptr<iqrf::connector::tcp::TcpConnector> tcpConnector = nullptr;
@@ -54,7 +55,7 @@ int responseHandler(const std::vector<uint8_t> &response) {
         IQRF_LOG(iqrf::log::Level::Error) << "Empty response received.";
         return -1;
     }
-    IQRF_LOG(iqrf::log::Level::Info) << "Response: " << ConnectorUtils::vectorToHexString(response);
+    IQRF_LOG(iqrf::log::Level::Info) << "Response: " << HexView(response);
     return 0;
 }
 
@@ -71,7 +72,8 @@ int main(int argc, char *argv[]) {
     bpo::options_description command("Command options");
     command.add_options()
         ("host,H", bpo::value<std::string>()->default_value("localhost"), "TCP host address (hostname or IP address, default: localhost)")
-        ("port,p", bpo::value<uint16_t>()->default_value(10000), "TCP port number (default: 10000)");
+        ("port,p", bpo::value<uint16_t>()->default_value(10000), "TCP port number (default: 10000)")
+        ("request,r", bpo::value<std::string>(), "DPA request sent instead of toggling the LED, e.g. 00.00.06.81.ff.ff");
     bpo::options_description desc("Available options");
     desc.add(general).add(command);
     bpo::variables_map vm;
@@ -95,6 +97,11 @@ int main(int argc, char *argv[]) {
             throw std::logic_error("TCP host name is required.");
         }
 
+        std::vector<uint8_t> customRequest;
+        if (vm.count("request")) {
+            customRequest = iqrf::log::hexToBytes(vm["request"].as<std::string>());
+        }
+
         /// IQRF TCP connector configuration
         const iqrf::connector::tcp::TcpConfig tcpConfig(
             vm["host"].as<std::string>(),
@@ -111,9 +118,14 @@ int main(int argc, char *argv[]) {
                 std::this_thread::sleep_for(std::chrono::seconds(1));
                 continue;
             }
-            std::vector<uint8_t> request = {0x00, 0x00, 0x06, static_cast<uint8_t>(ledState), 0xff, 0xff};
+            std::vector<uint8_t> request = customRequest;
+            if (request.empty()) {
+                request = ledState
+                    ? iqrf::connector::dpa::LedrSetOn::toVector(iqrf::connector::dpa::COORDINATOR_ADDRESS)
+                    : iqrf::connector::dpa::LedrSetOff::toVector(iqrf::connector::dpa::COORDINATOR_ADDRESS);
+            }
             ledState = !ledState;
-            IQRF_LOG(iqrf::log::Level::Info) << "Sending: " << ConnectorUtils::vectorToHexString(request);
+            IQRF_LOG(iqrf::log::Level::Info) << "Sending: " << HexView(request);
             try {
                 tcpConnector->send(request);
             } catch (const std::exception &e) {
@@ -24,11 +24,11 @@
 #include <boost/program_options.hpp>
 
 #include "iqrf/connector/uart/UartConnector.h"
-#include "iqrf/connector/ConnectorUtils.h"
+#include "iqrf/log/Hex.h"
 #include "iqrf/log/Logging.h"
 
 namespace bpo = boost::program_options;
-using iqrf::connector::ConnectorUtils;
+using iqrf::log::HexView;
 
 /// IQRF UART connector instance
 std::unique_ptr<iqrf::connector::uart::UartConnector> uartConnector = nullptr;
@@ -52,7 +52,7 @@ int responseHandler(const std::vector<uint8_t> &response) {
         IQRF_LOG(iqrf::log::Level::Error) << "Empty response received.";
         return -1;
     }
-    IQRF_LOG(iqrf::log::Level::Info) << "Response: " << ConnectorUtils::vectorToHexString(response);
+    IQRF_LOG(iqrf::log::Level::Info) << "Response: " << HexView(response);
     return 0;
 }
 
@@ -69,7 +69,8 @@ int main(int argc, char *argv[]) {
     bpo::options_description command("Command options");
     command.add_options()
         ("device,d", bpo::value<std::string>(), "UART device name")
-        ("baudrate,b", bpo::value<uint32_t>()->default_value(57600), "UART baud rate (default: 57600)");
+        ("baudrate,b", bpo::value<uint32_t>()->default_value(57600), "UART baud rate (default: 57600)")
+        ("request,r", bpo::value<std::string>(), "DPA request sent instead of toggling the LED, e.g. 00.00.06.81.ff.ff");
     bpo::options_description desc("Available options");
     desc.add(general).add(command);
     bpo::variables_map vm;
@@ -93,6 +94,11 @@ int main(int argc, char *argv[]) {
             throw std::logic_error("UART device name is required.");
         }
 
+        std::vector<uint8_t> customRequest;
+        if (vm.count("request")) {
+            customRequest = iqrf::log::hexToBytes(vm["request"].as<std::string>());
+        }
+
         /// IQRF UART connector configuration
         const iqrf::connector::uart::UartConfig uartConfig(
             vm["device"].as<std::string>(),
@@ -104,9 +110,12 @@ int main(int argc, char *argv[]) {
 
         bool ledState = true;
         while (true) {
-            std::vector<uint8_t> request = {0x00, 0x00, 0x06, static_cast<uint8_t>(ledState), 0xff, 0xff};
+            std::vector<uint8_t> request = customRequest;
+            if (request.empty()) {
+                request = {0x00, 0x00, 0x06, static_cast<uint8_t>(ledState), 0xff, 0xff};
+            }
             ledState = !ledState;
-            IQRF_LOG(iqrf::log::Level::Info) << "Sending: " << ConnectorUtils::vectorToHexString(request);
+            IQRF_LOG(iqrf::log::Level::Info) << "Sending: " << HexView(request);
             uartConnector->send(request);
             std::this_thread::sleep_for(std::chrono::seconds(1));
         }
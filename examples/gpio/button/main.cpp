@@ -14,11 +14,12 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <csignal>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
-#include <thread>
 
 #include <boost/program_options.hpp>
 
@@ -52,7 +53,8 @@ int main(int argc, char *argv[]) {
     command.add_options()
         ("chip,c", bpo::value<std::string>(), "GPIO chip name for the button")
         ("pin,p", bpo::value<std::size_t>()->default_value(2), "GPIO line for the button")
-        ("inverted,i", bpo::bool_switch()->default_value(false), "Invert button state (pressed = 1, released = 0)");
+        ("inverted,i", bpo::bool_switch()->default_value(false), "Invert button state (pressed = 1, released = 0)")
+        ("debounce,d", bpo::value<unsigned int>()->default_value(10), "Debounce period in milliseconds");
     bpo::options_description desc("Available options");
     desc.add(general).add(command);
     bpo::variables_map vm;
@@ -78,32 +80,36 @@ int main(int argc, char *argv[]) {
             buttonConfig = std::make_unique<iqrf::gpio::GpioConfig>(buttonPin);
         }
         button = std::make_unique<iqrf::gpio::Gpio>(*buttonConfig);
-        button->initInput();
+        iqrf::gpio::GpioEventConfig eventConfig;
+        eventConfig.debounce = std::chrono::milliseconds(vm["debounce"].as<unsigned int>());
+        button->initEdgeInput(eventConfig);
         signal(SIGINT, signalHandler);
         signal(SIGTERM, signalHandler);
 
-        uint64_t counter = 0;
         bool inverted = vm["inverted"].as<bool>();
+        // Released button pulls the line up unless inverted
+        const auto pressEdge = inverted ? iqrf::gpio::GpioEdge::Rising : iqrf::gpio::GpioEdge::Falling;
+        std::optional<std::chrono::nanoseconds> pressedAt;
 
         while (true) {
-            if (
-                (button->getValue() && !inverted) ||
-                (!button->getValue() && inverted)
-            ) {
-                if (counter > 0) {
-                    std::cout << "Button has been released. Button was pressed for "
-                              << std::to_string(static_cast<double>(counter) / 100.0)
-                              << " s."
-                              << std::endl;
-                }
-                counter = 0;
-            } else {
-                if (counter == 0) {
+            // Sleeps in the kernel until the button state changes
+            const auto event = button->waitEvent();
+            if (!event) {
+                continue;
+            }
+            if (event->edge == pressEdge) {
+                if (!pressedAt) {
                     std::cout << "Button has been pressed." << std::endl;
+                    pressedAt = event->timestamp;
                 }
-                counter++;
+            } else if (pressedAt) {
+                const std::chrono::duration<double> pressed = event->timestamp - *pressedAt;
+                std::cout << "Button has been released. Button was pressed for "
+                          << std::to_string(pressed.count())
+                          << " s."
+                          << std::endl;
+                pressedAt.reset();
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
         return EXIT_SUCCESS;
     } catch (const std::exception &e) {
@@ -0,0 +1,50 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: main.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-28
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+
+#include "iqrf/log/BinaryLog.h"
+
+/**
+ * Decodes the binary log written by iqrf::log::BinaryLog to the standard output.
+ *
+ * Usage: iqrf-log-binary-decoder [--no-timestamps] <file>
+ */
+int main(int argc, char *argv[]) {
+    bool timestamps = true;
+    const char *path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--no-timestamps") == 0) {
+            timestamps = false;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (path == nullptr) {
+        std::cerr << "Usage: " << argv[0] << " [--no-timestamps] <file>" << std::endl;
+        return 2;
+    }
+    std::ifstream input(path, std::ios::binary);
+    if (!input) {
+        std::cerr << "Cannot open " << path << std::endl;
+        return 1;
+    }
+    try {
+        iqrf::log::BinaryLogDecoder::decode(input, std::cout, timestamps);
+    } catch (const std::exception &e) {
+        std::cerr << path << ": " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
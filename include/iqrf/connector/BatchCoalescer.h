@@ -0,0 +1,403 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: BatchCoalescer.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-11
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "iqrf/connector/OutboundScheduler.h"
+#include "iqrf/connector/dpa/DpaBuilder.h"
+#include "iqrf/connector/dpa/DpaFrame.h"
+
+namespace iqrf::connector {
+
+/// Predicate deciding whether a DPA request can be packed into a batch
+typedef std::function<bool(const std::vector<uint8_t> &)> CoalescingFilter;
+
+/**
+ * Request coalescing configuration.
+ */
+struct CoalescingConfig {
+    /// Time the first request of a batch waits for further requests to the same node
+    std::chrono::microseconds window = std::chrono::milliseconds(5);
+    /// Maximal size of the batch PDATA including the terminating zero byte
+    std::size_t maxBatchData = 56;
+    /// Requests allowed in a batch, BatchCoalescer::hasNoResponseData() if empty
+    CoalescingFilter filter;
+};
+
+/**
+ * Request coalescing statistics.
+ */
+struct CoalescingStats {
+    /// Number of requests packed into batches
+    uint64_t coalescedRequests = 0;
+    /// Number of batch requests sent
+    uint64_t batches = 0;
+    /// Number of requests held for a window and sent alone
+    uint64_t singleRequests = 0;
+    /// Number of requests passed through without coalescing
+    uint64_t bypassedRequests = 0;
+    /// Number of responses and confirmations split from batch responses
+    uint64_t splitResponses = 0;
+    /// Largest number of requests in a batch
+    std::size_t maxBatchRequests = 0;
+    /// Number of requests currently waiting in open batches
+    std::size_t pendingRequests = 0;
+};
+
+/**
+ * Coalescer of unicast DPA requests into DPA OS Batch requests.
+ *
+ * Requests to the same node sent within the coalescing window are packed into a single
+ * OS Batch request (PNUM 0x02, PCMD 0x05), saving an RF round trip per request. The batch
+ * confirmation and response are split back into a confirmation and a response of each
+ * original request.
+ *
+ * OS Batch response does not carry responses of the embedded requests, it only reports
+ * the result of the batch. Only requests whose response has no data are therefore packed,
+ * by default writes to LEDs, IO, RAM and EEPROM.
+ *
+ * A request which cannot be packed is sent after the open batch to the same node, see
+ * flushBefore(), so it never overtakes the requests sent before it. All requests of a batch
+ * share the send result of the sender which opened it.
+ *
+ * The coalescer itself is not thread-safe, the owner is responsible for locking.
+ */
+class BatchCoalescer {
+ public:
+    /**
+     * Result of adding a request to the coalescer.
+     */
+    enum class Admission {
+        /// Request cannot be coalesced and has to be sent as is
+        Bypass,
+        /// Request opened a new batch, the caller has to flush it after the window
+        Leader,
+        /// Request joined a batch opened by another request
+        Joined
+    };
+
+    /**
+     * Constructs the coalescer.
+     * @param config Coalescing configuration
+     * @throws std::invalid_argument if the batch cannot hold any request
+     */
+    explicit BatchCoalescer(const CoalescingConfig &config = CoalescingConfig()): config(config) {
+        if (config.maxBatchData <= dpa::REQUEST_HEADER_SIZE) {
+            throw std::invalid_argument("Batch data size is too small");
+        }
+        if (config.maxBatchData > dpa::MAX_PDATA_SIZE) {
+            throw std::invalid_argument("Batch data size exceeds the DPA data size");
+        }
+        if (!this->config.filter) {
+            this->config.filter = &BatchCoalescer::hasNoResponseData;
+        }
+    }
+
+    /**
+     * Adds the request to the batch for its node and queue.
+     * @param frame DPA request
+     * @param queue Outbound queue of the request
+     * @param sender Sender of the request
+     * @param result Result of the sender's call, shared by the batch opened by the request
+     * @return Admission of the request
+     */
+    Admission add(
+        const std::vector<uint8_t> &frame,
+        const OutboundQueue queue,
+        const SenderId sender,
+        std::shared_ptr<SendResult> result = nullptr
+    ) {
+        if (!this->canCoalesce(frame)) {
+            this->stats.bypassedRequests++;
+            return Admission::Bypass;
+        }
+        const Key key{dpa::DpaRequestView(frame).nadr(), queue};
+        auto [it, inserted] = this->pending.try_emplace(key);
+        Batch &batch = it->second;
+        const std::size_t size = BatchCoalescer::embeddedSize(frame);
+        if (!inserted && batch.dataSize + size + 1 > this->config.maxBatchData) {
+            // Batch is full, the request goes alone after it
+            this->stats.bypassedRequests++;
+            return Admission::Bypass;
+        }
+        if (inserted) {
+            batch.sender = sender;
+            batch.result = std::move(result);
+        }
+        batch.requests.push_back(frame);
+        batch.dataSize += size;
+        this->stats.pendingRequests++;
+        return inserted ? Admission::Leader : Admission::Joined;
+    }
+
+    /**
+     * Returns the send result shared by the open batch the request has joined.
+     * @param frame DPA request
+     * @param queue Outbound queue of the request
+     * @return Result of the sender which opened the batch, null if there is no open batch
+     */
+    [[nodiscard]] std::shared_ptr<SendResult> getResult(
+        const std::vector<uint8_t> &frame,
+        const OutboundQueue queue
+    ) const {
+        const auto request = dpa::DpaRequestView::tryParse(frame);
+        if (!request.has_value()) {
+            return nullptr;
+        }
+        auto it = this->pending.find(Key{request->nadr(), queue});
+        return it == this->pending.end() ? nullptr : it->second.result;
+    }
+
+    /**
+     * Closes the batch opened by the request.
+     * @param frame DPA request which opened the batch
+     * @param queue Outbound queue of the request
+     * @param result Result of the sender which opened the batch
+     * @return Frame to send or std::nullopt if the batch has already been flushed
+     */
+    std::optional<std::vector<uint8_t>> flush(
+        const std::vector<uint8_t> &frame,
+        const OutboundQueue queue,
+        const std::shared_ptr<SendResult> &result = nullptr
+    ) {
+        auto it = this->pending.find(Key{dpa::DpaRequestView(frame).nadr(), queue});
+        if (it == this->pending.end() || it->second.result != result) {
+            // Flushed before a bypassing request, a newer batch belongs to another sender
+            return std::nullopt;
+        }
+        Batch batch = std::move(it->second);
+        this->pending.erase(it);
+        return this->build(std::move(batch));
+    }
+
+    /**
+     * Closes the open batch to the node of the request which bypasses the coalescer.
+     *
+     * The batch has to be sent before the request, otherwise the request would overtake
+     * the requests sent to the node before it, e.g. an IO read would not see a batched IO write.
+     * @param frame Request bypassing the coalescer
+     * @param queue Outbound queue of the request
+     * @return Frame of the batch with its sender and result or std::nullopt if there is no open batch
+     */
+    std::optional<OutboundFrame> flushBefore(const std::vector<uint8_t> &frame, const OutboundQueue queue) {
+        const auto request = dpa::DpaRequestView::tryParse(frame);
+        if (!request.has_value()) {
+            return std::nullopt;
+        }
+        auto it = this->pending.find(Key{request->nadr(), queue});
+        if (it == this->pending.end()) {
+            return std::nullopt;
+        }
+        Batch batch = std::move(it->second);
+        this->pending.erase(it);
+        const SenderId sender = batch.sender;
+        auto result = batch.result;
+        return OutboundFrame{this->build(std::move(batch)), queue, sender, 0, std::move(result)};
+    }
+
+    /**
+     * Closes all open batches.
+     * @return Frames to send with their queues, senders and results
+     */
+    std::vector<OutboundFrame> flushAll() {
+        std::vector<OutboundFrame> frames;
+        for (auto &[key, batch] : this->pending) {
+            const SenderId sender = batch.sender;
+            auto result = batch.result;
+            frames.push_back(OutboundFrame{this->build(std::move(batch)), key.second, sender, 0, std::move(result)});
+        }
+        this->pending.clear();
+        return frames;
+    }
+
+    /**
+     * Splits the confirmation or response of a batch sent by the coalescer.
+     * @param frame Received frame
+     * @return Frames to deliver, the received frame itself if it does not belong to a batch
+     */
+    std::vector<std::vector<uint8_t>> split(const std::vector<uint8_t> &frame) {
+        const auto response = dpa::DpaResponseView::tryParse(frame);
+        if (!response.has_value() || response->pnum() != dpa::pnum::OS ||
+            response->requestPcmd() != dpa::pcmd::OS_BATCH || response->isAsynchronous()) {
+            return {frame};
+        }
+        const bool confirmation = response->isConfirmation();
+        auto it = this->inflight.find(response->nadr());
+        if (it == this->inflight.end()) {
+            return {frame};
+        }
+
+        std::vector<std::vector<uint8_t>> frames;
+        for (const auto &command : it->second.front()) {
+            std::vector<uint8_t> part = frame;
+            part[dpa::PNUM_OFFSET] = command.first;
+            part[dpa::PCMD_OFFSET] = confirmation
+                ? command.second
+                : static_cast<uint8_t>(command.second | dpa::RESPONSE_FLAG);
+            if (!confirmation) {
+                part.resize(dpa::RESPONSE_HEADER_SIZE);
+            }
+            frames.push_back(std::move(part));
+        }
+        this->stats.splitResponses += frames.size();
+        if (!confirmation) {
+            it->second.pop_front();
+            if (it->second.empty()) {
+                this->inflight.erase(it);
+            }
+        }
+        return frames;
+    }
+
+    /**
+     * Returns the coalescing configuration.
+     * @return Coalescing configuration
+     */
+    [[nodiscard]] const CoalescingConfig &getConfig() const {
+        return this->config;
+    }
+
+    /**
+     * Returns the coalescing statistics.
+     * @return Coalescing statistics
+     */
+    [[nodiscard]] const CoalescingStats &getStats() const {
+        return this->stats;
+    }
+
+    /**
+     * Checks whether the response of the request carries no data.
+     *
+     * Recognizes LED set, pulse and flashing, IO direction and set, RAM write and EEPROM write.
+     * @param frame DPA request
+     * @return true if the request can be packed into a batch
+     */
+    static bool hasNoResponseData(const std::vector<uint8_t> &frame) {
+        const dpa::DpaRequestView request(frame);
+        const uint8_t pcmd = request.pcmd();
+        switch (request.pnum()) {
+            case dpa::pnum::LEDR:
+            case dpa::pnum::LEDG:
+                return pcmd == dpa::pcmd::LED_SET_OFF || pcmd == dpa::pcmd::LED_SET_ON ||
+                    pcmd == dpa::pcmd::LED_PULSE || pcmd == dpa::pcmd::LED_FLASHING;
+            case dpa::pnum::IO:
+                return pcmd == dpa::pcmd::IO_DIRECTION || pcmd == dpa::pcmd::IO_SET;
+            case dpa::pnum::EEPROM:
+            case dpa::pnum::RAM:
+                return pcmd == dpa::pcmd::MEMORY_WRITE;
+            default:
+                return false;
+        }
+    }
+
+ private:
+    /// Batches per node waiting for the response, older ones are considered lost
+    static constexpr std::size_t MAX_INFLIGHT_BATCHES = 8;
+
+    /// Batch identification, node address and outbound queue
+    typedef std::pair<uint16_t, OutboundQueue> Key;
+
+    /**
+     * Requests waiting to be packed into a batch.
+     */
+    struct Batch {
+        /// Waiting requests
+        std::vector<std::vector<uint8_t>> requests;
+        /// Size of the embedded requests in the batch PDATA
+        std::size_t dataSize = 0;
+        /// Sender of the first request
+        SenderId sender = 0;
+        /// Send result shared by the senders of the requests
+        std::shared_ptr<SendResult> result;
+    };
+
+    /**
+     * Returns the size of the request embedded in the batch PDATA.
+     * @param frame DPA request
+     * @return Size of the embedded request (length byte, PNUM, PCMD, HWPID, PDATA)
+     */
+    static std::size_t embeddedSize(const std::vector<uint8_t> &frame) {
+        return frame.size() - 1;
+    }
+
+    /**
+     * Checks whether the request can be packed into a batch.
+     * @param frame Frame
+     * @return true if the frame is a unicast DPA request to a node accepted by the filter
+     */
+    bool canCoalesce(const std::vector<uint8_t> &frame) const {
+        const auto request = dpa::DpaRequestView::tryParse(frame);
+        if (!request.has_value() || request->pnum() == dpa::pnum::OS) {
+            return false;
+        }
+        if (request->nadr() == dpa::COORDINATOR_ADDRESS || request->nadr() > dpa::MAX_NODE_ADDRESS) {
+            return false;
+        }
+        return BatchCoalescer::embeddedSize(frame) + 1 <= this->config.maxBatchData && this->config.filter(frame);
+    }
+
+    /**
+     * Builds the frame to send from the batch.
+     * @param batch Batch with at least one request
+     * @return The single request or the OS Batch request
+     */
+    std::vector<uint8_t> build(Batch batch) {
+        this->stats.pendingRequests -= batch.requests.size();
+        if (batch.requests.size() == 1) {
+            this->stats.singleRequests++;
+            return std::move(batch.requests.front());
+        }
+
+        const uint16_t nadr = dpa::DpaRequestView(batch.requests.front()).nadr();
+        dpa::OsBatchBuilder<> builder(nadr);
+        std::vector<std::pair<uint8_t, uint8_t>> commands;
+        commands.reserve(batch.requests.size());
+        for (const auto &frame : batch.requests) {
+            const dpa::DpaRequestView request(frame);
+            builder.add(request);
+            commands.emplace_back(request.pnum(), request.pcmd());
+        }
+
+        auto &sent = this->inflight[nadr];
+        sent.push_back(std::move(commands));
+        if (sent.size() > MAX_INFLIGHT_BATCHES) {
+            sent.pop_front();
+        }
+        this->stats.batches++;
+        this->stats.coalescedRequests += batch.requests.size();
+        this->stats.maxBatchRequests = std::max(this->stats.maxBatchRequests, batch.requests.size());
+        return builder.bytes().toVector();
+    }
+
+    /// Coalescing configuration
+    CoalescingConfig config;
+    /// Open batches
+    std::map<Key, Batch> pending;
+    /// Commands of the sent batches waiting for the response, indexed by node address
+    std::map<uint16_t, std::deque<std::vector<std::pair<uint8_t, uint8_t>>>> inflight;
+    /// Coalescing statistics
+    CoalescingStats stats;
+};
+
+}  // namespace iqrf::connector
@@ -11,14 +11,18 @@
 
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "iqrf/gpio/Gpio.h"
+#include "iqrf/gpio/GpioGroup.h"
 
 namespace iqrf::connector {
 
 using iqrf::gpio::Gpio;
+using iqrf::gpio::GpioGroup;
 
 /**
  * Bus switch configuration for enabling/disabling buses.
@@ -68,6 +72,9 @@ class BusSwitcherConfig {
     std::optional<Gpio> uartEnableGpio;
 };
 
+/**
+ * Bus switcher, the bus enable GPIOs are switched at once as a GPIO group.
+ */
 class BusSwitcher {
  public:
     /**
@@ -75,6 +82,23 @@ class BusSwitcher {
      * @param config Bus switch configuration
      */
     explicit BusSwitcher(BusSwitcherConfig config): config(std::move(config)) {
+        std::vector<Gpio> lines;
+        if (this->config.busEnableGpio) {
+            this->busMask = BusSwitcher::addLine(lines, *this->config.busEnableGpio);
+        } else {
+            if (this->config.i2cEnableGpio) {
+                this->i2cMask = BusSwitcher::addLine(lines, *this->config.i2cEnableGpio);
+            }
+            if (this->config.spiEnableGpio) {
+                this->spiMask = BusSwitcher::addLine(lines, *this->config.spiEnableGpio);
+            }
+            if (this->config.uartEnableGpio) {
+                this->uartMask = BusSwitcher::addLine(lines, *this->config.uartEnableGpio);
+            }
+        }
+        if (!lines.empty()) {
+            this->group.emplace(std::move(lines));
+        }
     }
 
     /**
@@ -87,19 +111,9 @@ class BusSwitcher {
     /**
      * Initializes the bus switch GPIOs to their default state.
      */
-    void init() const {
-        if (this->config.busEnableGpio) {
-            this->config.busEnableGpio->initOutput(false);
-            return;
-        }
-        if (this->config.i2cEnableGpio) {
-            this->config.i2cEnableGpio->initOutput(false);
-        }
-        if (this->config.spiEnableGpio) {
-            this->config.spiEnableGpio->initOutput(false);
-        }
-        if (this->config.uartEnableGpio) {
-            this->config.uartEnableGpio->initOutput(false);
+    void init() {
+        if (this->group) {
+            this->group->initOutput(0);
         }
     }
 
@@ -110,19 +124,14 @@ class BusSwitcher {
      * @param uart UART bus enable state
      */
     void toggle(const bool i2c, const bool spi, const bool uart) const {
+        if (!this->group) {
+            return;
+        }
         if (this->config.busEnableGpio) {
-            this->config.busEnableGpio->setValue(i2c || spi || uart);
-        } else {
-            if (this->config.i2cEnableGpio) {
-                this->config.i2cEnableGpio->setValue(i2c);
-            }
-            if (this->config.spiEnableGpio) {
-                this->config.spiEnableGpio->setValue(spi);
-            }
-            if (this->config.uartEnableGpio) {
-                this->config.uartEnableGpio->setValue(uart);
-            }
+            this->group->setValues((i2c || spi || uart) ? this->busMask : 0);
+            return;
         }
+        this->group->setValues((i2c ? this->i2cMask : 0) | (spi ? this->spiMask : 0) | (uart ? this->uartMask : 0));
     }
 
     /**
@@ -149,9 +158,38 @@ class BusSwitcher {
         this->toggle(false, false, enable);
     }
 
+    /**
+     * Returns the group of the bus enable GPIOs.
+     * @return Bus enable GPIO group, empty if no GPIO is configured
+     */
+    [[nodiscard]] const std::optional<GpioGroup> &getGroup() const {
+        return this->group;
+    }
+
  private:
+    /**
+     * Appends the GPIO to the group lines.
+     * @param lines Group lines
+     * @param gpio GPIO to append
+     * @return Mask of the GPIO in the group
+     */
+    static uint64_t addLine(std::vector<Gpio> &lines, const Gpio &gpio) {
+        lines.push_back(gpio);
+        return uint64_t{1} << (lines.size() - 1);
+    }
+
     /// Bus switch configuration
     BusSwitcherConfig config;
+    /// Bus enable GPIOs switched at once
+    std::optional<GpioGroup> group;
+    /// Mask of the bus enable GPIO in the group
+    uint64_t busMask = 0;
+    /// Mask of the I2C enable GPIO in the group
+    uint64_t i2cMask = 0;
+    /// Mask of the SPI enable GPIO in the group
+    uint64_t spiMask = 0;
+    /// Mask of the UART enable GPIO in the group
+    uint64_t uartMask = 0;
 };
 
 }  // namespace iqrf::connector
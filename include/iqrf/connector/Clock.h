@@ -0,0 +1,301 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: Clock.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-17
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+
+#include "iqrf/gpio/Waveform.h"
+
+namespace iqrf::connector {
+
+/**
+ * Source of time and sleeping used by the connectors.
+ */
+class IClock {
+ public:
+    /// Duration of the clock
+    typedef std::chrono::steady_clock::duration Duration;
+    /// Point in time of the clock, compatible with std::chrono::steady_clock
+    typedef std::chrono::steady_clock::time_point TimePoint;
+    /// Condition ending an interruptible sleep early
+    typedef std::function<bool()> WakeCondition;
+
+    /**
+     * Destructor
+     */
+    virtual ~IClock() = default;
+
+    /**
+     * Returns the current time.
+     * @return Current time
+     */
+    [[nodiscard]] virtual TimePoint now() const = 0;
+
+    /**
+     * Blocks the calling thread for the duration.
+     * @param duration Duration of the sleep
+     */
+    virtual void sleepFor(Duration duration) = 0;
+
+    /**
+     * Blocks the calling thread until the deadline.
+     * @param deadline Time to wake up at
+     */
+    void sleepUntil(const TimePoint deadline) {
+        const TimePoint current = this->now();
+        if (deadline > current) {
+            this->sleepFor(deadline - current);
+        }
+    }
+
+    /**
+     * Blocks the calling thread for the duration or until the condition holds.
+     *
+     * The condition is checked when the sleep starts and whenever interrupt() is called, so
+     * the thread changing it has to call interrupt() afterwards, e.g. when a loop is being stopped.
+     * The condition is evaluated under the lock of the clock, it must not take other locks.
+     * Clocks whose sleeps end on their own may check it at the start only.
+     * @param duration Duration of the sleep
+     * @param condition Condition ending the sleep
+     */
+    virtual void sleepForUnless(const Duration duration, const WakeCondition &condition) {
+        if (!condition()) {
+            this->sleepFor(duration);
+        }
+    }
+
+    /**
+     * Wakes up the threads sleeping in sleepForUnless() to check their condition.
+     *
+     * Other sleeps are not affected.
+     */
+    virtual void interrupt() {}
+};
+
+/**
+ * Real monotonic clock.
+ */
+class SteadyClock final : public IClock {
+ public:
+    [[nodiscard]] TimePoint now() const override {
+        return std::chrono::steady_clock::now();
+    }
+
+    void sleepFor(const Duration duration) override {
+        std::this_thread::sleep_for(duration);
+    }
+
+    void sleepForUnless(const Duration duration, const WakeCondition &condition) override {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->changed.wait_for(lock, duration, condition);
+    }
+
+    void interrupt() override {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->changed.notify_all();
+    }
+
+    /**
+     * Returns the shared instance used by default.
+     * @return Steady clock
+     */
+    static std::shared_ptr<IClock> instance() {
+        static const std::shared_ptr<IClock> clock = std::make_shared<SteadyClock>();
+        return clock;
+    }
+
+ private:
+    /// Guards the interruptible sleeps
+    std::mutex mutex;
+    /// Signals an interrupt to the interruptible sleeps
+    std::condition_variable changed;
+};
+
+/**
+ * Clock advanced by hand, for deterministic tests and simulations.
+ *
+ * In the manual mode, sleeping threads block until the time is advanced past their deadline.
+ * In the auto advance mode, a sleep advances the time by its duration and returns immediately,
+ * which suits single-threaded sequences such as the TR power-up.
+ */
+class VirtualClock : public IClock {
+ public:
+    /**
+     * Constructs the virtual clock.
+     * @param autoAdvance Sleeping advances the time instead of blocking
+     * @param start Initial time
+     */
+    explicit VirtualClock(
+        const bool autoAdvance = false,
+        const TimePoint start = TimePoint(std::chrono::seconds(1))
+    ): autoAdvance(autoAdvance), current(start) {}
+
+    [[nodiscard]] TimePoint now() const override {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->current;
+    }
+
+    void sleepFor(const Duration duration) override {
+        this->sleep(duration, nullptr);
+    }
+
+    void sleepForUnless(const Duration duration, const WakeCondition &condition) override {
+        this->sleep(duration, &condition);
+    }
+
+    void interrupt() override {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->changed.notify_all();
+    }
+
+    /**
+     * Advances the time and wakes up the threads whose deadline has passed.
+     * @param duration Duration to advance by
+     */
+    void advance(const Duration duration) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (duration > Duration::zero()) {
+            this->current += duration;
+            this->changed.notify_all();
+        }
+    }
+
+    /**
+     * Advances the time to the point, the time never goes back.
+     * @param time Point in time
+     */
+    void advanceTo(const TimePoint time) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (time > this->current) {
+            this->current = time;
+            this->changed.notify_all();
+        }
+    }
+
+    /**
+     * Returns the earliest deadline of the blocked threads.
+     * @return Earliest deadline or std::nullopt if no thread is blocked
+     */
+    [[nodiscard]] std::optional<TimePoint> nextDeadline() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        const auto it = this->deadlines.upper_bound(this->current);
+        if (it == this->deadlines.end()) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    /**
+     * Waits in real time until the number of threads blocked in a sleep reaches the count.
+     * @param count Number of blocked threads
+     * @param timeout Maximal real time to wait
+     * @return true if the threads are blocked, false on timeout
+     */
+    bool waitForSleepers(
+        const std::size_t count,
+        const std::chrono::milliseconds timeout = std::chrono::milliseconds(5000)
+    ) {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        return this->changed.wait_for(lock, timeout, [this, count] {
+            const auto blocked = std::distance(this->deadlines.upper_bound(this->current), this->deadlines.end());
+            return static_cast<std::size_t>(blocked) >= count;
+        });
+    }
+
+    /**
+     * Returns the number of sleeps.
+     * @return Number of sleeps
+     */
+    [[nodiscard]] uint64_t getSleeps() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->sleeps;
+    }
+
+    /**
+     * Returns the total requested sleep duration.
+     * @return Total sleep duration
+     */
+    [[nodiscard]] Duration getSlept() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->slept;
+    }
+
+ private:
+    /**
+     * Blocks the calling thread until the time is advanced past the deadline or the condition holds.
+     * @param duration Duration of the sleep
+     * @param condition Condition ending the sleep, null if the sleep cannot be interrupted
+     */
+    void sleep(const Duration duration, const WakeCondition *condition) {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->sleeps++;
+        this->slept += duration;
+        if (duration <= Duration::zero() || (condition != nullptr && (*condition)())) {
+            return;
+        }
+        if (this->autoAdvance) {
+            this->current += duration;
+            this->changed.notify_all();
+            return;
+        }
+        const TimePoint deadline = this->current + duration;
+        const auto it = this->deadlines.insert(deadline);
+        this->changed.notify_all();
+        this->changed.wait(lock, [this, deadline, condition] {
+            return this->current >= deadline || (condition != nullptr && (*condition)());
+        });
+        this->deadlines.erase(it);
+    }
+
+    /// Sleeping advances the time instead of blocking
+    const bool autoAdvance;
+    /// Current time
+    TimePoint current;
+    /// Deadlines of the blocked threads
+    std::multiset<TimePoint> deadlines;
+    /// Number of sleeps
+    uint64_t sleeps = 0;
+    /// Total requested sleep duration
+    Duration slept{0};
+    /// Guards the clock state
+    mutable std::mutex mutex;
+    /// Signals the change of the time, the blocked threads or an interrupt
+    std::condition_variable changed;
+};
+
+/**
+ * Adapts the clock to the time source of the GPIO waveforms and the GPIO mock.
+ * @param clock Clock, has to outlive the time source
+ * @return GPIO time source
+ */
+inline gpio::WaveformTimer makeGpioTimer(IClock &clock) {
+    return {
+        [&clock] {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(clock.now().time_since_epoch());
+        },
+        [&clock](const std::chrono::nanoseconds deadline) {
+            clock.sleepUntil(IClock::TimePoint(std::chrono::duration_cast<IClock::Duration>(deadline)));
+        },
+    };
+}
+
+}  // namespace iqrf::connector
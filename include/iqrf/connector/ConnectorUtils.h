@@ -11,10 +11,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <iomanip>
 #include <string>
-#include <sstream>
 #include <vector>
 
 namespace iqrf::connector {
@@ -26,21 +25,23 @@ class ConnectorUtils {
  public:
     /**
      * Converts a vector of bytes to a hex string representation.
+     *
+     * Encoded in place like iqrf::log::toHex(), but inline, so the header-only connector interface
+     * does not depend on the log library.
      * @param input Vector of bytes to convert
-     * @return Hex string representation of the input vector
+     * @return Hex string representation of the input vector, e.g. `00.1f.ff`
      */
     static std::string vectorToHexString(const std::vector<uint8_t>& input) {
-        std::stringstream ss;
-        ss << std::hex << std::setfill('0');
-
-        for (size_t i = 0; i < input.size(); ++i) {
-            ss << std::setw(2) << static_cast<int>(input[i]);
-            if (i + 1 < input.size()) {
-                ss << ".";
-            }
+        static constexpr char DIGITS[] = "0123456789abcdef";
+        if (input.empty()) {
+            return {};
         }
-
-        return ss.str();
+        std::string output(3 * input.size() - 1, '.');
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            output[3 * i] = DIGITS[input[i] >> 4];
+            output[3 * i + 1] = DIGITS[input[i] & 0x0F];
+        }
+        return output;
     }
 };
 
@@ -12,12 +12,25 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <thread>
+#include <utility>
 #include <vector>
 
+#include "iqrf/connector/BatchCoalescer.h"
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/OutboundScheduler.h"
+#include "iqrf/connector/ResponseFilter.h"
+#include "iqrf/connector/SendPacer.h"
+#include "iqrf/log/Logging.h"
+
 namespace iqrf::connector {
 
 /**
@@ -53,8 +66,6 @@ enum class ProgrammingTarget {
     Special
 };
 
-typedef std::function<int(const std::vector<uint8_t>&)> ResponseHandler;
-
 /**
  * Transceiver information as returned by IQRF OS moduleInfo()
  */
@@ -91,16 +102,27 @@ class AccessToken {
     return accessType;
   }
 
+  /**
+   * Get the identifier of the sender bearing this token.
+   */
+  [[nodiscard]] SenderId getSenderId() const {
+    return senderId;
+  }
 
  private:
   // Make the class instantiable only by the IConnector
   friend class IConnector;
-  explicit AccessToken(const AccessType accessType): accessType(accessType) {}
+  AccessToken(const AccessType accessType, const SenderId senderId): accessType(accessType), senderId(senderId) {}
 
   /**
    * The level of access this token bears.
    */
   AccessType accessType;
+
+  /**
+   * Sender identifier used for fair scheduling of outbound frames.
+   */
+  SenderId senderId;
 };
 
 
@@ -112,11 +134,7 @@ class IConnector {
     /**
      * Constructs the connector and initializes the necessary resources (GPIO lines).
      */
-    IConnector() {
-      this->normalResponseHandler = ResponseHandler();
-      this->exclusiveResponseHandler = ResponseHandler();
-      this->snifferResponseHandler = ResponseHandler();
-    }
+    IConnector() = default;
 
     /**
      * Destructor to cleanly release the connection resources.
@@ -142,27 +160,114 @@ class IConnector {
      * In order to send data, a ResponseHandler needs to be registered first.
      * Registering the handler yields the AccessToken used as an authenticator in this function.
      *
+     * The message passes through the outbound scheduler. Exclusive traffic is sent first, then
+     * high and normal priority traffic. While exclusive access is active, messages sent with
+     * a normal access token are held back and sent once the exclusive access is released.
+     *
+     * With coalescing enabled, requests sent with a normal access token may be held for
+     * the coalescing window and packed with other requests to the same node into a DPA
+     * OS Batch request. The sender opening the batch waits for the window and sends it, the
+     * senders joining the batch wait until it is sent and share its result. A request which
+     * cannot be packed is sent after the open batch to the same node, so it never overtakes
+     * the requests sent before it.
+     *
+     * @param data is the message to be sent.
+     * @param token is the access token of the sender.
+     * @param priority is the priority of the message sent with normal access.
+     * @throws std::length_error if the outbound queue is full
+     *
      * TODO: Used in Daemon(IqrfCdc, IqrfSpi, IqrfUart), clibspi, clibuart
      */
-    void send(const std::vector<uint8_t>& data, const AccessToken token) {
-      std::lock_guard<std::recursive_mutex> lock(this->guard);
+    void send(
+        const std::vector<uint8_t>& data,
+        const AccessToken &token,
+        const SendPriority priority = SendPriority::Normal
+    ) {
+      const OutboundQueue queue = this->outboundQueueFor(token, priority);
+      auto result = std::make_shared<SendResult>();
+      {
+        std::unique_lock<std::mutex> lock(this->outboundGuard);
+        if (this->coalescer.has_value() && token.getAccessType() == AccessType::Normal) {
+          switch (this->coalescer->add(data, queue, token.getSenderId(), result)) {
+            case BatchCoalescer::Admission::Joined: {
+              // Sent by the sender which opened the batch
+              auto batchResult = this->coalescer->getResult(data, queue);
+              lock.unlock();
+              this->awaitOutbound(batchResult);
+              return;
+            }
+            case BatchCoalescer::Admission::Leader: {
+              const auto window = this->coalescer->getConfig().window;
+              lock.unlock();
+              this->clock->sleepFor(window);
+              lock.lock();
+              // Already enqueued if flushed before a bypassing request or by disabling the coalescing
+              if (this->coalescer.has_value()) {
+                auto frame = this->coalescer->flush(data, queue, result);
+                if (frame.has_value()) {
+                  this->enqueueBatch(queue, token.getSenderId(), std::move(*frame), result);
+                }
+              }
+              break;
+            }
+            default: {
+              auto batch = this->coalescer->flushBefore(data, queue);
+              if (batch.has_value()) {
+                // Enqueued to the flow of the sender, so it cannot be overtaken by the request
+                this->enqueueBatch(queue, token.getSenderId(), std::move(batch->data), batch->result);
+              }
+              this->outbound.enqueue(queue, token.getSenderId(), data, result);
+              break;
+            }
+          }
+        } else {
+          this->outbound.enqueue(queue, token.getSenderId(), data, result);
+        }
+      }
+      this->dispatchOutbound(result);
+    }
 
-      switch (token.getAccessType()) {
-        case AccessType::Normal:
-          if (this->hasExclusiveAccess()) {
-            // TODO: Custom exceptions
-            throw std::runtime_error("Cannot send: Exclusive access is active");
+    /**
+     * Send several data messages via the connector at once.
+     *
+     * The messages are enqueued together and dispatched in a single pass, so they reach
+     * the link back to back in the given order, subject to the scheduling of other senders.
+     *
+     * @param messages are the messages to be sent.
+     * @param token is the access token of the sender.
+     * @param priority is the priority of the messages sent with normal access.
+     * @throws std::length_error if the outbound queue is full, the messages enqueued
+     *         before the failure are still sent
+     */
+    void sendBatch(
+        const std::vector<std::vector<uint8_t>>& messages,
+        const AccessToken &token,
+        const SendPriority priority = SendPriority::Normal
+    ) {
+      if (messages.empty()) {
+        return;
+      }
+      const OutboundQueue queue = this->outboundQueueFor(token, priority);
+      auto result = std::make_shared<SendResult>();
+      bool enqueued = false;
+      std::exception_ptr error;
+      {
+        std::lock_guard<std::mutex> lock(this->outboundGuard);
+        for (const auto &message : messages) {
+          try {
+            this->outbound.enqueue(queue, token.getSenderId(), message, result);
+          } catch (const std::length_error &) {
+            error = std::current_exception();
+            break;
           }
-          this->send(data);
-          break;
-        case AccessType::Exclusive:
-          this->send(data);
-          break;
-        case AccessType::Sniffer:
-          // TODO: Custom exceptions
-          throw std::runtime_error("Cannot send: Sniffer token does not allow sending");
-        default:
-          break;
+          enqueued = true;
+        }
+      }
+      if (enqueued) {
+        this->dispatchOutbound(result);
+      }
+      if (error) {
+        std::rethrow_exception(error);
       }
     }
 
@@ -178,54 +283,123 @@ class IConnector {
      *
      * Upon successful register yields an AccessToken which can be used to access this channel.
      *
+     * Several normal and sniffer handlers can be registered at once. The filter is evaluated
+     * in the listening loop and the handler receives only the matching messages.
+     *
      * TODO: Used in Daemon(IqrfCdc, IqrfSpi, IqrfUart)
      */
-    AccessToken registerResponseHandler(const ResponseHandler &responseHandler, const AccessType access) {
+    AccessToken registerResponseHandler(
+        const ResponseHandler &responseHandler,
+        const AccessType access,
+        const ResponseFilter &filter = ResponseFilter()
+    ) {
       std::lock_guard<std::recursive_mutex> lock(this->guard);
 
+      const SenderId senderId = this->nextSenderId++;
       switch (access) {
         case AccessType::Normal:
-          if (this->normalResponseHandler) {
-            // TODO: Send EOF to the previous handler
-          }
-          this->normalResponseHandler = responseHandler;
+          this->normalSubscriptions.add(senderId, responseHandler, filter);
           break;
         case AccessType::Exclusive:
           if (this->hasExclusiveAccess()) {
             // TODO: Custom exceptions
             throw std::runtime_error("Exclusive access already assigned");
           }
-          this->exclusiveResponseHandler = responseHandler;
+          this->exclusiveSubscriptions.add(senderId, responseHandler, filter);
+          this->exclusiveActive = true;
           break;
         case AccessType::Sniffer:
-          this->snifferResponseHandler = responseHandler;
+          this->snifferSubscriptions.add(senderId, responseHandler, filter);
           break;
         default:
             // TODO: Custom exceptions
             throw std::runtime_error("Invalid access type for response handler registration");
       }
 
-      return AccessToken(access);
+      return AccessToken(access, senderId);
     }
 
     /**
-     * Unregister the previously registered responseHandler.
+     * Register the handler receiving the messages in batches.
+     *
+     * The messages matching the filter are accumulated and passed to the handler at once when
+     * the batch reaches the maximal size, when the first message has waited for the maximal
+     * linger time or when no more messages arrive, e.g. at the end of an FRC round. The handler
+     * is unregistered by unregisterResponseHandler(), the pending messages are delivered first.
+     *
+     * @param responseHandler is the handler receiving the batches.
+     * @param access is the access type, exclusive access cannot be batched.
+     * @param config is the batch delivery configuration.
+     * @param filter is the message filter.
+     * @throws std::invalid_argument if the maximal batch size is zero
      */
-    void unregisterResponseHandler(const AccessToken token) {
+    AccessToken registerBatchResponseHandler(
+        const BatchResponseHandler &responseHandler,
+        const AccessType access,
+        const BatchDeliveryConfig &config = BatchDeliveryConfig(),
+        const ResponseFilter &filter = ResponseFilter()
+    ) {
       std::lock_guard<std::recursive_mutex> lock(this->guard);
 
-      switch (token.getAccessType()) {
+      const SenderId senderId = this->nextSenderId++;
+      switch (access) {
         case AccessType::Normal:
-          this->normalResponseHandler = ResponseHandler();
-          break;
-        case AccessType::Exclusive:
-          this->exclusiveResponseHandler = ResponseHandler();
+          this->normalSubscriptions.addBatch(senderId, responseHandler, filter, config);
           break;
         case AccessType::Sniffer:
-          this->snifferResponseHandler = ResponseHandler();
+          this->snifferSubscriptions.addBatch(senderId, responseHandler, filter, config);
           break;
         default:
-          break;
+          // TODO: Custom exceptions
+          throw std::runtime_error("Invalid access type for batch response handler registration");
+      }
+
+      return AccessToken(access, senderId);
+    }
+
+    /**
+     * Unregister the previously registered responseHandler.
+     */
+    void unregisterResponseHandler(const AccessToken token) {
+      {
+        std::lock_guard<std::recursive_mutex> lock(this->guard);
+
+        switch (token.getAccessType()) {
+          case AccessType::Normal:
+            this->normalSubscriptions.remove(token.getSenderId());
+            break;
+          case AccessType::Exclusive:
+            this->exclusiveSubscriptions.clear();
+            this->exclusiveActive = false;
+            break;
+          case AccessType::Sniffer:
+            this->snifferSubscriptions.remove(token.getSenderId());
+            break;
+          default:
+            break;
+        }
+      }
+
+      if (token.getAccessType() == AccessType::Exclusive) {
+        // Drain the traffic held back during the exclusive access
+        this->dispatchOutbound();
+      }
+    }
+
+    /**
+     * Get the statistics of the message dispatch to the response handlers.
+     *
+     * @param access is the access type of the handlers.
+     */
+    DispatchStats getDispatchStats(const AccessType access) const {
+      std::lock_guard<std::recursive_mutex> lock(this->guard);
+      switch (access) {
+        case AccessType::Exclusive:
+          return this->exclusiveSubscriptions.getStats();
+        case AccessType::Sniffer:
+          return this->snifferSubscriptions.getStats();
+        default:
+          return this->normalSubscriptions.getStats();
       }
     }
 
@@ -257,11 +431,37 @@ class IConnector {
      */
     void stopListen() {
         this->listening = false;
+        // Wakes up the idle sleep of the listening loop only
+        this->clock->interrupt();
         if (this->listeningThread.joinable()) {
             this->listeningThread.join();
         }
     }
 
+    // Timing
+
+    /**
+     * Replace the clock used for all timing of the connector.
+     *
+     * The clock has to be set before the connector is used, the steady clock is used by default.
+     *
+     * @param newClock is the new clock.
+     * @throws std::invalid_argument if the clock is null
+     */
+    void setClock(std::shared_ptr<IClock> newClock) {
+      if (!newClock) {
+        throw std::invalid_argument("Clock cannot be null");
+      }
+      this->clock = std::move(newClock);
+    }
+
+    /**
+     * Get the clock used for all timing of the connector.
+     */
+    IClock &getClock() const {
+      return *this->clock;
+    }
+
     // Exclusive access
 
     /**
@@ -270,8 +470,101 @@ class IConnector {
      * TODO: Used in Daemon(IqrfCdc, IqrfSpi, IqrfUart)
      */
     bool hasExclusiveAccess() const {
-      std::lock_guard<std::recursive_mutex> lock(this->guard);
-      return static_cast<bool>(this->exclusiveResponseHandler);
+      return this->exclusiveActive;
+    }
+
+    // Outbound scheduling
+
+    /**
+     * Changes the configuration of the outbound scheduler.
+     *
+     * @param config is the new scheduler configuration.
+     */
+    void configureOutbound(const OutboundSchedulerConfig &config) {
+      std::lock_guard<std::mutex> lock(this->outboundGuard);
+      this->outbound.configure(config);
+    }
+
+    /**
+     * Get the statistics of the outbound scheduler.
+     */
+    OutboundSchedulerStats getOutboundStats() const {
+      std::lock_guard<std::mutex> lock(this->outboundGuard);
+      return this->outbound.getStats();
+    }
+
+    /**
+     * Enable pacing of outbound messages.
+     *
+     * Messages are delayed just enough not to overflow the TR module input buffer and
+     * not to exceed the RF duty cycle.
+     *
+     * @param config is the pacing configuration.
+     */
+    void enablePacing(const PacingConfig &config) {
+      std::lock_guard<std::mutex> lock(this->outboundGuard);
+      this->pacer.emplace(config, this->clock->now());
+    }
+
+    /**
+     * Disable pacing of outbound messages.
+     */
+    void disablePacing() {
+      std::lock_guard<std::mutex> lock(this->outboundGuard);
+      this->pacer.reset();
+    }
+
+    /**
+     * Get the statistics of the send pacing.
+     *
+     * @return Pacing statistics or std::nullopt if the pacing is disabled.
+     */
+    std::optional<PacingStats> getPacingStats() const {
+      std::lock_guard<std::mutex> lock(this->outboundGuard);
+      if (!this->pacer.has_value()) {
+        return std::nullopt;
+      }
+      return this->pacer->getStats();
+    }
+
+    /**
+     * Enable coalescing of DPA requests into DPA OS Batch requests.
+     *
+     * @param config is the coalescing configuration.
+     */
+    void enableCoalescing(const CoalescingConfig &config) {
+      std::lock_guard<std::mutex> lock(this->outboundGuard);
+      this->coalescer.emplace(config);
+    }
+
+    /**
+     * Disable coalescing of DPA requests, the open batches are sent immediately.
+     */
+    void disableCoalescing() {
+      {
+        std::lock_guard<std::mutex> lock(this->outboundGuard);
+        if (!this->coalescer.has_value()) {
+          return;
+        }
+        for (auto &frame : this->coalescer->flushAll()) {
+          this->enqueueBatch(frame.queue, frame.sender, std::move(frame.data), frame.result);
+        }
+        this->coalescer.reset();
+      }
+      this->dispatchOutbound();
+    }
+
+    /**
+     * Get the statistics of the request coalescing.
+     *
+     * @return Coalescing statistics or std::nullopt if the coalescing is disabled.
+     */
+    std::optional<CoalescingStats> getCoalescingStats() const {
+      std::lock_guard<std::mutex> lock(this->outboundGuard);
+      if (!this->coalescer.has_value()) {
+        return std::nullopt;
+      }
+      return this->coalescer->getStats();
     }
 
     // Transceiver operations
@@ -389,31 +682,49 @@ class IConnector {
                 recvBuffer = this->receive();
 
                 if (recvBuffer.empty()) {
-                    // No data received, continue listening
-                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    // No data received, the burst is over
+                    this->flushBatches();
+                    this->clock->sleepForUnless(std::chrono::milliseconds(50), [this] { return !this->listening; });
                     continue;
                 }
 
+                const auto messages = this->notifyReceived(recvBuffer);
+                const auto now = this->clock->now();
+
                 std::lock_guard<std::recursive_mutex> lock(this->guard);
 
-                if (this->hasExclusiveAccess()) {
-                    this->exclusiveResponseHandler(recvBuffer);
-                } else {
-                   this->normalResponseHandler(recvBuffer);
+                for (const auto &message : messages) {
+                    if (this->hasExclusiveAccess()) {
+                        this->exclusiveSubscriptions.dispatch(message, now);
+                    } else {
+                        this->normalSubscriptions.dispatch(message, now);
+                    }
                 }
 
-                if (this->snifferResponseHandler) {
-                   this->snifferResponseHandler(recvBuffer);
+                if (!this->snifferSubscriptions.empty()) {
+                    this->snifferSubscriptions.dispatch(recvBuffer, now);
                 }
 
-                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                // Keep receiving while the messages come, long bursts are cut by the linger time
+                this->normalSubscriptions.flushExpired(now);
+                this->snifferSubscriptions.flushExpired(now);
             }
+            this->flushBatches();
         } catch (...) {
             // TODO: Report error
             this->listening = false;
         }
     }
 
+    /**
+     * Deliver the messages accumulated for the batch response handlers.
+     */
+    void flushBatches() {
+        std::lock_guard<std::recursive_mutex> lock(this->guard);
+        this->normalSubscriptions.flush();
+        this->snifferSubscriptions.flush();
+    }
+
     /**
      * Send the data message directly via the connector.
      *
@@ -421,13 +732,172 @@ class IConnector {
      */
     virtual void send(const std::vector<uint8_t>& data) = 0;
 
+    /**
+     * Send the queued messages allowed by the current access mode.
+     *
+     * Only one thread writes to the link at a time, the others wait and find their messages
+     * already sent. A failed message stores its failure in the result of the call which
+     * enqueued it, whichever thread sends it, and the first failure is rethrown to that caller
+     * once it gets to dispatch. Failures of the messages nobody waits for anymore, e.g. those
+     * released after an exclusive access, are logged.
+     *
+     * @param result is the result of the caller's messages, null if none.
+     */
+    void dispatchOutbound(const std::shared_ptr<SendResult> &result = nullptr) {
+      std::lock_guard<std::mutex> dispatchLock(this->dispatchGuard);
+
+      while (true) {
+        std::optional<OutboundFrame> frame;
+        std::chrono::microseconds delay(0);
+        {
+          std::lock_guard<std::mutex> lock(this->outboundGuard);
+          frame = this->outbound.pop(this->exclusiveActive);
+          if (frame.has_value() && this->pacer.has_value()) {
+            delay = this->pacer->reserve(frame->data, this->clock->now());
+          }
+        }
+        if (!frame.has_value()) {
+          break;
+        }
+
+        if (delay.count() > 0) {
+          IQRF_LOG(::iqrf::log::Level::Trace) << "Pacing outbound message by " << delay.count() << " us";
+          this->clock->sleepFor(delay);
+        }
+
+        try {
+          this->send(frame->data);
+          std::lock_guard<std::mutex> lock(this->outboundGuard);
+          if (this->pacer.has_value()) {
+            this->pacer->onSent(frame->data, this->clock->now());
+          }
+        } catch (const std::exception &e) {
+          if (frame->result && frame->result->waiting) {
+            if (!frame->result->failure) {
+              frame->result->failure = std::current_exception();
+            }
+          } else {
+            IQRF_LOG(::iqrf::log::Level::Error) << "Failed to send queued message: " << e.what();
+          }
+        }
+      }
+
+      if (result) {
+        // Messages held back by an exclusive access are sent after the caller returns
+        result->waiting = false;
+        this->outboundSent.notify_all();
+        if (result->failure) {
+          std::rethrow_exception(result->failure);
+        }
+      }
+    }
+
+    /**
+     * Enqueue the batch closed by the coalescer.
+     *
+     * The batch is shared by several senders, a failure to enqueue it is stored in its result
+     * and reported to all of them by the sender which opened it.
+     *
+     * @param queue is the outbound queue of the batch.
+     * @param sender is the sender the batch is enqueued for.
+     * @param data is the batch request.
+     * @param result is the result shared by the senders of the batch.
+     * @throws std::length_error if the outbound queue is full and nobody waits for the result
+     */
+    void enqueueBatch(
+        const OutboundQueue queue,
+        const SenderId sender,
+        std::vector<uint8_t> data,
+        const std::shared_ptr<SendResult> &result
+    ) {
+      try {
+        this->outbound.enqueue(queue, sender, std::move(data), result);
+      } catch (const std::length_error &) {
+        if (!result) {
+          throw;
+        }
+        result->failure = std::current_exception();
+      }
+    }
+
+    /**
+     * Wait until the sender owning the result has dispatched its messages.
+     *
+     * Used by the senders whose requests joined a coalesced batch, they share the result
+     * of the sender which opened the batch.
+     *
+     * @param result is the shared result.
+     */
+    void awaitOutbound(const std::shared_ptr<SendResult> &result) {
+      if (!result) {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(this->dispatchGuard);
+      this->outboundSent.wait(lock, [&result] { return !result->waiting; });
+      if (result->failure) {
+        std::rethrow_exception(result->failure);
+      }
+    }
+
+    /**
+     * Map the access token and priority to the outbound queue.
+     *
+     * @param token is the access token of the sender.
+     * @param priority is the priority of the message sent with normal access.
+     * @throws std::runtime_error if the token does not allow sending
+     */
+    static OutboundQueue outboundQueueFor(const AccessToken &token, const SendPriority priority) {
+      switch (token.getAccessType()) {
+        case AccessType::Normal:
+          return priority == SendPriority::High ? OutboundQueue::High : OutboundQueue::Normal;
+        case AccessType::Exclusive:
+          return OutboundQueue::Exclusive;
+        case AccessType::Sniffer:
+          // TODO: Custom exceptions
+          throw std::runtime_error("Cannot send: Sniffer token does not allow sending");
+        default:
+          throw std::runtime_error("Cannot send: Invalid access type");
+      }
+    }
+
+    /**
+     * Pass the received message to the outbound path, e.g. to track DPA confirmations.
+     *
+     * @param data is the received message.
+     * @return Messages to deliver to the response handlers, responses of DPA OS Batch requests
+     *         created by the coalescing are split into responses of the original requests.
+     */
+    std::vector<std::vector<uint8_t>> notifyReceived(const std::vector<uint8_t> &data) {
+      std::lock_guard<std::mutex> lock(this->outboundGuard);
+      if (this->pacer.has_value()) {
+        this->pacer->onReceived(data, this->clock->now());
+      }
+      if (this->coalescer.has_value()) {
+        return this->coalescer->split(data);
+      }
+      return {data};
+    }
+
 
  private:
-  // Response handlers for managing the replies from Transceiver modules asynchronously
-  // NOTE: Could be written as a map<AccessToken,ResponseHandler> to enable multiple access
-  ResponseHandler normalResponseHandler;
-  ResponseHandler exclusiveResponseHandler;
-  ResponseHandler snifferResponseHandler;
+  // Response handlers for managing the replies from Transceiver modules asynchronously,
+  // indexed by the sender identifier of their access token
+  SubscriptionTable normalSubscriptions;
+  SubscriptionTable exclusiveSubscriptions;
+  SubscriptionTable snifferSubscriptions;
+  std::atomic_bool exclusiveActive = false;
+
+  // Outbound scheduling, pacing and coalescing of messages, dispatchGuard serializes writes to the link
+  OutboundScheduler outbound;
+  std::optional<SendPacer> pacer;
+  std::optional<BatchCoalescer> coalescer;
+  mutable std::mutex outboundGuard;
+  std::mutex dispatchGuard;
+  std::condition_variable outboundSent;
+  std::atomic<SenderId> nextSenderId = 1;
+
+  // Source of time and sleeping
+  std::shared_ptr<IClock> clock = SteadyClock::instance();
 
   // Control variables for the listening loop
   std::atomic_bool listening = false;
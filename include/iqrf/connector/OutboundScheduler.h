@@ -0,0 +1,317 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: OutboundScheduler.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-04
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace iqrf::connector {
+
+/**
+ * Priority of the outbound frame sent with normal access.
+ */
+enum class SendPriority {
+    /// Regular traffic, e.g. periodic polling
+    Normal,
+    /// Urgent traffic, e.g. actuator commands
+    High
+};
+
+/**
+ * Outbound queue of the scheduler.
+ *
+ * Queues are served in strict order, exclusive first.
+ */
+enum class OutboundQueue {
+    /// Frames sent with exclusive access
+    Exclusive = 0,
+    /// Frames sent with normal access and high priority
+    High = 1,
+    /// Frames sent with normal access and normal priority
+    Normal = 2
+};
+
+/// Identifier of the frame sender
+typedef uint32_t SenderId;
+
+/**
+ * Result of the frames enqueued by a single send call.
+ *
+ * Shared by the frames and their sender, accessed under the dispatch lock of the connector.
+ * A coalesced batch shares the result of the sender which opened it with the senders which
+ * joined it, they wait until the sender stops waiting.
+ */
+struct SendResult {
+    /// First send failure of the frames
+    std::exception_ptr failure;
+    /// Whether the sender still waits for the result
+    bool waiting = true;
+};
+
+/**
+ * Frame waiting in the outbound scheduler.
+ */
+struct OutboundFrame {
+    /// Frame data
+    std::vector<uint8_t> data;
+    /// Queue the frame has been enqueued to
+    OutboundQueue queue;
+    /// Sender of the frame
+    SenderId sender;
+    /// Sequence number assigned by the scheduler, starts at 1
+    uint64_t sequence;
+    /// Result of the sender's call, null if nobody waits for it
+    std::shared_ptr<SendResult> result;
+};
+
+/**
+ * Outbound scheduler configuration.
+ */
+struct OutboundSchedulerConfig {
+    /// Deficit round-robin quantum in bytes added to a sender per round
+    std::size_t quantum = 64;
+    /// Maximum number of frames waiting in a single queue
+    std::size_t maxQueuedFrames = 1024;
+};
+
+/**
+ * Outbound scheduler statistics.
+ *
+ * Counters are indexed by OutboundQueue.
+ */
+struct OutboundSchedulerStats {
+    /// Number of frames enqueued
+    std::array<uint64_t, 3> enqueued = {};
+    /// Number of frames dispatched to the link
+    std::array<uint64_t, 3> dispatched = {};
+    /// Number of frames rejected because the queue was full
+    std::array<uint64_t, 3> rejected = {};
+    /// Number of frames currently waiting
+    std::array<std::size_t, 3> depth = {};
+    /// Highest number of frames waiting in a queue
+    std::array<std::size_t, 3> maxDepth = {};
+    /// Number of frames currently held back by active exclusive access
+    uint64_t held = 0;
+};
+
+/**
+ * Priority-aware scheduler of outbound frames.
+ *
+ * Frames are kept in three queues (exclusive, high and normal priority) served in strict
+ * priority order. Within a queue, senders are served by deficit round-robin so a sender
+ * flooding the link with bulk traffic cannot starve the others. While exclusive access
+ * is active, the high and normal queues are held back and released once it ends.
+ *
+ * The scheduler itself is not thread-safe, the owner is responsible for locking.
+ */
+class OutboundScheduler {
+ public:
+    /**
+     * Constructs the outbound scheduler.
+     * @param config Scheduler configuration
+     */
+    explicit OutboundScheduler(const OutboundSchedulerConfig &config = OutboundSchedulerConfig()) {
+        this->configure(config);
+    }
+
+    /**
+     * Changes the scheduler configuration.
+     * @param newConfig Scheduler configuration
+     * @throws std::invalid_argument if the quantum or the queue size is zero
+     */
+    void configure(const OutboundSchedulerConfig &newConfig) {
+        if (newConfig.quantum == 0) {
+            throw std::invalid_argument("Outbound scheduler quantum cannot be zero");
+        }
+        if (newConfig.maxQueuedFrames == 0) {
+            throw std::invalid_argument("Outbound scheduler queue size cannot be zero");
+        }
+        this->config = newConfig;
+    }
+
+    /**
+     * Enqueues the frame.
+     * @param queue Target queue
+     * @param sender Sender of the frame
+     * @param data Frame data
+     * @param result Result of the sender's call, null if nobody waits for it
+     * @return Sequence number of the enqueued frame
+     * @throws std::length_error if the target queue is full
+     */
+    uint64_t enqueue(
+        const OutboundQueue queue,
+        const SenderId sender,
+        std::vector<uint8_t> data,
+        std::shared_ptr<SendResult> result = nullptr
+    ) {
+        const auto index = static_cast<std::size_t>(queue);
+        Queue &target = this->queues[index];
+        if (target.size >= this->config.maxQueuedFrames) {
+            this->stats.rejected[index]++;
+            throw std::length_error("Outbound queue is full");
+        }
+        auto [it, inserted] = target.flows.try_emplace(sender);
+        if (inserted || it->second.frames.empty()) {
+            target.active.push_back(sender);
+        }
+        const uint64_t sequence = this->nextSequence++;
+        it->second.frames.push_back(OutboundFrame{std::move(data), queue, sender, sequence, std::move(result)});
+        target.size++;
+        this->stats.enqueued[index]++;
+        this->stats.depth[index] = target.size;
+        if (target.size > this->stats.maxDepth[index]) {
+            this->stats.maxDepth[index] = target.size;
+        }
+        return sequence;
+    }
+
+    /**
+     * Removes the next frame to be sent.
+     * @param exclusiveActive Whether exclusive access is active, holds back non-exclusive queues
+     * @return Next frame or std::nullopt if there is nothing to send
+     */
+    std::optional<OutboundFrame> pop(const bool exclusiveActive) {
+        for (std::size_t index = 0; index < this->queues.size(); ++index) {
+            if (this->queues[index].size == 0) {
+                continue;
+            }
+            if (exclusiveActive && index != static_cast<std::size_t>(OutboundQueue::Exclusive)) {
+                this->stats.held = this->heldFrames();
+                return std::nullopt;
+            }
+            auto frame = this->popDrr(this->queues[index]);
+            this->stats.dispatched[index]++;
+            this->stats.depth[index] = this->queues[index].size;
+            this->stats.held = exclusiveActive ? this->heldFrames() : 0;
+            return frame;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Checks whether a frame can be sent.
+     * @param exclusiveActive Whether exclusive access is active
+     * @return true if pop() would return a frame
+     */
+    [[nodiscard]] bool hasPending(const bool exclusiveActive) const {
+        if (exclusiveActive) {
+            return this->queues[static_cast<std::size_t>(OutboundQueue::Exclusive)].size > 0;
+        }
+        return this->size() > 0;
+    }
+
+    /**
+     * Returns number of frames waiting in all queues.
+     * @return Number of waiting frames
+     */
+    [[nodiscard]] std::size_t size() const {
+        std::size_t total = 0;
+        for (const auto &queue : this->queues) {
+            total += queue.size;
+        }
+        return total;
+    }
+
+    /**
+     * Returns the scheduler statistics.
+     * @return Scheduler statistics
+     */
+    [[nodiscard]] const OutboundSchedulerStats &getStats() const {
+        return this->stats;
+    }
+
+ private:
+    /**
+     * Frames of a single sender in a queue.
+     */
+    struct Flow {
+        /// Waiting frames
+        std::deque<OutboundFrame> frames;
+        /// Deficit counter in bytes
+        std::size_t deficit = 0;
+        /// Quantum has already been granted in the current round
+        bool credited = false;
+    };
+
+    /**
+     * Single priority queue with per-sender flows.
+     */
+    struct Queue {
+        /// Flows indexed by sender
+        std::unordered_map<SenderId, Flow> flows;
+        /// Round-robin list of senders with waiting frames
+        std::deque<SenderId> active;
+        /// Number of waiting frames
+        std::size_t size = 0;
+    };
+
+    /**
+     * Removes the next frame from the queue using deficit round-robin.
+     * @param queue Non-empty queue
+     * @return Next frame
+     */
+    OutboundFrame popDrr(Queue &queue) {
+        while (true) {
+            const SenderId sender = queue.active.front();
+            Flow &flow = queue.flows.at(sender);
+            if (!flow.credited) {
+                flow.deficit += this->config.quantum;
+                flow.credited = true;
+            }
+            const std::size_t frameSize = flow.frames.front().data.size();
+            if (frameSize <= flow.deficit) {
+                flow.deficit -= frameSize;
+                OutboundFrame frame = std::move(flow.frames.front());
+                flow.frames.pop_front();
+                queue.size--;
+                if (flow.frames.empty()) {
+                    queue.active.pop_front();
+                    queue.flows.erase(sender);
+                }
+                return frame;
+            }
+            // Not enough credit, the sender has to wait for the next round
+            flow.credited = false;
+            queue.active.pop_front();
+            queue.active.push_back(sender);
+        }
+    }
+
+    /**
+     * Returns number of frames in the non-exclusive queues.
+     * @return Number of held frames
+     */
+    [[nodiscard]] std::size_t heldFrames() const {
+        return this->queues[static_cast<std::size_t>(OutboundQueue::High)].size +
+            this->queues[static_cast<std::size_t>(OutboundQueue::Normal)].size;
+    }
+
+    /// Scheduler configuration
+    OutboundSchedulerConfig config;
+    /// Queues indexed by OutboundQueue
+    std::array<Queue, 3> queues;
+    /// Sequence number of the next enqueued frame
+    uint64_t nextSequence = 1;
+    /// Scheduler statistics
+    OutboundSchedulerStats stats;
+};
+
+}  // namespace iqrf::connector
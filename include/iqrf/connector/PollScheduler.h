@@ -0,0 +1,672 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: PollScheduler.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-08
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/IConnector.h"
+#include "iqrf/log/Logging.h"
+
+namespace iqrf::connector {
+
+/// Identifier of the scheduled poll job, 0 is never assigned
+typedef uint64_t PollJobId;
+
+/**
+ * Poll scheduler configuration.
+ */
+struct PollSchedulerConfig {
+    /// Resolution of the timer wheel, jobs due within the same tick are sent as one batch
+    std::chrono::milliseconds tick = std::chrono::milliseconds(10);
+    /// Part of the period in the range [0, 1] over which the first run of a periodic job is spread
+    double startJitter = 1.0;
+    /// Seed of the jitter generator, 0 for a random seed
+    uint32_t seed = 0;
+    /// Number of job slots allocated in advance
+    std::size_t reservedJobs = 1024;
+    /// Clock driving the scheduler thread, the steady clock if not set
+    std::shared_ptr<IClock> clock;
+};
+
+/**
+ * Poll scheduler statistics.
+ */
+struct PollSchedulerStats {
+    /// Number of scheduled jobs
+    std::size_t jobs = 0;
+    /// Number of job runs
+    uint64_t fired = 0;
+    /// Number of batches passed to the connector
+    uint64_t batches = 0;
+    /// Number of batches the connector failed to send
+    uint64_t failedBatches = 0;
+    /// Size of the largest batch
+    std::size_t maxBatchSize = 0;
+    /// Number of cancelled jobs
+    uint64_t cancelled = 0;
+    /// Number of jobs moved from a coarser wheel level to a finer one
+    uint64_t cascaded = 0;
+    /// Number of ticks processed, ticks without due or cascaded jobs are skipped
+    uint64_t ticks = 0;
+    /// Number of times the scheduler thread woke up
+    uint64_t wakeups = 0;
+};
+
+/**
+ * Scheduler of periodic and one-shot DPA requests based on a hierarchical timer wheel.
+ *
+ * The wheel has four levels of 256 slots. Level 0 covers the next 256 ticks, each further
+ * level covers 256 times more and its slots are cascaded to the finer level when the time
+ * reaches them. Jobs are kept in intrusive lists inside a slab, so scheduling and cancelling
+ * a job is O(1) regardless of the number of jobs and processing a tick touches only the
+ * jobs due in it. Ticks without due or cascaded jobs are skipped, the scheduler thread
+ * sleeps until the next tick with work.
+ *
+ * Frames of the jobs due in the same tick are passed to the connector as one batch per
+ * priority. Periodic jobs keep their phase, a late tick does not shift the following runs.
+ *
+ * The scheduler is driven either by its own thread (start() and stop()) sleeping on the
+ * configured clock or by calling advance() explicitly. All methods are thread-safe.
+ */
+class PollScheduler {
+ public:
+    /// Time base of the scheduler, compatible with IClock
+    typedef std::chrono::steady_clock Clock;
+
+    /// Receiver of the batches of frames due in the same tick
+    typedef std::function<void(const std::vector<std::vector<uint8_t>> &, SendPriority)> BatchSender;
+
+    /**
+     * Constructs the poll scheduler sending the frames via the connector.
+     *
+     * The connector and the token have to outlive the scheduler.
+     *
+     * @param connector Connector to send the frames with
+     * @param token Access token of the scheduler
+     * @param config Scheduler configuration
+     * @throws std::invalid_argument if the configuration is invalid
+     */
+    PollScheduler(IConnector &connector, const AccessToken &token, const PollSchedulerConfig &config = {})
+        : PollScheduler(
+            [&connector, &token](const std::vector<std::vector<uint8_t>> &frames, const SendPriority priority) {
+                connector.sendBatch(frames, token, priority);
+            },
+            config
+        ) {}
+
+    /**
+     * Constructs the poll scheduler passing the batches to the sender.
+     * @param sender Batch sender
+     * @param config Scheduler configuration
+     * @param epoch Time of the tick 0, the current time of the clock if not set
+     * @throws std::invalid_argument if the configuration is invalid
+     */
+    explicit PollScheduler(
+        BatchSender sender,
+        const PollSchedulerConfig &config = {},
+        const std::optional<Clock::time_point> epoch = std::nullopt
+    ) : sender(std::move(sender)),
+        config(config),
+        clock(config.clock ? config.clock : SteadyClock::instance()),
+        epoch(epoch.value_or(this->clock->now())) {
+        if (config.tick.count() <= 0) {
+            throw std::invalid_argument("Poll scheduler tick has to be positive");
+        }
+        if (!(config.startJitter >= 0 && config.startJitter <= 1)) {
+            throw std::invalid_argument("Poll scheduler start jitter has to be in the range [0, 1]");
+        }
+        this->random.seed(config.seed != 0 ? config.seed : std::random_device()());
+        this->jobs.reserve(config.reservedJobs);
+        for (auto &level : this->wheel) {
+            level.fill(Nil);
+        }
+    }
+
+    PollScheduler(const PollScheduler &) = delete;
+    PollScheduler &operator=(const PollScheduler &) = delete;
+
+    /**
+     * Stops the scheduler thread.
+     */
+    ~PollScheduler() {
+        this->stop();
+    }
+
+    /**
+     * Schedules a periodic job.
+     *
+     * The first run is delayed by a random part of the period given by the start jitter.
+     *
+     * @param frame Frame sent on each run
+     * @param period Period of the job, rounded up to whole ticks
+     * @param priority Priority of the frame
+     * @return Job identifier
+     * @throws std::invalid_argument if the period is not positive
+     */
+    PollJobId schedulePeriodic(
+        std::vector<uint8_t> frame,
+        const Clock::duration period,
+        const SendPriority priority = SendPriority::Normal
+    ) {
+        if (period.count() <= 0) {
+            throw std::invalid_argument("Poll job period has to be positive");
+        }
+        std::lock_guard<std::mutex> lock(this->mutex);
+        const uint64_t periodTicks = this->toTicks(period);
+        const auto maxJitter = std::min<uint64_t>(
+            static_cast<uint64_t>(static_cast<double>(periodTicks) * this->config.startJitter),
+            periodTicks - 1
+        );
+        const uint64_t jitter = std::uniform_int_distribution<uint64_t>(0, maxJitter)(this->random);
+        return this->add(std::move(frame), jitter, periodTicks, priority);
+    }
+
+    /**
+     * Schedules a one-shot job.
+     * @param frame Frame to send
+     * @param delay Delay of the run, rounded up to whole ticks
+     * @param priority Priority of the frame
+     * @return Job identifier
+     */
+    PollJobId scheduleOnce(
+        std::vector<uint8_t> frame,
+        const Clock::duration delay,
+        const SendPriority priority = SendPriority::Normal
+    ) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->add(std::move(frame), this->toTicks(delay), 0, priority);
+    }
+
+    /**
+     * Cancels the job.
+     * @param id Job identifier
+     * @return true if the job has been cancelled, false if it does not exist (anymore)
+     */
+    bool cancel(const PollJobId id) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        const auto index = static_cast<uint32_t>(id & 0xFFFFFFFF);
+        const auto generation = static_cast<uint32_t>(id >> 32);
+        if (index >= this->jobs.size()) {
+            return false;
+        }
+        Job &job = this->jobs[index];
+        if (!job.scheduled || job.generation != generation) {
+            return false;
+        }
+        this->unlink(index);
+        this->release(index);
+        this->stats.cancelled++;
+        return true;
+    }
+
+    /**
+     * Runs all jobs due until the time and sends their frames.
+     * @param now Current time
+     * @return Number of job runs
+     */
+    std::size_t advance(const Clock::time_point now) {
+        std::vector<Batch> batches;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->collect(now, batches);
+        }
+        return this->deliver(batches);
+    }
+
+    /**
+     * Starts the scheduler thread.
+     * @throws std::logic_error if the thread is already running
+     */
+    void start() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->running) {
+            throw std::logic_error("Poll scheduler is already running");
+        }
+        this->running = true;
+        this->thread = std::thread(&PollScheduler::run, this);
+    }
+
+    /**
+     * Stops the scheduler thread, the scheduled jobs are kept.
+     */
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->running = false;
+        }
+        this->wake();
+        if (this->thread.joinable()) {
+            this->thread.join();
+        }
+    }
+
+    /**
+     * Returns the scheduler statistics.
+     * @return Scheduler statistics
+     */
+    PollSchedulerStats getStats() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->stats;
+    }
+
+ private:
+    /// Number of wheel levels
+    static constexpr std::size_t Levels = 4;
+    /// Number of bits of the slot index
+    static constexpr unsigned SlotBits = 8;
+    /// Number of slots per level
+    static constexpr std::size_t Slots = 1 << SlotBits;
+    /// Empty list marker
+    static constexpr uint32_t Nil = std::numeric_limits<uint32_t>::max();
+    /// No tick marker
+    static constexpr uint64_t NoTick = std::numeric_limits<uint64_t>::max();
+    /// Sleep of the scheduler thread without jobs, adding a job wakes it up earlier
+    static constexpr std::chrono::hours IdleSleep = std::chrono::hours(1);
+
+    /**
+     * Scheduled job, member of an intrusive doubly linked slot list.
+     */
+    struct Job {
+        /// Frame to send
+        std::vector<uint8_t> frame;
+        /// Tick of the next run
+        uint64_t expires = 0;
+        /// Period in ticks, 0 for one-shot jobs
+        uint64_t period = 0;
+        /// Priority of the frame
+        SendPriority priority = SendPriority::Normal;
+        /// Generation of the slab slot, distinguishes reused slots
+        uint32_t generation = 1;
+        /// Previous job in the slot list or in the free list
+        uint32_t prev = Nil;
+        /// Next job in the slot list or in the free list
+        uint32_t next = Nil;
+        /// Wheel level of the slot list
+        uint8_t level = 0;
+        /// Slot of the slot list
+        uint8_t slot = 0;
+        /// Job is scheduled
+        bool scheduled = false;
+    };
+
+    /**
+     * Frames due in the same tick with the same priority.
+     */
+    struct Batch {
+        /// Priority of the frames
+        SendPriority priority;
+        /// Frames to send
+        std::vector<std::vector<uint8_t>> frames;
+    };
+
+    /**
+     * Converts the duration to ticks, rounding up.
+     * @param duration Duration
+     * @return Number of ticks
+     */
+    uint64_t toTicks(const Clock::duration duration) const {
+        if (duration.count() <= 0) {
+            return 0;
+        }
+        const Clock::duration tick = this->config.tick;
+        return static_cast<uint64_t>((duration + tick - Clock::duration(1)) / tick);
+    }
+
+    /**
+     * Allocates a job and inserts it into the wheel.
+     * @param frame Frame to send
+     * @param delay Delay of the first run in ticks
+     * @param period Period in ticks, 0 for one-shot jobs
+     * @param priority Priority of the frame
+     * @return Job identifier
+     */
+    PollJobId add(std::vector<uint8_t> frame, const uint64_t delay, const uint64_t period, const SendPriority priority) {
+        uint64_t base = this->currentTick;
+        if (this->running) {
+            // The thread sleeps between the ticks with work, the current tick may lag behind
+            base = std::max(base, this->tickAt(this->clock->now()));
+        }
+        uint32_t index;
+        if (this->freeList != Nil) {
+            index = this->freeList;
+            this->freeList = this->jobs[index].next;
+        } else {
+            if (this->jobs.size() >= Nil) {
+                throw std::length_error("Too many poll jobs");
+            }
+            index = static_cast<uint32_t>(this->jobs.size());
+            this->jobs.emplace_back();
+        }
+        Job &job = this->jobs[index];
+        job.frame = std::move(frame);
+        job.expires = base + delay;
+        job.period = period;
+        job.priority = priority;
+        job.scheduled = true;
+        this->insert(index);
+        this->stats.jobs++;
+        if (job.expires < this->sleepingUntil) {
+            this->wake();
+        }
+        return (static_cast<uint64_t>(job.generation) << 32) | index;
+    }
+
+    /**
+     * Returns the job slot to the free list.
+     * @param index Job index
+     */
+    void release(const uint32_t index) {
+        Job &job = this->jobs[index];
+        job.frame = std::vector<uint8_t>();
+        job.scheduled = false;
+        // Generation 0 is skipped so no identifier is ever 0
+        if (++job.generation == 0) {
+            job.generation = 1;
+        }
+        job.prev = Nil;
+        job.next = this->freeList;
+        this->freeList = index;
+        this->stats.jobs--;
+    }
+
+    /**
+     * Inserts the job into the wheel slot given by its expiration.
+     * @param index Job index
+     */
+    void insert(const uint32_t index) {
+        Job &job = this->jobs[index];
+        const uint64_t delta = job.expires > this->currentTick ? job.expires - this->currentTick : 0;
+        std::size_t level = 0;
+        while (level + 1 < Levels && delta >= (uint64_t(1) << (SlotBits * (level + 1)))) {
+            ++level;
+        }
+        // Jobs beyond the wheel range wait in the last slot of the top level and get cascaded again
+        uint64_t expires = job.expires;
+        if (delta >= (uint64_t(1) << (SlotBits * Levels))) {
+            expires = this->currentTick + (uint64_t(1) << (SlotBits * Levels)) - 1;
+        } else if (delta == 0) {
+            expires = this->currentTick;
+        }
+        job.level = static_cast<uint8_t>(level);
+        job.slot = static_cast<uint8_t>((expires >> (SlotBits * level)) & (Slots - 1));
+        uint32_t &head = this->wheel[level][job.slot];
+        job.prev = Nil;
+        job.next = head;
+        if (head != Nil) {
+            this->jobs[head].prev = index;
+        }
+        head = index;
+    }
+
+    /**
+     * Removes the job from its slot list.
+     * @param index Job index
+     */
+    void unlink(const uint32_t index) {
+        Job &job = this->jobs[index];
+        if (job.prev != Nil) {
+            this->jobs[job.prev].next = job.next;
+        } else {
+            this->wheel[job.level][job.slot] = job.next;
+        }
+        if (job.next != Nil) {
+            this->jobs[job.next].prev = job.prev;
+        }
+        job.prev = Nil;
+        job.next = Nil;
+    }
+
+    /**
+     * Detaches the slot list from the wheel.
+     * @param level Wheel level
+     * @param slot Slot index
+     * @return Head of the detached list
+     */
+    uint32_t take(const std::size_t level, const std::size_t slot) {
+        const uint32_t head = this->wheel[level][slot];
+        this->wheel[level][slot] = Nil;
+        return head;
+    }
+
+    /**
+     * Returns the tick the time falls into.
+     * @param time Time
+     * @return Tick number
+     */
+    uint64_t tickAt(const Clock::time_point time) const {
+        if (time < this->epoch) {
+            return 0;
+        }
+        return static_cast<uint64_t>((time - this->epoch) / Clock::duration(this->config.tick));
+    }
+
+    /**
+     * Returns the start of the tick.
+     * @param tick Tick number
+     * @return Time point
+     */
+    Clock::time_point timeAt(const uint64_t tick) const {
+        return this->epoch + Clock::duration(this->config.tick) * static_cast<Clock::rep>(tick);
+    }
+
+    /**
+     * Returns the first tick from the current one which runs or cascades a job.
+     * @return Tick number or NoTick if there are no jobs
+     */
+    uint64_t nextEventTick() const {
+        if (this->stats.jobs == 0) {
+            return NoTick;
+        }
+        uint64_t next = NoTick;
+        for (std::size_t offset = 0; offset < Slots; ++offset) {
+            const uint64_t tick = this->currentTick + offset;
+            if (this->wheel[0][tick & (Slots - 1)] != Nil) {
+                next = tick;
+                break;
+            }
+        }
+        for (std::size_t level = 1; level < Levels; ++level) {
+            const unsigned shift = SlotBits * level;
+            const uint64_t span = uint64_t(1) << shift;
+            // Slots of the level are cascaded at the multiples of its span
+            uint64_t boundary = (this->currentTick + span - 1) & ~(span - 1);
+            for (std::size_t step = 0; step < Slots && boundary < next; ++step, boundary += span) {
+                if (this->wheel[level][(boundary >> shift) & (Slots - 1)] != Nil) {
+                    next = boundary;
+                    break;
+                }
+            }
+        }
+        return next;
+    }
+
+    /**
+     * Processes all ticks up to the time and collects the frames to send.
+     *
+     * Jumps straight to the ticks which run or cascade a job.
+     *
+     * @param now Current time
+     * @param batches Collected batches
+     */
+    void collect(const Clock::time_point now, std::vector<Batch> &batches) {
+        if (now < this->epoch) {
+            return;
+        }
+        const uint64_t target = this->tickAt(now);
+        while (true) {
+            const uint64_t next = this->nextEventTick();
+            if (next > target) {
+                break;
+            }
+            this->currentTick = next;
+            this->processTick(batches);
+        }
+        this->currentTick = std::max(this->currentTick, target + 1);
+    }
+
+    /**
+     * Cascades the coarser levels and runs the jobs of the current tick.
+     * @param batches Collected batches
+     */
+    void processTick(std::vector<Batch> &batches) {
+        const uint64_t tick = this->currentTick;
+        for (std::size_t level = 1; level < Levels; ++level) {
+            if ((tick & ((uint64_t(1) << (SlotBits * level)) - 1)) != 0) {
+                break;
+            }
+            uint32_t index = this->take(level, (tick >> (SlotBits * level)) & (Slots - 1));
+            while (index != Nil) {
+                const uint32_t next = this->jobs[index].next;
+                this->insert(index);
+                this->stats.cascaded++;
+                index = next;
+            }
+        }
+
+        std::array<Batch, 2> due = {Batch{SendPriority::High, {}}, Batch{SendPriority::Normal, {}}};
+        uint32_t index = this->take(0, tick & (Slots - 1));
+        while (index != Nil) {
+            Job &job = this->jobs[index];
+            const uint32_t next = job.next;
+            due[job.priority == SendPriority::High ? 0 : 1].frames.push_back(job.frame);
+            this->stats.fired++;
+            if (job.period != 0) {
+                job.expires += job.period;
+                this->insert(index);
+            } else {
+                this->release(index);
+            }
+            index = next;
+        }
+        for (auto &batch : due) {
+            if (!batch.frames.empty()) {
+                // Slot lists are LIFO, send the frames in the scheduling order
+                std::reverse(batch.frames.begin(), batch.frames.end());
+                this->stats.maxBatchSize = std::max(this->stats.maxBatchSize, batch.frames.size());
+                batches.push_back(std::move(batch));
+            }
+        }
+        this->stats.ticks++;
+        this->currentTick++;
+    }
+
+    /**
+     * Passes the batches to the sender.
+     * @param batches Batches to send
+     * @return Number of sent frames
+     */
+    std::size_t deliver(const std::vector<Batch> &batches) {
+        std::size_t frames = 0;
+        for (const auto &batch : batches) {
+            bool failed = false;
+            try {
+                this->sender(batch.frames, batch.priority);
+            } catch (const std::exception &e) {
+                failed = true;
+                IQRF_LOG(::iqrf::log::Level::Error) << "Failed to send poll batch: " << e.what();
+            }
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->stats.batches++;
+            if (failed) {
+                this->stats.failedBatches++;
+            }
+            frames += batch.frames.size();
+        }
+        return frames;
+    }
+
+    /**
+     * Wakes up the scheduler thread sleeping on the clock.
+     */
+    void wake() {
+        this->woken = true;
+        this->clock->interrupt();
+    }
+
+    /**
+     * Scheduler thread, sleeps until the next tick with work.
+     */
+    void run() {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        while (this->running) {
+            std::vector<Batch> batches;
+            this->collect(this->clock->now(), batches);
+            if (!batches.empty()) {
+                lock.unlock();
+                this->deliver(batches);
+                lock.lock();
+                continue;
+            }
+            // Adding a job due earlier or stopping wakes the thread up
+            this->sleepingUntil = this->nextEventTick();
+            this->woken = false;
+            const IClock::Duration duration = this->sleepingUntil == NoTick
+                ? IClock::Duration(IdleSleep)
+                : this->timeAt(this->sleepingUntil) - this->clock->now();
+            lock.unlock();
+            this->clock->sleepForUnless(duration, [this] { return this->woken.load(); });
+            lock.lock();
+            this->sleepingUntil = 0;
+            this->stats.wakeups++;
+        }
+    }
+
+    /// Batch sender
+    BatchSender sender;
+    /// Scheduler configuration
+    PollSchedulerConfig config;
+    /// Clock driving the scheduler thread
+    std::shared_ptr<IClock> clock;
+    /// Time of the tick 0
+    Clock::time_point epoch;
+    /// Jitter generator
+    std::mt19937_64 random;
+    /// Slab of the jobs
+    std::vector<Job> jobs;
+    /// Head of the list of free job slots
+    uint32_t freeList = Nil;
+    /// Heads of the slot lists
+    std::array<std::array<uint32_t, Slots>, Levels> wheel;
+    /// Next tick to process
+    uint64_t currentTick = 0;
+    /// Tick the scheduler thread sleeps until, 0 if it is not sleeping
+    uint64_t sleepingUntil = 0;
+    /// Scheduler statistics
+    PollSchedulerStats stats;
+    /// Guards the wheel and the statistics
+    mutable std::mutex mutex;
+    /// Wakes up the scheduler thread, checked by its sleep on the clock
+    std::atomic_bool woken = false;
+    /// Scheduler thread
+    std::thread thread;
+    /// Scheduler thread is running
+    bool running = false;
+};
+
+}  // namespace iqrf::connector
@@ -0,0 +1,199 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: PowerUp.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-18
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+
+#include "iqrf/connector/Clock.h"
+
+namespace iqrf::connector {
+
+/**
+ * TR module power-up configuration.
+ *
+ * The power-up ends as soon as the TR module is ready, the ready timeout is only the upper bound.
+ */
+struct PowerUpConfig {
+    /// Time the TR module power is off during the reset
+    std::chrono::milliseconds resetHold{300};
+    /// Longest time to wait for the TR module to become ready
+    std::chrono::milliseconds readyTimeout{500};
+    /// First interval of waiting for a frame, doubled after each interval without a frame
+    std::chrono::milliseconds probeInterval{10};
+    /// Longest interval of waiting for a frame
+    std::chrono::milliseconds maxProbeInterval{80};
+    /// Send a lightweight request after each interval without a frame
+    bool probe = true;
+};
+
+/**
+ * Signal proving the TR module is ready.
+ */
+enum class ReadySignal {
+    /// Frame sent by the TR module on its own, e.g. after the reset
+    Frame,
+    /// Frame received after a probe request
+    Probe,
+    /// TR ready GPIO is active
+    Gpio,
+    /// No signal within the ready timeout
+    Timeout
+};
+
+/**
+ * TR module power-up statistics.
+ */
+struct PowerUpStats {
+    /// Number of power-ups
+    uint64_t powerUps = 0;
+    /// Number of power-ups without a ready signal within the ready timeout
+    uint64_t timeouts = 0;
+    /// Number of sent probe requests
+    uint64_t probes = 0;
+    /// Time to ready of the last power-up
+    IClock::Duration lastTimeToReady{0};
+    /// Longest time to ready
+    IClock::Duration maxTimeToReady{0};
+    /// Total time to ready of all power-ups
+    IClock::Duration totalTimeToReady{0};
+    /// Signal which ended the last power-up
+    std::optional<ReadySignal> lastSignal;
+};
+
+/**
+ * Waits for the TR module to become ready after the power-up.
+ *
+ * The waiting is split into intervals growing exponentially from the probe interval. Each interval
+ * waits for a frame from the TR module, the TR ready GPIO is checked between the intervals and a probe
+ * request is sent after each interval without a frame. The total time of the intervals is bounded by
+ * the ready timeout.
+ *
+ * The class is not thread-safe, the owner is responsible for locking.
+ */
+class PowerUpMonitor {
+ public:
+    /// Waits at most the duration for a frame, returns true if a frame has been received
+    typedef std::function<bool(IClock::Duration)> FrameWaiter;
+    /// Sends the probe request
+    typedef std::function<void()> Prober;
+    /// Returns true if the TR ready GPIO is active
+    typedef std::function<bool()> ReadyLine;
+
+    /**
+     * Constructs the power-up monitor
+     * @param config Power-up configuration
+     * @throws std::invalid_argument if the probe interval is not positive
+     */
+    explicit PowerUpMonitor(const PowerUpConfig &config = PowerUpConfig()): config(config) {
+        if (config.probeInterval <= std::chrono::milliseconds::zero()) {
+            throw std::invalid_argument("Probe interval has to be positive");
+        }
+    }
+
+    /**
+     * Waits for the TR module to become ready
+     * @param clock Clock measuring the time to ready
+     * @param awaitFrame Waits for a frame from the TR module
+     * @param probe Sends the probe request, nothing is sent if empty or disabled by the configuration
+     * @param readyLine Reads the TR ready GPIO, not checked if empty
+     * @return Signal proving the TR module is ready or ReadySignal::Timeout
+     */
+    ReadySignal awaitReady(
+        IClock &clock,
+        const FrameWaiter &awaitFrame,
+        const Prober &probe = nullptr,
+        const ReadyLine &readyLine = nullptr
+    ) {
+        const IClock::TimePoint start = clock.now();
+        const bool probing = this->config.probe && probe;
+        IClock::Duration budget = this->config.readyTimeout;
+        IClock::Duration interval = this->config.probeInterval;
+        uint64_t probes = 0;
+        ReadySignal signal = ReadySignal::Timeout;
+        while (true) {
+            if (readyLine && readyLine()) {
+                signal = ReadySignal::Gpio;
+                break;
+            }
+            if (budget <= IClock::Duration::zero()) {
+                break;
+            }
+            const IClock::Duration slice = std::min(interval, budget);
+            if (awaitFrame(slice)) {
+                signal = probes > 0 ? ReadySignal::Probe : ReadySignal::Frame;
+                break;
+            }
+            budget -= slice;
+            interval = std::min<IClock::Duration>(interval * 2, this->config.maxProbeInterval);
+            if (probing && budget > IClock::Duration::zero()) {
+                probe();
+                probes++;
+            }
+        }
+        const IClock::Duration timeToReady = clock.now() - start;
+        this->stats.powerUps++;
+        this->stats.probes += probes;
+        this->stats.timeouts += signal == ReadySignal::Timeout;
+        this->stats.lastTimeToReady = timeToReady;
+        this->stats.maxTimeToReady = std::max(this->stats.maxTimeToReady, timeToReady);
+        this->stats.totalTimeToReady += timeToReady;
+        this->stats.lastSignal = signal;
+        return signal;
+    }
+
+    /**
+     * Returns the power-up configuration
+     * @return Power-up configuration
+     */
+    [[nodiscard]] const PowerUpConfig &getConfig() const {
+        return this->config;
+    }
+
+    /**
+     * Returns the power-up statistics
+     * @return Power-up statistics
+     */
+    [[nodiscard]] const PowerUpStats &getStats() const {
+        return this->stats;
+    }
+
+    /**
+     * Returns the name of the ready signal
+     * @param signal Ready signal
+     * @return Name of the ready signal
+     */
+    static constexpr const char *signalName(const ReadySignal signal) {
+        switch (signal) {
+            case ReadySignal::Frame:
+                return "frame";
+            case ReadySignal::Probe:
+                return "probe";
+            case ReadySignal::Gpio:
+                return "GPIO";
+            default:
+                return "timeout";
+        }
+    }
+
+ private:
+    /// Power-up configuration
+    PowerUpConfig config;
+    /// Power-up statistics
+    PowerUpStats stats;
+};
+
+}  // namespace iqrf::connector
@@ -0,0 +1,602 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: ResponseFilter.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-15
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "iqrf/connector/OutboundScheduler.h"
+#include "iqrf/connector/dpa/DpaFrame.h"
+
+namespace iqrf::connector {
+
+typedef std::function<int(const std::vector<uint8_t>&)> ResponseHandler;
+
+/// Handler receiving the messages accumulated since the last delivery, in the order of arrival
+typedef std::function<int(const std::vector<std::vector<uint8_t>>&)> BatchResponseHandler;
+
+/**
+ * Kind of the received DPA message, used as a bit mask.
+ */
+enum class MessageKind : uint8_t {
+    /// DPA confirmation
+    Confirmation = 0x01,
+    /// DPA response to a request
+    Response = 0x02,
+    /// Asynchronous DPA response
+    Asynchronous = 0x04,
+    /// Any DPA message
+    Any = 0x07
+};
+
+/**
+ * Combines message kinds.
+ * @param a Message kind
+ * @param b Message kind
+ * @return Both message kinds
+ */
+constexpr MessageKind operator|(const MessageKind a, const MessageKind b) {
+    return static_cast<MessageKind>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+}
+
+/**
+ * Declarative filter of the received messages.
+ *
+ * All conditions have to match. Conditions of the same kind (node addresses, peripherals)
+ * are alternatives. A filter without conditions matches every message including those
+ * which are not DPA messages, any condition restricts the filter to DPA messages.
+ */
+class ResponseFilter {
+ public:
+    /**
+     * Accepts messages from the node.
+     * @param address Node address
+     * @return Filter
+     */
+    ResponseFilter &nadr(const uint16_t address) {
+        return this->nadrRange(address, address);
+    }
+
+    /**
+     * Accepts messages from the nodes.
+     * @param first Lowest node address
+     * @param last Highest node address
+     * @return Filter
+     * @throws std::invalid_argument if the range is empty
+     */
+    ResponseFilter &nadrRange(const uint16_t first, const uint16_t last) {
+        if (first > last) {
+            throw std::invalid_argument("Empty node address range");
+        }
+        this->nadrRanges.emplace_back(first, last);
+        return *this;
+    }
+
+    /**
+     * Accepts messages of the peripheral.
+     * @param peripheral Peripheral number
+     * @return Filter
+     */
+    ResponseFilter &pnum(const uint8_t peripheral) {
+        this->pnums.set(peripheral);
+        this->anyPnum = false;
+        return *this;
+    }
+
+    /**
+     * Accepts messages whose peripheral command masked by the mask equals the value.
+     * @param mask Mask of PCMD bits
+     * @param value Expected value of the masked bits
+     * @return Filter
+     */
+    ResponseFilter &pcmd(const uint8_t mask, const uint8_t value) {
+        this->pcmdMask = mask;
+        this->pcmdValue = value & mask;
+        return *this;
+    }
+
+    /**
+     * Accepts messages of the kinds.
+     * @param kinds Message kinds
+     * @return Filter
+     */
+    ResponseFilter &kind(const MessageKind kinds) {
+        this->kinds = static_cast<uint8_t>(kinds);
+        return *this;
+    }
+
+    /**
+     * Accepts messages with the hardware profile ID.
+     * @param id Hardware profile ID
+     * @return Filter
+     */
+    ResponseFilter &hwpid(const uint16_t id) {
+        this->hwpidValue = id;
+        return *this;
+    }
+
+    /**
+     * Checks whether the filter has no conditions.
+     * @return true if the filter matches every message
+     */
+    [[nodiscard]] bool empty() const {
+        return this->nadrRanges.empty() && this->anyPnum && this->pcmdMask == 0 &&
+            this->kinds == static_cast<uint8_t>(MessageKind::Any) && !this->hwpidValue.has_value();
+    }
+
+ private:
+    friend class SubscriptionTable;
+
+    /// Accepted node address ranges, any address if empty
+    std::vector<std::pair<uint16_t, uint16_t>> nadrRanges;
+    /// Accepted peripherals
+    std::bitset<256> pnums;
+    /// Any peripheral is accepted
+    bool anyPnum = true;
+    /// Mask of the checked PCMD bits
+    uint8_t pcmdMask = 0;
+    /// Expected value of the checked PCMD bits
+    uint8_t pcmdValue = 0;
+    /// Accepted message kinds
+    uint8_t kinds = static_cast<uint8_t>(MessageKind::Any);
+    /// Accepted hardware profile ID
+    std::optional<uint16_t> hwpidValue;
+};
+
+/**
+ * Configuration of the batch delivery of messages.
+ */
+struct BatchDeliveryConfig {
+    /// Maximal number of messages in a batch, a full batch is delivered immediately
+    std::size_t maxBatchSize = 64;
+    /// Maximal time the first message of a batch waits for the delivery
+    std::chrono::milliseconds maxLinger{100};
+};
+
+/**
+ * Message dispatch statistics.
+ */
+struct DispatchStats {
+    /// Number of batch size histogram buckets
+    static constexpr std::size_t BATCH_SIZE_BUCKETS = 8;
+
+    /**
+     * Returns the histogram bucket of the batch size.
+     *
+     * Bucket 0 counts single messages, bucket i counts batches of 2^(i-1)+1 to 2^i messages,
+     * the last bucket counts all larger batches.
+     *
+     * @param size Number of messages in the batch
+     * @return Bucket index
+     */
+    static constexpr std::size_t batchSizeBucket(const std::size_t size) {
+        std::size_t bucket = 0;
+        while (bucket + 1 < BATCH_SIZE_BUCKETS && (std::size_t(1) << bucket) < size) {
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    /// Number of dispatched messages
+    uint64_t messages = 0;
+    /// Number of handler calls
+    uint64_t deliveries = 0;
+    /// Number of messages no handler has matched
+    uint64_t unmatched = 0;
+    /// Number of filter evaluations
+    uint64_t evaluations = 0;
+    /// Total time spent evaluating the filters
+    std::chrono::nanoseconds evaluationTime{0};
+    /// Longest filter evaluation of a single message
+    std::chrono::nanoseconds maxEvaluationTime{0};
+    /// Number of batches delivered to batch handlers
+    uint64_t batches = 0;
+    /// Histogram of the delivered batch sizes, see batchSizeBucket()
+    std::array<uint64_t, BATCH_SIZE_BUCKETS> batchSizes{};
+};
+
+/**
+ * Response handlers with filters compiled into a dispatch table.
+ *
+ * Subscriptions are indexed by PNUM, so a message is checked only against the filters
+ * accepting its peripheral. Node addresses up to 0xFF are checked in a bitmap, other
+ * conditions are single comparisons.
+ *
+ * Batch subscriptions accumulate the matching messages and receive them at once when
+ * the batch is full, when the first message has waited for the maximal linger time
+ * or when the owner flushes the table, e.g. once the link goes idle after a burst.
+ *
+ * The table itself is not thread-safe, the owner is responsible for locking.
+ */
+class SubscriptionTable {
+ public:
+    /**
+     * Adds the subscription.
+     * @param id Subscriber identifier
+     * @param handler Response handler
+     * @param filter Message filter
+     */
+    void add(const SenderId id, ResponseHandler handler, const ResponseFilter &filter) {
+        Subscription subscription = SubscriptionTable::compile(id, filter);
+        subscription.handler = std::make_shared<const ResponseHandler>(std::move(handler));
+        this->subscriptions.push_back(std::move(subscription));
+        this->rebuild();
+    }
+
+    /**
+     * Adds the subscription delivering the messages in batches.
+     * @param id Subscriber identifier
+     * @param handler Batch response handler
+     * @param filter Message filter
+     * @param config Batch delivery configuration
+     * @throws std::invalid_argument if the maximal batch size is zero
+     */
+    void addBatch(
+        const SenderId id,
+        BatchResponseHandler handler,
+        const ResponseFilter &filter,
+        const BatchDeliveryConfig &config
+    ) {
+        if (config.maxBatchSize == 0) {
+            throw std::invalid_argument("Maximal batch size has to be positive");
+        }
+        Subscription subscription = SubscriptionTable::compile(id, filter);
+        subscription.batchHandler = std::make_shared<const BatchResponseHandler>(std::move(handler));
+        subscription.batchConfig = config;
+        subscription.pending.reserve(config.maxBatchSize);
+        this->subscriptions.push_back(std::move(subscription));
+        this->rebuild();
+    }
+
+    /**
+     * Removes the subscription, the pending batch is delivered first.
+     * @param id Subscriber identifier
+     * @return true if the subscription has been removed
+     */
+    bool remove(const SenderId id) {
+        auto it = std::find_if(this->subscriptions.begin(), this->subscriptions.end(),
+            [id](const Subscription &subscription) { return subscription.id == id; });
+        if (it == this->subscriptions.end()) {
+            return false;
+        }
+        std::vector<Batch> ready;
+        SubscriptionTable::take(*it, ready);
+        this->subscriptions.erase(it);
+        this->rebuild();
+        this->deliver(ready);
+        return true;
+    }
+
+    /**
+     * Removes all subscriptions, the pending batches are delivered first.
+     */
+    void clear() {
+        std::vector<Batch> ready;
+        for (auto &subscription : this->subscriptions) {
+            SubscriptionTable::take(subscription, ready);
+        }
+        this->subscriptions.clear();
+        this->rebuild();
+        this->deliver(ready);
+    }
+
+    /**
+     * Checks whether there are no subscriptions.
+     * @return true if there are no subscriptions
+     */
+    [[nodiscard]] bool empty() const {
+        return this->subscriptions.empty();
+    }
+
+    /**
+     * Passes the message to the handlers of the matching subscriptions.
+     *
+     * Batch subscriptions only store the message, their handlers are called once the batch
+     * is full or lingers for too long.
+     *
+     * @param message Received message
+     * @param now Time of the reception, starts the linger time of a new batch
+     * @return Number of subscriptions which accepted the message
+     */
+    std::size_t dispatch(
+        const std::vector<uint8_t> &message,
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()
+    ) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto response = dpa::DpaResponseView::tryParse(message);
+        const std::vector<uint32_t> &candidates = response.has_value()
+            ? this->byPnum[response->pnum()]
+            : this->unfiltered;
+
+        std::vector<std::shared_ptr<const ResponseHandler>> matched;
+        std::vector<Batch> ready;
+        std::size_t accepted = 0;
+        matched.reserve(candidates.size());
+        for (const uint32_t index : candidates) {
+            this->stats.evaluations++;
+            Subscription &subscription = this->subscriptions[index];
+            if (response.has_value() && !SubscriptionTable::matches(subscription, *response)) {
+                continue;
+            }
+            accepted++;
+            if (!subscription.batchHandler) {
+                matched.push_back(subscription.handler);
+                continue;
+            }
+            if (subscription.pending.empty()) {
+                subscription.pendingSince = now;
+            }
+            subscription.pending.push_back(message);
+            if (subscription.pending.size() >= subscription.batchConfig.maxBatchSize) {
+                SubscriptionTable::take(subscription, ready);
+            }
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start
+        );
+        this->stats.messages++;
+        this->stats.evaluationTime += elapsed;
+        this->stats.maxEvaluationTime = std::max(this->stats.maxEvaluationTime, elapsed);
+        if (accepted == 0) {
+            this->stats.unmatched++;
+        }
+
+        for (const auto &handler : matched) {
+            this->stats.deliveries++;
+            if (*handler) {
+                (*handler)(message);
+            }
+        }
+        this->deliver(ready);
+        return accepted;
+    }
+
+    /**
+     * Delivers all pending batches.
+     * @return Number of delivered batches
+     */
+    std::size_t flush() {
+        return this->flushIf([](const Subscription &) { return true; });
+    }
+
+    /**
+     * Delivers the pending batches whose first message has waited for the maximal linger time.
+     * @param now Current time
+     * @return Number of delivered batches
+     */
+    std::size_t flushExpired(const std::chrono::steady_clock::time_point now) {
+        return this->flushIf([now](const Subscription &subscription) {
+            return now - subscription.pendingSince >= subscription.batchConfig.maxLinger;
+        });
+    }
+
+    /**
+     * Checks whether any batch waits for the delivery.
+     * @return true if there are pending messages
+     */
+    [[nodiscard]] bool hasPending() const {
+        return std::any_of(this->subscriptions.begin(), this->subscriptions.end(),
+            [](const Subscription &subscription) { return !subscription.pending.empty(); });
+    }
+
+    /**
+     * Returns the dispatch statistics.
+     * @return Dispatch statistics
+     */
+    [[nodiscard]] const DispatchStats &getStats() const {
+        return this->stats;
+    }
+
+ private:
+    /**
+     * Subscription with the compiled filter.
+     */
+    struct Subscription {
+        /// Subscriber identifier
+        SenderId id;
+        /// Response handler, shared so that a handler can unsubscribe while being called
+        std::shared_ptr<const ResponseHandler> handler;
+        /// Batch response handler, set for batch subscriptions only
+        std::shared_ptr<const BatchResponseHandler> batchHandler;
+        /// Batch delivery configuration
+        BatchDeliveryConfig batchConfig;
+        /// Messages waiting for the batch delivery
+        std::vector<std::vector<uint8_t>> pending;
+        /// Arrival of the first pending message
+        std::chrono::steady_clock::time_point pendingSince;
+        /// Filter has no conditions
+        bool matchAll;
+        /// Accepted node addresses up to 0xFF
+        std::bitset<256> nodes;
+        /// Accepted node address ranges above 0xFF
+        std::vector<std::pair<uint16_t, uint16_t>> highRanges;
+        /// Mask of the checked PCMD bits
+        uint8_t pcmdMask;
+        /// Expected value of the checked PCMD bits
+        uint8_t pcmdValue;
+        /// Accepted message kinds
+        uint8_t kinds;
+        /// Accepted hardware profile ID
+        std::optional<uint16_t> hwpid;
+        /// Any peripheral is accepted
+        bool anyPnum;
+        /// Accepted peripherals
+        std::bitset<256> pnums;
+    };
+
+    /**
+     * Batch taken from a subscription, waiting for the delivery.
+     */
+    struct Batch {
+        /// Batch response handler
+        std::shared_ptr<const BatchResponseHandler> handler;
+        /// Accumulated messages
+        std::vector<std::vector<uint8_t>> messages;
+    };
+
+    /**
+     * Compiles the filter into a subscription without a handler.
+     * @param id Subscriber identifier
+     * @param filter Message filter
+     * @return Subscription
+     */
+    static Subscription compile(const SenderId id, const ResponseFilter &filter) {
+        Subscription subscription{
+            id, nullptr, nullptr, {}, {}, {}, filter.empty(), {}, {},
+            filter.pcmdMask, filter.pcmdValue, filter.kinds, filter.hwpidValue, filter.anyPnum, filter.pnums
+        };
+        for (const auto &[first, last] : filter.nadrRanges) {
+            for (uint32_t address = first; address <= std::min<uint32_t>(last, 0xFF); ++address) {
+                subscription.nodes.set(address);
+            }
+            if (last > 0xFF) {
+                subscription.highRanges.emplace_back(std::max<uint16_t>(first, 0x100), last);
+            }
+        }
+        if (filter.nadrRanges.empty()) {
+            subscription.nodes.set();
+            subscription.highRanges.emplace_back(0x100, 0xFFFF);
+        }
+        return subscription;
+    }
+
+    /**
+     * Moves the pending messages of the subscription to the batches ready for the delivery.
+     * @param subscription Subscription
+     * @param ready Batches ready for the delivery
+     */
+    static void take(Subscription &subscription, std::vector<Batch> &ready) {
+        if (subscription.pending.empty()) {
+            return;
+        }
+        ready.push_back(Batch{subscription.batchHandler, std::move(subscription.pending)});
+        subscription.pending.clear();
+        subscription.pending.reserve(subscription.batchConfig.maxBatchSize);
+    }
+
+    /**
+     * Calls the handlers of the batches, the subscriptions may change meanwhile.
+     * @param ready Batches ready for the delivery
+     */
+    void deliver(const std::vector<Batch> &ready) {
+        for (const auto &batch : ready) {
+            this->stats.deliveries++;
+            this->stats.batches++;
+            this->stats.batchSizes[DispatchStats::batchSizeBucket(batch.messages.size())]++;
+            if (*batch.handler) {
+                (*batch.handler)(batch.messages);
+            }
+        }
+    }
+
+    /**
+     * Delivers the pending batches of the subscriptions satisfying the predicate.
+     * @param predicate Predicate of the subscription
+     * @return Number of delivered batches
+     */
+    template<typename Predicate>
+    std::size_t flushIf(const Predicate &predicate) {
+        std::vector<Batch> ready;
+        for (auto &subscription : this->subscriptions) {
+            if (!subscription.pending.empty() && predicate(subscription)) {
+                SubscriptionTable::take(subscription, ready);
+            }
+        }
+        this->deliver(ready);
+        return ready.size();
+    }
+
+    /**
+     * Evaluates the filter conditions other than PNUM.
+     * @param subscription Subscription
+     * @param response Received DPA message
+     * @return true if the message matches
+     */
+    static bool matches(const Subscription &subscription, const dpa::DpaResponseView &response) {
+        if (subscription.matchAll) {
+            return true;
+        }
+        const uint16_t nadr = response.nadr();
+        if (nadr <= 0xFF) {
+            if (!subscription.nodes.test(nadr)) {
+                return false;
+            }
+        } else if (std::none_of(subscription.highRanges.begin(), subscription.highRanges.end(),
+            [nadr](const auto &range) { return nadr >= range.first && nadr <= range.second; })) {
+            return false;
+        }
+        if ((response.pcmd() & subscription.pcmdMask) != subscription.pcmdValue) {
+            return false;
+        }
+        if ((SubscriptionTable::kindOf(response) & subscription.kinds) == 0) {
+            return false;
+        }
+        return !subscription.hwpid.has_value() || *subscription.hwpid == response.hwpid();
+    }
+
+    /**
+     * Returns the kind of the DPA message.
+     * @param response DPA message
+     * @return Message kind bit
+     */
+    static uint8_t kindOf(const dpa::DpaResponseView &response) {
+        if (response.isConfirmation()) {
+            return static_cast<uint8_t>(MessageKind::Confirmation);
+        }
+        if (response.isAsynchronous()) {
+            return static_cast<uint8_t>(MessageKind::Asynchronous);
+        }
+        return static_cast<uint8_t>(MessageKind::Response);
+    }
+
+    /**
+     * Rebuilds the PNUM jump table, keeps the registration order in each entry.
+     */
+    void rebuild() {
+        for (auto &entry : this->byPnum) {
+            entry.clear();
+        }
+        this->unfiltered.clear();
+        for (uint32_t index = 0; index < this->subscriptions.size(); ++index) {
+            const Subscription &subscription = this->subscriptions[index];
+            if (subscription.matchAll) {
+                this->unfiltered.push_back(index);
+            }
+            for (std::size_t pnum = 0; pnum < this->byPnum.size(); ++pnum) {
+                if (subscription.anyPnum || subscription.pnums.test(pnum)) {
+                    this->byPnum[pnum].push_back(index);
+                }
+            }
+        }
+    }
+
+    /// Subscriptions in the registration order
+    std::vector<Subscription> subscriptions;
+    /// Subscriptions accepting the peripheral, indexed by PNUM
+    std::array<std::vector<uint32_t>, 256> byPnum;
+    /// Subscriptions accepting messages which are not DPA messages
+    std::vector<uint32_t> unfiltered;
+    /// Dispatch statistics
+    DispatchStats stats;
+};
+
+}  // namespace iqrf::connector
@@ -0,0 +1,353 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: SendPacer.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-06
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "iqrf/connector/dpa/DpaFrame.h"
+
+namespace iqrf::connector {
+
+/**
+ * Send pacing configuration.
+ *
+ * Pacing is driven by two token buckets. The TR buffer bucket models the TR module input buffer
+ * which is filled by the link and emptied as the TR module transmits the frames at the RF bit rate.
+ * The airtime bucket models the RF duty cycle consumed by requests addressed to remote nodes.
+ */
+struct PacingConfig {
+    /// Size of the TR module input buffer in bytes
+    std::size_t trBufferSize = 64;
+    /// Link layer overhead per frame in bytes (HDLC flags and CRC)
+    std::size_t frameOverhead = 3;
+    /// RF bit rate in bit/s used for the airtime estimate
+    uint32_t rfBitRate = 19200;
+    /// RF packet overhead in bytes (preamble, synchronization, headers, CRC)
+    std::size_t rfOverhead = 20;
+    /// Allowed RF duty cycle in the range (0, 1]
+    double dutyCycle = 0.1;
+    /// RF airtime the bucket can accumulate for bursts
+    std::chrono::microseconds airtimeBurst = std::chrono::milliseconds(500);
+    /// Time to wait for the DPA confirmation of a request sent to a remote node
+    std::chrono::microseconds confirmationTimeout = std::chrono::milliseconds(1000);
+    /// Lowest rate factor reached by halving the rate on missing confirmations
+    double minRateFactor = 0.125;
+    /// Rate factor increment on each received confirmation
+    double rateFactorStep = 0.125;
+};
+
+/**
+ * Reason of a pacing delay.
+ */
+enum class PacingReason {
+    /// Frame has not been delayed
+    None,
+    /// TR module input buffer would overflow
+    TrBuffer,
+    /// RF duty cycle would be exceeded
+    Airtime
+};
+
+/**
+ * Send pacing statistics.
+ */
+struct PacingStats {
+    /// Number of frames passed through the pacer
+    uint64_t frames = 0;
+    /// Number of delayed frames
+    uint64_t delayedFrames = 0;
+    /// Number of frames delayed due to the TR module input buffer
+    uint64_t delayedByTrBuffer = 0;
+    /// Number of frames delayed due to the RF duty cycle
+    uint64_t delayedByAirtime = 0;
+    /// Sum of all delays
+    std::chrono::microseconds totalDelay{0};
+    /// Longest delay
+    std::chrono::microseconds maxDelay{0};
+    /// Delay of the last frame
+    std::chrono::microseconds lastDelay{0};
+    /// Reason of the last delay
+    PacingReason lastReason = PacingReason::None;
+    /// Estimated RF airtime of all frames
+    std::chrono::microseconds totalAirtime{0};
+    /// Number of received DPA confirmations
+    uint64_t confirmations = 0;
+    /// Number of DPA confirmations which have not arrived in time
+    uint64_t confirmationTimeouts = 0;
+    /// Current rate factor applied to both buckets
+    double rateFactor = 1.0;
+};
+
+/**
+ * Duty-cycle and TR buffer aware send pacer.
+ *
+ * The pacer computes how long a frame has to be delayed so that neither the TR module input
+ * buffer overflows nor the RF duty cycle is exceeded. Missing DPA confirmations halve the
+ * sending rate, received confirmations restore it step by step.
+ *
+ * The pacer itself is not thread-safe, the owner is responsible for locking.
+ */
+class SendPacer {
+ public:
+    /// Clock used by the pacer
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * Constructs the send pacer.
+     * @param config Pacing configuration
+     * @param now Current time
+     * @throws std::invalid_argument for invalid configuration
+     */
+    explicit SendPacer(const PacingConfig &config, const Clock::time_point now = Clock::now()):
+        config(config), lastRefill(now) {
+        if (config.rfBitRate == 0) {
+            throw std::invalid_argument("RF bit rate cannot be zero");
+        }
+        if (config.trBufferSize == 0) {
+            throw std::invalid_argument("TR buffer size cannot be zero");
+        }
+        if (config.dutyCycle <= 0 || config.dutyCycle > 1) {
+            throw std::invalid_argument("Duty cycle has to be in the range (0, 1]");
+        }
+        if (config.minRateFactor <= 0 || config.minRateFactor > 1) {
+            throw std::invalid_argument("Minimal rate factor has to be in the range (0, 1]");
+        }
+        this->bufferTokens = static_cast<double>(config.trBufferSize);
+        this->airtimeTokens = static_cast<double>(config.airtimeBurst.count());
+    }
+
+    /**
+     * Reserves the link and RF budget for the frame.
+     *
+     * The frame is accounted as if it was sent after the returned delay.
+     * @param frame Frame to be sent
+     * @param now Current time
+     * @return Delay before the frame can be sent
+     */
+    std::chrono::microseconds reserve(const std::vector<uint8_t> &frame, const Clock::time_point now) {
+        this->checkConfirmation(now);
+        this->refill(now);
+
+        const double bytes = static_cast<double>(frame.size() + this->config.frameOverhead);
+        const std::chrono::microseconds airtime = this->estimateAirtime(frame);
+
+        // Tokens may go negative, the deficit determines the delay
+        this->bufferTokens -= bytes;
+        this->airtimeTokens -= static_cast<double>(airtime.count());
+
+        double bufferDelay = 0;
+        if (this->bufferTokens < 0) {
+            bufferDelay = -this->bufferTokens / this->bufferRate();
+        }
+        double airtimeDelay = 0;
+        if (this->airtimeTokens < 0) {
+            airtimeDelay = -this->airtimeTokens / this->airtimeRate();
+        }
+
+        const auto delay = std::chrono::microseconds(
+            static_cast<int64_t>(std::max(bufferDelay, airtimeDelay) + 0.5)
+        );
+        PacingReason reason = PacingReason::None;
+        if (delay.count() > 0) {
+            reason = airtimeDelay > bufferDelay ? PacingReason::Airtime : PacingReason::TrBuffer;
+        }
+        this->record(delay, reason, airtime);
+        return delay;
+    }
+
+    /**
+     * Notifies the pacer that the frame has been written to the link.
+     * @param frame Sent frame
+     * @param now Current time
+     */
+    void onSent(const std::vector<uint8_t> &frame, const Clock::time_point now) {
+        if (SendPacer::isRemoteRequest(frame)) {
+            this->awaitingConfirmation = true;
+            this->confirmationDeadline = now + this->config.confirmationTimeout;
+        }
+    }
+
+    /**
+     * Notifies the pacer about the received frame.
+     * @param frame Received frame
+     * @param now Current time
+     */
+    void onReceived(const std::vector<uint8_t> &frame, const Clock::time_point now) {
+        this->checkConfirmation(now);
+        if (!SendPacer::isConfirmation(frame)) {
+            return;
+        }
+        this->stats.confirmations++;
+        if (this->awaitingConfirmation) {
+            this->awaitingConfirmation = false;
+            this->refill(now);
+            this->setRateFactor(this->rateFactor + this->config.rateFactorStep);
+        }
+    }
+
+    /**
+     * Estimates the RF airtime consumed by the frame.
+     *
+     * Requests addressed to the coordinator or the local device do not use RF. Unicast requests
+     * are accounted for the request and the response, broadcast requests for the request only.
+     * @param frame DPA request frame
+     * @return Estimated airtime
+     */
+    [[nodiscard]] std::chrono::microseconds estimateAirtime(const std::vector<uint8_t> &frame) const {
+        if (!SendPacer::isRemoteRequest(frame)) {
+            return std::chrono::microseconds(0);
+        }
+        const uint64_t bits = static_cast<uint64_t>(frame.size() + this->config.rfOverhead) * 8;
+        const uint64_t packets = dpa::DpaRequestView(frame).isBroadcast() ? 1 : 2;
+        return std::chrono::microseconds(packets * bits * 1000000 / this->config.rfBitRate);
+    }
+
+    /**
+     * Returns the pacing statistics.
+     * @return Pacing statistics
+     */
+    [[nodiscard]] const PacingStats &getStats() const {
+        return this->stats;
+    }
+
+ private:
+    /**
+     * Checks whether the frame is a DPA request transmitted over RF.
+     * @param frame Frame
+     * @return true if the frame is a request addressed to a remote node
+     */
+    static bool isRemoteRequest(const std::vector<uint8_t> &frame) {
+        const auto request = dpa::DpaRequestView::tryParse(frame);
+        return request.has_value() && request->isRemote();
+    }
+
+    /**
+     * Checks whether the frame is a DPA confirmation.
+     * @param frame Frame
+     * @return true if the frame is a DPA confirmation
+     */
+    static bool isConfirmation(const std::vector<uint8_t> &frame) {
+        const auto response = dpa::DpaResponseView::tryParse(frame);
+        return response.has_value() && response->isConfirmation();
+    }
+
+    /**
+     * TR buffer bucket refill rate.
+     *
+     * The link is faster than RF, so the buffer is emptied at the pace the TR module transmits.
+     * @return Bytes per microsecond
+     */
+    [[nodiscard]] double bufferRate() const {
+        return static_cast<double>(this->config.rfBitRate) / 8 / 1e6 * this->rateFactor;
+    }
+
+    /**
+     * Airtime bucket refill rate.
+     * @return Airtime microseconds per microsecond
+     */
+    [[nodiscard]] double airtimeRate() const {
+        return this->config.dutyCycle * this->rateFactor;
+    }
+
+    /**
+     * Refills both buckets up to the current time.
+     * @param now Current time
+     */
+    void refill(const Clock::time_point now) {
+        if (now <= this->lastRefill) {
+            return;
+        }
+        const auto elapsed = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - this->lastRefill).count()
+        );
+        this->lastRefill = now;
+        this->bufferTokens = std::min(
+            this->bufferTokens + elapsed * this->bufferRate(),
+            static_cast<double>(this->config.trBufferSize)
+        );
+        this->airtimeTokens = std::min(
+            this->airtimeTokens + elapsed * this->airtimeRate(),
+            static_cast<double>(this->config.airtimeBurst.count())
+        );
+    }
+
+    /**
+     * Slows down the pacing if the pending confirmation has not arrived in time.
+     * @param now Current time
+     */
+    void checkConfirmation(const Clock::time_point now) {
+        if (!this->awaitingConfirmation || now < this->confirmationDeadline) {
+            return;
+        }
+        this->awaitingConfirmation = false;
+        this->stats.confirmationTimeouts++;
+        this->refill(now);
+        this->setRateFactor(this->rateFactor / 2);
+    }
+
+    /**
+     * Sets the rate factor limited to [minRateFactor, 1].
+     * @param factor New rate factor
+     */
+    void setRateFactor(const double factor) {
+        this->rateFactor = std::clamp(factor, this->config.minRateFactor, 1.0);
+        this->stats.rateFactor = this->rateFactor;
+    }
+
+    /**
+     * Records the pacing decision in statistics.
+     * @param delay Delay of the frame
+     * @param reason Reason of the delay
+     * @param airtime Estimated airtime of the frame
+     */
+    void record(const std::chrono::microseconds delay, const PacingReason reason, const std::chrono::microseconds airtime) {
+        this->stats.frames++;
+        this->stats.lastDelay = delay;
+        this->stats.lastReason = reason;
+        this->stats.totalAirtime += airtime;
+        if (reason == PacingReason::None) {
+            return;
+        }
+        this->stats.delayedFrames++;
+        if (reason == PacingReason::TrBuffer) {
+            this->stats.delayedByTrBuffer++;
+        } else {
+            this->stats.delayedByAirtime++;
+        }
+        this->stats.totalDelay += delay;
+        this->stats.maxDelay = std::max(this->stats.maxDelay, delay);
+    }
+
+    /// Pacing configuration
+    PacingConfig config;
+    /// Free space in the TR module input buffer in bytes
+    double bufferTokens;
+    /// Available RF airtime in microseconds
+    double airtimeTokens;
+    /// Time of the last bucket refill
+    Clock::time_point lastRefill;
+    /// Rate factor applied to both buckets
+    double rateFactor = 1.0;
+    /// A confirmation of the last remote request is expected
+    bool awaitingConfirmation = false;
+    /// Deadline of the expected confirmation
+    Clock::time_point confirmationDeadline;
+    /// Pacing statistics
+    PacingStats stats;
+};
+
+}  // namespace iqrf::connector
@@ -0,0 +1,200 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: DpaBuilder.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-13
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "iqrf/connector/dpa/DpaFrame.h"
+
+namespace iqrf::connector::dpa {
+
+/**
+ * Builder of DPA requests with the peripheral, command and data length fixed at compile time.
+ *
+ * Requests are serialized into fixed-size buffers, building a request with constant arguments
+ * is a constant expression.
+ *
+ * @tparam Pnum Peripheral number
+ * @tparam Pcmd Peripheral command
+ * @tparam DataSize Length of PDATA
+ */
+template<uint8_t Pnum, uint8_t Pcmd, std::size_t DataSize = 0>
+class DpaRequestBuilder {
+ public:
+    static_assert((Pcmd & RESPONSE_FLAG) == 0, "Request command cannot have the response flag");
+    static_assert(DataSize <= MAX_PDATA_SIZE, "Request data are too long");
+
+    /// Length of the serialized request
+    static constexpr std::size_t SIZE = REQUEST_HEADER_SIZE + DataSize;
+
+    /// Buffer holding the serialized request
+    typedef std::array<uint8_t, SIZE> Buffer;
+
+    /// Request data
+    typedef std::array<uint8_t, DataSize> Data;
+
+    /**
+     * Serializes the request into a new buffer.
+     * @param nadr Node address
+     * @param pdata Request data
+     * @param hwpid Hardware profile ID
+     * @return Serialized request
+     */
+    static constexpr Buffer build(const uint16_t nadr, const Data &pdata = {}, const uint16_t hwpid = HWPID_ANY) {
+        Buffer buffer{};
+        buffer[NADR_OFFSET] = static_cast<uint8_t>(nadr & 0xFF);
+        buffer[NADR_OFFSET + 1] = static_cast<uint8_t>(nadr >> 8);
+        buffer[PNUM_OFFSET] = Pnum;
+        buffer[PCMD_OFFSET] = Pcmd;
+        buffer[HWPID_OFFSET] = static_cast<uint8_t>(hwpid & 0xFF);
+        buffer[HWPID_OFFSET + 1] = static_cast<uint8_t>(hwpid >> 8);
+        for (std::size_t i = 0; i < DataSize; ++i) {
+            buffer[REQUEST_PDATA_OFFSET + i] = pdata[i];
+        }
+        return buffer;
+    }
+
+    /**
+     * Serializes the request into the caller's buffer.
+     * @param out Output buffer
+     * @param capacity Size of the output buffer
+     * @param nadr Node address
+     * @param pdata Request data
+     * @param hwpid Hardware profile ID
+     * @return Length of the serialized request
+     * @throws std::length_error if the output buffer is too small
+     */
+    static std::size_t serialize(
+        uint8_t *out,
+        const std::size_t capacity,
+        const uint16_t nadr,
+        const Data &pdata = {},
+        const uint16_t hwpid = HWPID_ANY
+    ) {
+        if (capacity < SIZE) {
+            throw std::length_error("Buffer is too small for the DPA request");
+        }
+        const Buffer buffer = DpaRequestBuilder::build(nadr, pdata, hwpid);
+        for (std::size_t i = 0; i < SIZE; ++i) {
+            out[i] = buffer[i];
+        }
+        return SIZE;
+    }
+
+    /**
+     * Serializes the request into a vector accepted by the connectors.
+     * @param nadr Node address
+     * @param pdata Request data
+     * @param hwpid Hardware profile ID
+     * @return Serialized request
+     */
+    static std::vector<uint8_t> toVector(const uint16_t nadr, const Data &pdata = {}, const uint16_t hwpid = HWPID_ANY) {
+        const Buffer buffer = DpaRequestBuilder::build(nadr, pdata, hwpid);
+        return std::vector<uint8_t>(buffer.begin(), buffer.end());
+    }
+};
+
+/// Switches the red LED off
+typedef DpaRequestBuilder<pnum::LEDR, pcmd::LED_SET_OFF> LedrSetOff;
+/// Switches the red LED on
+typedef DpaRequestBuilder<pnum::LEDR, pcmd::LED_SET_ON> LedrSetOn;
+/// Pulses the red LED
+typedef DpaRequestBuilder<pnum::LEDR, pcmd::LED_PULSE> LedrPulse;
+/// Switches the green LED off
+typedef DpaRequestBuilder<pnum::LEDG, pcmd::LED_SET_OFF> LedgSetOff;
+/// Switches the green LED on
+typedef DpaRequestBuilder<pnum::LEDG, pcmd::LED_SET_ON> LedgSetOn;
+/// Pulses the green LED
+typedef DpaRequestBuilder<pnum::LEDG, pcmd::LED_PULSE> LedgPulse;
+/// Reads the OS information
+typedef DpaRequestBuilder<pnum::OS, pcmd::OS_READ> OsRead;
+/// Resets the device
+typedef DpaRequestBuilder<pnum::OS, pcmd::OS_RESET> OsReset;
+/// Reads the temperature
+typedef DpaRequestBuilder<pnum::THERMOMETER, pcmd::THERMOMETER_READ> ThermometerRead;
+/// Sets IO pins, N port, mask and value triplets
+template<std::size_t N>
+using IoSet = DpaRequestBuilder<pnum::IO, pcmd::IO_SET, 3 * N>;
+/// Sets IO direction, N port, mask and direction triplets
+template<std::size_t N>
+using IoDirection = DpaRequestBuilder<pnum::IO, pcmd::IO_DIRECTION, 3 * N>;
+
+/**
+ * Builder of the OS Batch request into a fixed buffer.
+ *
+ * @tparam Capacity Maximal length of the batch PDATA including the terminating zero
+ */
+template<std::size_t Capacity = MAX_PDATA_SIZE>
+class OsBatchBuilder {
+ public:
+    static_assert(Capacity <= MAX_PDATA_SIZE, "Batch data are too long");
+
+    /**
+     * Starts the OS Batch request for the node.
+     * @param nadr Node address
+     * @param hwpid Hardware profile ID
+     */
+    explicit OsBatchBuilder(const uint16_t nadr, const uint16_t hwpid = HWPID_ANY) {
+        const auto header = DpaRequestBuilder<pnum::OS, pcmd::OS_BATCH>::build(nadr, {}, hwpid);
+        for (std::size_t i = 0; i < header.size(); ++i) {
+            this->buffer[i] = header[i];
+        }
+        this->length = REQUEST_HEADER_SIZE;
+        this->buffer[this->length] = 0;
+    }
+
+    /**
+     * Appends the request to the batch, its node address is ignored.
+     * @param request DPA request
+     * @return true if the request has been appended, false if it does not fit
+     */
+    bool add(const DpaRequestView &request) {
+        const std::size_t entrySize = request.bytes().size() - PNUM_OFFSET + 1;
+        // Keep space for the terminating zero
+        if (this->length + entrySize + 1 > this->buffer.size()) {
+            return false;
+        }
+        this->buffer[this->length++] = static_cast<uint8_t>(entrySize);
+        for (std::size_t i = PNUM_OFFSET; i < request.bytes().size(); ++i) {
+            this->buffer[this->length++] = request.bytes()[i];
+        }
+        this->buffer[this->length] = 0;
+        this->entries++;
+        return true;
+    }
+
+    /**
+     * Returns the number of embedded requests.
+     * @return Number of embedded requests
+     */
+    [[nodiscard]] std::size_t size() const { return this->entries; }
+
+    /**
+     * Returns the serialized request including the terminating zero.
+     * @return View of the request, valid until the builder is modified or destroyed
+     */
+    [[nodiscard]] ByteView bytes() const { return ByteView(this->buffer.data(), this->length + 1); }
+
+ private:
+    /// Serialized request
+    std::array<uint8_t, REQUEST_HEADER_SIZE + Capacity> buffer{};
+    /// Length of the serialized request without the terminating zero
+    std::size_t length = 0;
+    /// Number of embedded requests
+    std::size_t entries = 0;
+};
+
+}  // namespace iqrf::connector::dpa
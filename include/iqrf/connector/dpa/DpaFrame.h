@@ -0,0 +1,466 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: DpaFrame.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-13
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace iqrf::connector::dpa {
+
+/// Offset of the node address (NADR, little endian)
+constexpr std::size_t NADR_OFFSET = 0;
+/// Offset of the peripheral number (PNUM)
+constexpr std::size_t PNUM_OFFSET = 2;
+/// Offset of the peripheral command (PCMD)
+constexpr std::size_t PCMD_OFFSET = 3;
+/// Offset of the hardware profile ID (HWPID, little endian)
+constexpr std::size_t HWPID_OFFSET = 4;
+/// Offset of the request data (PDATA)
+constexpr std::size_t REQUEST_PDATA_OFFSET = 6;
+/// Length of the request header (NADR, PNUM, PCMD, HWPID)
+constexpr std::size_t REQUEST_HEADER_SIZE = 6;
+/// Offset of the response code
+constexpr std::size_t RESPONSE_CODE_OFFSET = 6;
+/// Offset of the DPA value
+constexpr std::size_t DPA_VALUE_OFFSET = 7;
+/// Offset of the response data (PDATA)
+constexpr std::size_t RESPONSE_PDATA_OFFSET = 8;
+/// Length of the response header (request header, ResponseCode, DpaValue)
+constexpr std::size_t RESPONSE_HEADER_SIZE = 8;
+/// Length of the confirmation (response header, Hops, Timeslot, HopsResponse)
+constexpr std::size_t CONFIRMATION_SIZE = 11;
+/// Maximal length of PDATA
+constexpr std::size_t MAX_PDATA_SIZE = 56;
+
+/// Flag of the response command in PCMD
+constexpr uint8_t RESPONSE_FLAG = 0x80;
+/// Flag of the asynchronous response in the response code
+constexpr uint8_t ASYNC_RESPONSE_FLAG = 0x80;
+
+/// Coordinator address
+constexpr uint16_t COORDINATOR_ADDRESS = 0x0000;
+/// Highest address of a node in the network
+constexpr uint16_t MAX_NODE_ADDRESS = 0x00EF;
+/// Local device address
+constexpr uint16_t LOCAL_ADDRESS = 0x00FC;
+/// Broadcast address
+constexpr uint16_t BROADCAST_ADDRESS = 0x00FF;
+/// Any hardware profile ID
+constexpr uint16_t HWPID_ANY = 0xFFFF;
+
+/**
+ * Standard peripheral numbers.
+ */
+namespace pnum {
+constexpr uint8_t COORDINATOR = 0x00;
+constexpr uint8_t NODE = 0x01;
+constexpr uint8_t OS = 0x02;
+constexpr uint8_t EEPROM = 0x03;
+constexpr uint8_t EEEPROM = 0x04;
+constexpr uint8_t RAM = 0x05;
+constexpr uint8_t LEDR = 0x06;
+constexpr uint8_t LEDG = 0x07;
+constexpr uint8_t IO = 0x09;
+constexpr uint8_t THERMOMETER = 0x0A;
+constexpr uint8_t UART = 0x0C;
+constexpr uint8_t FRC = 0x0D;
+constexpr uint8_t EXPLORATION = 0xFF;
+}  // namespace pnum
+
+/**
+ * Standard peripheral commands.
+ */
+namespace pcmd {
+constexpr uint8_t COORDINATOR_ADDR_INFO = 0x00;
+constexpr uint8_t COORDINATOR_DISCOVERED_DEVICES = 0x01;
+constexpr uint8_t COORDINATOR_BONDED_DEVICES = 0x02;
+constexpr uint8_t OS_READ = 0x00;
+constexpr uint8_t OS_RESET = 0x01;
+constexpr uint8_t OS_BATCH = 0x05;
+constexpr uint8_t MEMORY_READ = 0x00;
+constexpr uint8_t MEMORY_WRITE = 0x01;
+constexpr uint8_t LED_SET_OFF = 0x00;
+constexpr uint8_t LED_SET_ON = 0x01;
+constexpr uint8_t LED_PULSE = 0x03;
+constexpr uint8_t LED_FLASHING = 0x04;
+constexpr uint8_t IO_DIRECTION = 0x00;
+constexpr uint8_t IO_SET = 0x01;
+constexpr uint8_t IO_GET = 0x02;
+constexpr uint8_t THERMOMETER_READ = 0x00;
+constexpr uint8_t FRC_SEND = 0x00;
+}  // namespace pcmd
+
+/**
+ * Standard FRC commands, 2-bit commands are below 0x80, 1-byte commands below 0xE0.
+ */
+namespace frc {
+constexpr uint8_t PING = 0x00;
+constexpr uint8_t TEMPERATURE = 0x80;
+constexpr uint8_t FIRST_BYTE_COMMAND = 0x80;
+constexpr uint8_t FIRST_TWO_BYTE_COMMAND = 0xE0;
+}  // namespace frc
+
+/**
+ * DPA response codes.
+ */
+enum class ResponseCode : uint8_t {
+    NoError = 0x00,
+    ErrorFail = 0x01,
+    ErrorPcmd = 0x02,
+    ErrorPnum = 0x03,
+    ErrorAddress = 0x04,
+    ErrorDataLength = 0x05,
+    ErrorData = 0x06,
+    ErrorHwpid = 0x07,
+    ErrorNadr = 0x08,
+    ErrorInterfaceConfirmation = 0x09,
+    ErrorNotImplemented = 0x0A,
+    ErrorMissingCustomDpaHandler = 0x0B,
+    ErrorUser = 0x20,
+    StatusConfirmation = 0xFF
+};
+
+/**
+ * Non-owning view of a byte sequence.
+ */
+class ByteView {
+ public:
+    /**
+     * Constructs an empty view.
+     */
+    constexpr ByteView() = default;
+
+    /**
+     * Constructs a view of the bytes.
+     * @param data Pointer to the first byte
+     * @param size Number of bytes
+     */
+    constexpr ByteView(const uint8_t *data, const std::size_t size): bytes(data), length(size) {}
+
+    /**
+     * Constructs a view of the vector, the vector has to outlive the view.
+     * @param data Viewed vector
+     */
+    ByteView(const std::vector<uint8_t> &data): bytes(data.data()), length(data.size()) {}  // NOLINT(runtime/explicit)
+
+    /**
+     * Returns the pointer to the first byte.
+     * @return Pointer to the first byte
+     */
+    [[nodiscard]] constexpr const uint8_t *data() const { return this->bytes; }
+
+    /**
+     * Returns the number of bytes.
+     * @return Number of bytes
+     */
+    [[nodiscard]] constexpr std::size_t size() const { return this->length; }
+
+    /**
+     * Checks whether the view is empty.
+     * @return true if the view has no bytes
+     */
+    [[nodiscard]] constexpr bool empty() const { return this->length == 0; }
+
+    [[nodiscard]] constexpr const uint8_t *begin() const { return this->bytes; }
+
+    [[nodiscard]] constexpr const uint8_t *end() const { return this->bytes + this->length; }
+
+    /**
+     * Returns the byte without bounds checking.
+     * @param index Byte index
+     * @return Byte
+     */
+    constexpr uint8_t operator[](const std::size_t index) const { return this->bytes[index]; }
+
+    /**
+     * Returns the byte.
+     * @param index Byte index
+     * @return Byte
+     * @throws std::out_of_range if the index is out of the view
+     */
+    [[nodiscard]] uint8_t at(const std::size_t index) const {
+        if (index >= this->length) {
+            throw std::out_of_range("Byte index out of range");
+        }
+        return this->bytes[index];
+    }
+
+    /**
+     * Returns the part of the view.
+     * @param offset Offset of the part
+     * @param count Maximal number of bytes
+     * @return Part of the view, empty if the offset is out of the view
+     */
+    [[nodiscard]] constexpr ByteView subview(const std::size_t offset, const std::size_t count = SIZE_MAX) const {
+        if (offset >= this->length) {
+            return ByteView(this->bytes + this->length, 0);
+        }
+        const std::size_t available = this->length - offset;
+        return ByteView(this->bytes + offset, count < available ? count : available);
+    }
+
+    /**
+     * Copies the bytes into a vector.
+     * @return Copy of the bytes
+     */
+    [[nodiscard]] std::vector<uint8_t> toVector() const {
+        return std::vector<uint8_t>(this->begin(), this->end());
+    }
+
+ private:
+    /// Pointer to the first byte
+    const uint8_t *bytes = nullptr;
+    /// Number of bytes
+    std::size_t length = 0;
+};
+
+/**
+ * Reads a 16-bit little endian value.
+ * @param frame Frame
+ * @param offset Offset of the value
+ * @return Value
+ */
+constexpr uint16_t readUint16(const ByteView frame, const std::size_t offset) {
+    return static_cast<uint16_t>(frame[offset] | (frame[offset + 1] << 8));
+}
+
+/**
+ * Non-owning view of a DPA request.
+ *
+ * Construction only checks the length of the header, accessors do not copy.
+ */
+class DpaRequestView {
+ public:
+    /**
+     * Constructs the view of the DPA request.
+     * @param frame DPA request, has to outlive the view
+     * @throws std::invalid_argument if the frame is shorter than the request header
+     */
+    explicit DpaRequestView(const ByteView frame): frame(frame) {
+        if (!DpaRequestView::isValid(frame)) {
+            throw std::invalid_argument("DPA request is too short");
+        }
+    }
+
+    /**
+     * Creates the view if the frame is a DPA request.
+     * @param frame Frame
+     * @return View or std::nullopt if the frame is too short or it is a response
+     */
+    static std::optional<DpaRequestView> tryParse(const ByteView frame) {
+        if (!DpaRequestView::isValid(frame) || (frame[PCMD_OFFSET] & RESPONSE_FLAG) != 0) {
+            return std::nullopt;
+        }
+        return DpaRequestView(frame, Unchecked{});
+    }
+
+    /**
+     * Checks whether the frame is long enough to be a DPA request.
+     * @param frame Frame
+     * @return true if the frame contains the request header
+     */
+    static constexpr bool isValid(const ByteView frame) {
+        return frame.size() >= REQUEST_HEADER_SIZE && frame.size() <= REQUEST_HEADER_SIZE + MAX_PDATA_SIZE;
+    }
+
+    [[nodiscard]] uint16_t nadr() const { return readUint16(this->frame, NADR_OFFSET); }
+
+    [[nodiscard]] uint8_t pnum() const { return this->frame[PNUM_OFFSET]; }
+
+    [[nodiscard]] uint8_t pcmd() const { return this->frame[PCMD_OFFSET]; }
+
+    [[nodiscard]] uint16_t hwpid() const { return readUint16(this->frame, HWPID_OFFSET); }
+
+    /**
+     * Returns the request data.
+     * @return View of PDATA
+     */
+    [[nodiscard]] ByteView pdata() const { return this->frame.subview(REQUEST_PDATA_OFFSET); }
+
+    /**
+     * Checks whether the request is transmitted over RF.
+     * @return true if the request is not addressed to the coordinator or the local device
+     */
+    [[nodiscard]] bool isRemote() const {
+        return this->nadr() != COORDINATOR_ADDRESS && this->nadr() != LOCAL_ADDRESS;
+    }
+
+    [[nodiscard]] bool isBroadcast() const { return this->nadr() == BROADCAST_ADDRESS; }
+
+    /**
+     * Returns the whole frame.
+     * @return View of the frame
+     */
+    [[nodiscard]] ByteView bytes() const { return this->frame; }
+
+ private:
+    /// Tag of the constructor without validation
+    struct Unchecked {};
+
+    /**
+     * Constructs the view of an already validated frame.
+     * @param frame DPA request
+     */
+    DpaRequestView(const ByteView frame, Unchecked): frame(frame) {}
+
+    /// Viewed frame
+    ByteView frame;
+};
+
+/**
+ * Non-owning view of a DPA response, an asynchronous response or a confirmation.
+ *
+ * Construction only checks the length of the header, accessors do not copy.
+ */
+class DpaResponseView {
+ public:
+    /**
+     * Constructs the view of the DPA response.
+     * @param frame DPA response, has to outlive the view
+     * @throws std::invalid_argument if the frame is shorter than the response header
+     */
+    explicit DpaResponseView(const ByteView frame): frame(frame) {
+        if (!DpaResponseView::isValid(frame)) {
+            throw std::invalid_argument("DPA response is too short");
+        }
+    }
+
+    /**
+     * Creates the view if the frame is a DPA response or a confirmation.
+     * @param frame Frame
+     * @return View or std::nullopt if the frame is too short or it is a request
+     */
+    static std::optional<DpaResponseView> tryParse(const ByteView frame) {
+        if (!DpaResponseView::isValid(frame)) {
+            return std::nullopt;
+        }
+        DpaResponseView view(frame, Unchecked{});
+        if (!view.isConfirmation() && !view.isResponse()) {
+            return std::nullopt;
+        }
+        if (view.isConfirmation() && frame.size() != CONFIRMATION_SIZE) {
+            return std::nullopt;
+        }
+        return view;
+    }
+
+    /**
+     * Checks whether the frame is long enough to be a DPA response.
+     * @param frame Frame
+     * @return true if the frame contains the response header
+     */
+    static constexpr bool isValid(const ByteView frame) {
+        return frame.size() >= RESPONSE_HEADER_SIZE && frame.size() <= RESPONSE_HEADER_SIZE + MAX_PDATA_SIZE;
+    }
+
+    [[nodiscard]] uint16_t nadr() const { return readUint16(this->frame, NADR_OFFSET); }
+
+    [[nodiscard]] uint8_t pnum() const { return this->frame[PNUM_OFFSET]; }
+
+    /**
+     * Returns the peripheral command.
+     * @return PCMD including the response flag
+     */
+    [[nodiscard]] uint8_t pcmd() const { return this->frame[PCMD_OFFSET]; }
+
+    /**
+     * Returns the peripheral command of the request.
+     * @return PCMD without the response flag
+     */
+    [[nodiscard]] uint8_t requestPcmd() const { return this->pcmd() & static_cast<uint8_t>(~RESPONSE_FLAG); }
+
+    [[nodiscard]] uint16_t hwpid() const { return readUint16(this->frame, HWPID_OFFSET); }
+
+    /**
+     * Returns the raw response code including the asynchronous flag.
+     * @return Response code byte
+     */
+    [[nodiscard]] uint8_t rawResponseCode() const { return this->frame[RESPONSE_CODE_OFFSET]; }
+
+    /**
+     * Returns the response code.
+     * @return Response code without the asynchronous flag
+     */
+    [[nodiscard]] ResponseCode responseCode() const {
+        if (this->isConfirmation()) {
+            return ResponseCode::StatusConfirmation;
+        }
+        return static_cast<ResponseCode>(this->rawResponseCode() & static_cast<uint8_t>(~ASYNC_RESPONSE_FLAG));
+    }
+
+    [[nodiscard]] uint8_t dpaValue() const { return this->frame[DPA_VALUE_OFFSET]; }
+
+    /**
+     * Returns the response data.
+     * @return View of PDATA, empty for confirmations
+     */
+    [[nodiscard]] ByteView pdata() const {
+        if (this->isConfirmation()) {
+            return ByteView();
+        }
+        return this->frame.subview(RESPONSE_PDATA_OFFSET);
+    }
+
+    [[nodiscard]] bool isConfirmation() const {
+        return this->rawResponseCode() == static_cast<uint8_t>(ResponseCode::StatusConfirmation);
+    }
+
+    [[nodiscard]] bool isResponse() const { return (this->pcmd() & RESPONSE_FLAG) != 0; }
+
+    [[nodiscard]] bool isAsynchronous() const {
+        return this->isResponse() && !this->isConfirmation() && (this->rawResponseCode() & ASYNC_RESPONSE_FLAG) != 0;
+    }
+
+    [[nodiscard]] bool isSuccess() const { return this->responseCode() == ResponseCode::NoError; }
+
+    /**
+     * Returns the number of hops used to deliver the request, valid for confirmations only.
+     * @return Number of hops
+     */
+    [[nodiscard]] uint8_t hops() const { return this->frame.at(RESPONSE_HEADER_SIZE); }
+
+    /**
+     * Returns the timeslot length in 10 ms units, valid for confirmations only.
+     * @return Timeslot length
+     */
+    [[nodiscard]] uint8_t timeslot() const { return this->frame.at(RESPONSE_HEADER_SIZE + 1); }
+
+    /**
+     * Returns the number of hops used to deliver the response, valid for confirmations only.
+     * @return Number of hops
+     */
+    [[nodiscard]] uint8_t hopsResponse() const { return this->frame.at(RESPONSE_HEADER_SIZE + 2); }
+
+    /**
+     * Returns the whole frame.
+     * @return View of the frame
+     */
+    [[nodiscard]] ByteView bytes() const { return this->frame; }
+
+ private:
+    /// Tag of the constructor without validation
+    struct Unchecked {};
+
+    /**
+     * Constructs the view of an already validated frame.
+     * @param frame DPA response
+     */
+    DpaResponseView(const ByteView frame, Unchecked): frame(frame) {}
+
+    /// Viewed frame
+    ByteView frame;
+};
+
+}  // namespace iqrf::connector::dpa
@@ -0,0 +1,232 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: DpaPayload.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-13
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+
+#include "iqrf/connector/dpa/DpaFrame.h"
+
+namespace iqrf::connector::dpa {
+
+/**
+ * Request embedded in the OS Batch request.
+ */
+struct BatchEntry {
+    /// Peripheral number
+    uint8_t pnum;
+    /// Peripheral command
+    uint8_t pcmd;
+    /// Hardware profile ID
+    uint16_t hwpid;
+    /// Request data
+    ByteView pdata;
+};
+
+/**
+ * Non-owning view of the OS Batch request data.
+ *
+ * Each embedded request consists of its length (including the length byte), PNUM, PCMD,
+ * HWPID and PDATA. The list is terminated by a zero length.
+ */
+class OsBatchView {
+ public:
+    /**
+     * Forward iterator over the embedded requests.
+     */
+    class Iterator {
+     public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef BatchEntry value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const BatchEntry *pointer;
+        typedef const BatchEntry &reference;
+
+        /**
+         * Constructs the iterator at the offset of the batch data.
+         * @param data Batch data
+         * @param offset Offset of the embedded request
+         */
+        Iterator(const ByteView data, const std::size_t offset): data(data), offset(offset) {
+            this->load();
+        }
+
+        reference operator*() const { return this->entry; }
+
+        pointer operator->() const { return &this->entry; }
+
+        Iterator &operator++() {
+            this->offset += this->data[this->offset];
+            this->load();
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const { return this->offset == other.offset; }
+
+        bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+     private:
+        /**
+         * Decodes the embedded request at the current offset.
+         */
+        void load() {
+            if (this->offset >= this->data.size() || this->data[this->offset] == 0) {
+                this->offset = this->data.size();
+                return;
+            }
+            const ByteView request = this->data.subview(this->offset, this->data[this->offset]);
+            this->entry = BatchEntry{request[1], request[2], readUint16(request, 3), request.subview(ENTRY_HEADER_SIZE)};
+        }
+
+        /// Batch data
+        ByteView data;
+        /// Offset of the current embedded request
+        std::size_t offset;
+        /// Current embedded request
+        BatchEntry entry{};
+    };
+
+    /**
+     * Constructs the view of the OS Batch request.
+     * @param request DPA request
+     * @throws std::invalid_argument if the request is not a well-formed OS Batch request
+     */
+    explicit OsBatchView(const DpaRequestView &request): data(request.pdata()) {
+        if (request.pnum() != pnum::OS || request.pcmd() != pcmd::OS_BATCH) {
+            throw std::invalid_argument("DPA request is not OS Batch");
+        }
+        std::size_t offset = 0;
+        while (offset < this->data.size() && this->data[offset] != 0) {
+            const uint8_t length = this->data[offset];
+            if (length < ENTRY_HEADER_SIZE || offset + length > this->data.size()) {
+                throw std::invalid_argument("Malformed OS Batch request");
+            }
+            offset += length;
+            this->count++;
+        }
+    }
+
+    Iterator begin() const { return Iterator(this->data, 0); }
+
+    Iterator end() const { return Iterator(this->data, this->data.size()); }
+
+    /**
+     * Returns the number of embedded requests.
+     * @return Number of embedded requests
+     */
+    [[nodiscard]] std::size_t size() const { return this->count; }
+
+    /// Length of the embedded request header (length, PNUM, PCMD, HWPID)
+    static constexpr std::size_t ENTRY_HEADER_SIZE = 5;
+
+ private:
+    /// Batch data
+    ByteView data;
+    /// Number of embedded requests
+    std::size_t count = 0;
+};
+
+/**
+ * Port, mask and value of the IO Direction and IO Set requests.
+ */
+struct IoTriplet {
+    /// Port number
+    uint8_t port;
+    /// Mask of the affected pins
+    uint8_t mask;
+    /// Direction or value of the pins
+    uint8_t value;
+};
+
+/**
+ * Non-owning view of the IO Direction and IO Set request data.
+ */
+class IoTripletsView {
+ public:
+    /**
+     * Constructs the view of the IO request.
+     * @param request DPA request
+     * @throws std::invalid_argument if the request is not IO Direction or IO Set with whole triplets
+     */
+    explicit IoTripletsView(const DpaRequestView &request): data(request.pdata()) {
+        if (request.pnum() != pnum::IO || (request.pcmd() != pcmd::IO_DIRECTION && request.pcmd() != pcmd::IO_SET)) {
+            throw std::invalid_argument("DPA request is not IO Direction or IO Set");
+        }
+        if (this->data.size() % 3 != 0) {
+            throw std::invalid_argument("IO request data are not triplets");
+        }
+    }
+
+    /**
+     * Returns the number of triplets.
+     * @return Number of triplets
+     */
+    [[nodiscard]] std::size_t size() const { return this->data.size() / 3; }
+
+    /**
+     * Returns the triplet.
+     * @param index Triplet index
+     * @return Triplet
+     * @throws std::out_of_range if the index is out of range
+     */
+    [[nodiscard]] IoTriplet at(const std::size_t index) const {
+        if (index >= this->size()) {
+            throw std::out_of_range("IO triplet index out of range");
+        }
+        return IoTriplet{this->data[index * 3], this->data[index * 3 + 1], this->data[index * 3 + 2]};
+    }
+
+ private:
+    /// Triplet data
+    ByteView data;
+};
+
+/**
+ * Non-owning view of the Thermometer Read response data.
+ */
+class ThermometerView {
+ public:
+    /**
+     * Constructs the view of the Thermometer Read response.
+     * @param response DPA response
+     * @throws std::invalid_argument if the response is not a Thermometer Read response
+     */
+    explicit ThermometerView(const DpaResponseView &response): data(response.pdata()) {
+        if (response.pnum() != pnum::THERMOMETER || response.requestPcmd() != pcmd::THERMOMETER_READ ||
+            !response.isResponse() || this->data.size() != 3) {
+            throw std::invalid_argument("DPA response is not Thermometer Read response");
+        }
+    }
+
+    /**
+     * Returns the temperature in whole degrees Celsius.
+     * @return Temperature, -128 if the sensor failed
+     */
+    [[nodiscard]] int8_t celsius() const { return static_cast<int8_t>(this->data[0]); }
+
+    /**
+     * Returns the temperature in 1/16 degrees Celsius.
+     * @return Temperature as a 12-bit signed value
+     */
+    [[nodiscard]] int16_t sixteenths() const {
+        const auto raw = static_cast<uint16_t>(readUint16(this->data, 1) & 0x0FFF);
+        return static_cast<int16_t>((raw & 0x0800) != 0 ? raw - 0x1000 : raw);
+    }
+
+ private:
+    /// Response data
+    ByteView data;
+};
+
+}  // namespace iqrf::connector::dpa
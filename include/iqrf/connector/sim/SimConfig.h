@@ -0,0 +1,66 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: SimConfig.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-16
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "iqrf/connector/Clock.h"
+
+namespace iqrf::connector::sim {
+
+/**
+ * Configuration of the simulated IQRF network.
+ */
+struct SimConfig {
+    /// Number of bonded nodes, the nodes have addresses 1 to nodeCount (at most 239)
+    uint16_t nodeCount = 10;
+    /// Number of nodes in each routing hop, node N is (N - 1) / nodesPerHop + 1 hops away
+    uint16_t nodesPerHop = 16;
+    /// Probability of losing a packet on a single routing hop
+    double linkLoss = 0.0;
+    /// Seed of the pseudo-random generator deciding the packet loss
+    uint64_t seed = 0;
+    /// Hardware profile ID of the nodes
+    uint16_t hwpid = 0x0000;
+    /// Delay between a request and the coordinator confirmation or response
+    std::chrono::microseconds interfaceDelay{5000};
+    /// Duration of a single node slot of 2-bit FRC, 1-byte FRC takes twice as long
+    std::chrono::microseconds frcSlot{10000};
+    /// Jump the virtual time to the next event when receiving and nothing is due yet
+    bool autoAdvance = true;
+    /// Virtual clock of the simulation, also used by the connector, a new one if not set
+    std::shared_ptr<VirtualClock> clock;
+};
+
+/**
+ * Statistics of the simulated IQRF network.
+ */
+struct SimStats {
+    /// Number of received requests
+    uint64_t requests = 0;
+    /// Number of sent confirmations
+    uint64_t confirmations = 0;
+    /// Number of sent responses
+    uint64_t responses = 0;
+    /// Number of requests lost on the way to the node
+    uint64_t lostRequests = 0;
+    /// Number of responses lost on the way from the node
+    uint64_t lostResponses = 0;
+    /// Number of FRC rounds
+    uint64_t frcRounds = 0;
+    /// Time the RF channel has been busy
+    std::chrono::microseconds rfBusyTime{0};
+};
+
+}  // namespace iqrf::connector::sim
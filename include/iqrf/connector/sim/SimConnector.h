@@ -0,0 +1,343 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: SimConnector.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-16
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/core/ignore_unused.hpp>
+
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/IConnector.h"
+#include "iqrf/connector/dpa/DpaFrame.h"
+#include "iqrf/connector/sim/SimConfig.h"
+#include "iqrf/connector/sim/SimNode.h"
+
+namespace iqrf::connector::sim {
+
+/**
+ * Simulated IQRF network of a coordinator and bonded nodes.
+ *
+ * DPA requests are answered the way the coordinator does: the confirmation of a request
+ * to a node carries the number of hops and the timeslot, the response arrives after
+ * (hops + 1) * timeslot of the request plus (hops + 1) * timeslot of the response. Only
+ * one request is routed through the network at a time. Packets are lost on each hop with
+ * the configured probability, decided by a seeded pseudo-random generator.
+ *
+ * The network runs on a virtual clock, which is also used for all timing of the connector.
+ * Receiving jumps to the next scheduled message, so a long network activity is simulated
+ * as fast as the messages are processed, and the same sequence of requests always yields
+ * the same sequence of responses.
+ *
+ * @internal
+ */
+class SimConnector : public IConnector {
+ public:
+    /// Virtual time elapsed since the start of the simulation
+    typedef std::chrono::microseconds Duration;
+
+    /**
+     * Constructs the simulated network
+     * @param config Simulated network configuration
+     * @throws std::invalid_argument if the configuration is not valid
+     */
+    explicit SimConnector(const SimConfig &config = SimConfig());
+
+    /**
+     * Destructs the simulated network
+     */
+    ~SimConnector() override;
+
+    // Basic state
+
+    /**
+     * Get the current state of the connector.
+     */
+    State getState() const override;
+
+    // Basic communication
+
+    using IConnector::send;
+
+    /**
+     * Returns the next message due at the current virtual time.
+     *
+     * With auto advance enabled, the virtual time jumps to the next scheduled message.
+     *
+     * @return Message or an empty vector if no message is due
+     */
+    std::vector<uint8_t> receive() override;
+
+    // Transceiver operations
+
+    /**
+     * Retrieve basic information about the coordinator TR module.
+     */
+    TrInfo readTrInfo() override;
+
+    /**
+     * Reset the coordinator, the messages in flight are dropped.
+     */
+    void resetTr() override;
+
+    // Programming mode
+
+    /**
+     * Switch the connected TR to programming mode.
+     */
+    void enterProgrammingMode() override {
+        throw std::runtime_error("Not implemented");
+    }
+
+    /**
+     * Wait for TR to enter programming mode.
+     */
+    void awaitProgrammingMode() override {
+        throw std::runtime_error("Not implemented");
+    }
+
+    /**
+     * Switch the connected TR back from programming mode.
+     */
+    void exitProgrammingMode() override {
+        throw std::runtime_error("Not implemented");
+    }
+
+    /**
+     * Uploads the data to the TR module in programming mode.
+     *
+     * @param target specifies what the uploaded data contain.
+     * @param data is the actual data to be uploaded.
+     */
+    void upload(const ProgrammingTarget target, const std::vector<uint8_t> &data) override {
+        boost::ignore_unused(target, data);
+        throw std::runtime_error("Not implemented");
+    }
+
+    /**
+     * Downloads data from the TR module in programming mode.
+     *
+     * @param target specifies which data shall be downloaded.
+     */
+    std::vector<uint8_t> download(const ProgrammingTarget target) override {
+        boost::ignore_unused(target);
+        throw std::runtime_error("Not implemented");
+    }
+
+    /**
+     * Downloads data from the TR module memory in programming mode.
+     *
+     * @param target specifies which data shall be downloaded.
+     * @param address specifies the Flash or EEPROM address from which the data will be downloaded.
+     */
+    std::vector<uint8_t> download(const ProgrammingTarget target, const uint16_t address) override {
+        boost::ignore_unused(target, address);
+        throw std::runtime_error("Not implemented");
+    }
+
+    // Simulation control
+
+    /**
+     * Returns the current virtual time
+     * @return Virtual time since the start of the simulation
+     */
+    Duration now() const;
+
+    /**
+     * Advances the virtual time, e.g. to simulate the idle time of the host
+     * @param duration Time to advance by
+     */
+    void advance(Duration duration);
+
+    /**
+     * Returns the virtual clock of the simulation
+     * @return Virtual clock
+     */
+    VirtualClock &getVirtualClock() const;
+
+    /**
+     * Returns the state of the device
+     * @param address Device address, 0 for the coordinator
+     * @return Device state
+     * @throws std::out_of_range if the address is not a device address
+     */
+    SimNode getNode(uint16_t address) const;
+
+    /**
+     * Modifies the state of the device, e.g. the temperature or the link loss
+     * @param address Device address, 0 for the coordinator
+     * @param modifier Function modifying the device state
+     * @throws std::out_of_range if the address is not a device address
+     */
+    void updateNode(uint16_t address, const std::function<void(SimNode&)> &modifier);
+
+    /**
+     * Returns the simulation statistics
+     * @return Simulation statistics
+     */
+    SimStats getStats() const;
+
+    /**
+     * Returns the DPA timeslot length for the data length, as used by the STD RF mode
+     * @param pdataLength Length of the request or response data
+     * @return Timeslot length
+     */
+    static Duration timeslot(std::size_t pdataLength);
+
+ protected:
+    /**
+     * Passes the DPA request to the simulated coordinator.
+     * @param data DPA request
+     */
+    void send(const std::vector<uint8_t> &data) override;
+
+ private:
+    /**
+     * Message scheduled for the delivery to the host.
+     */
+    struct Event {
+        /// Virtual time of the delivery
+        Duration time;
+        /// Order of scheduling, keeps the messages with the same time in order
+        uint64_t sequence;
+        /// Message
+        std::vector<uint8_t> frame;
+
+        /**
+         * Orders the events, the earliest first
+         * @param other Other event
+         * @return true if this event is delivered later
+         */
+        bool operator>(const Event &other) const {
+            return this->time != other.time ? this->time > other.time : this->sequence > other.sequence;
+        }
+    };
+
+    /**
+     * Schedules the message for the delivery to the host
+     * @param time Virtual time of the delivery
+     * @param frame Message
+     */
+    void schedule(Duration time, std::vector<uint8_t> frame);
+
+    /**
+     * Executes the request addressed to the coordinator
+     * @param request DPA request
+     * @param start Virtual time the coordinator starts processing the request
+     */
+    void handleLocal(const dpa::DpaRequestView &request, Duration start);
+
+    /**
+     * Routes the request to the node and schedules the confirmation and the response
+     * @param request DPA request
+     * @param start Virtual time the coordinator starts processing the request
+     */
+    void handleRemote(const dpa::DpaRequestView &request, Duration start);
+
+    /**
+     * Runs the FRC round and schedules the response
+     * @param request FRC request
+     * @param start Virtual time the coordinator starts processing the request
+     */
+    void handleFrc(const dpa::DpaRequestView &request, Duration start);
+
+    /**
+     * Executes the request by the device peripherals
+     * @param node Device
+     * @param request DPA request
+     * @param pdata Response data
+     * @return Response code
+     */
+    dpa::ResponseCode execute(SimNode &node, const dpa::DpaRequestView &request, std::vector<uint8_t> &pdata);
+
+    /**
+     * Executes the request by the memory peripheral
+     * @param memory Memory contents
+     * @param size Memory size
+     * @param request DPA request
+     * @param pdata Response data
+     * @return Response code
+     */
+    static dpa::ResponseCode executeMemory(
+        uint8_t *memory,
+        std::size_t size,
+        const dpa::DpaRequestView &request,
+        std::vector<uint8_t> &pdata
+    );
+
+    /**
+     * Builds the DPA response
+     * @param request DPA request
+     * @param node Responding device
+     * @param code Response code
+     * @param pdata Response data
+     * @return DPA response
+     */
+    static std::vector<uint8_t> buildResponse(
+        const dpa::DpaRequestView &request,
+        const SimNode &node,
+        dpa::ResponseCode code,
+        const std::vector<uint8_t> &pdata
+    );
+
+    /**
+     * Decides whether a packet passes all hops
+     * @param hops Number of hops
+     * @param linkLoss Probability of losing the packet on a single hop
+     * @return true if the packet is delivered
+     */
+    bool delivered(uint32_t hops, double linkLoss);
+
+    /**
+     * Returns the current virtual time, the caller holds the lock
+     * @return Virtual time since the start of the simulation
+     */
+    Duration elapsed() const;
+
+    /**
+     * Returns the device state
+     * @param address Device address
+     * @return Device state
+     * @throws std::out_of_range if the address is not a device address
+     */
+    SimNode &nodeAt(uint16_t address);
+
+    /// Simulated network configuration
+    SimConfig config;
+    /// Coordinator and nodes indexed by the address
+    std::vector<SimNode> nodes;
+    /// Messages scheduled for the delivery to the host
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+    /// Virtual clock of the simulation
+    std::shared_ptr<VirtualClock> virtualClock;
+    /// Start of the simulation
+    IClock::TimePoint epoch;
+    /// Virtual time the RF channel becomes free
+    Duration rfFreeAt{0};
+    /// Sequence number of the next scheduled event
+    uint64_t nextSequence = 0;
+    /// State of the pseudo-random generator
+    uint64_t randomState;
+    /// Simulation statistics
+    SimStats stats;
+    /// Guards the simulation state
+    mutable std::mutex mutex;
+};
+
+}  // namespace iqrf::connector::sim
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: SimNode.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-16
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace iqrf::connector::sim {
+
+/**
+ * State of a simulated device, its peripherals are backed by memory.
+ */
+struct SimNode {
+    /// Size of the RAM peripheral
+    static constexpr std::size_t RAM_SIZE = 48;
+    /// Size of the EEPROM peripheral
+    static constexpr std::size_t EEPROM_SIZE = 192;
+    /// Number of IO ports
+    static constexpr std::size_t IO_PORTS = 5;
+
+    /// Device address
+    uint16_t address = 0;
+    /// Device is bonded to the network
+    bool bonded = false;
+    /// Number of routing hops between the coordinator and the node
+    uint8_t hops = 1;
+    /// Probability of losing a packet on a single routing hop
+    double linkLoss = 0.0;
+    /// Hardware profile ID
+    uint16_t hwpid = 0x0000;
+    /// Module ID
+    uint32_t mid = 0;
+    /// IQRF OS version
+    uint8_t osVersion = 0x44;
+    /// TR module type
+    uint8_t trType = 0xB8;
+    /// IQRF OS build
+    uint16_t osBuild = 0x08D7;
+    /// DPA value returned in the responses
+    uint8_t dpaValue = 0x40;
+    /// Temperature in degrees Celsius
+    int8_t temperature = 22;
+    /// Red LED is on
+    bool ledr = false;
+    /// Green LED is on
+    bool ledg = false;
+    /// RAM peripheral contents
+    std::array<uint8_t, RAM_SIZE> ram{};
+    /// EEPROM peripheral contents
+    std::array<uint8_t, EEPROM_SIZE> eeprom{};
+    /// IO port directions, set bits are inputs
+    std::array<uint8_t, IO_PORTS> ioDirection{};
+    /// IO port output values
+    std::array<uint8_t, IO_PORTS> ioOutput{};
+    /// Number of requests executed by the device
+    uint64_t requests = 0;
+    /// Number of resets
+    uint64_t resets = 0;
+};
+
+}  // namespace iqrf::connector::sim
@@ -12,10 +12,13 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
 
+#include "iqrf/connector/Clock.h"
+
 namespace iqrf::connector::tcp {
 
 /**
@@ -27,6 +30,8 @@ class TcpConfig {
     std::string host;
     /// TCP port number
     uint16_t port = 10000;
+    /// Clock used for the reconnection backoff and all other timing, the steady clock if not set
+    std::shared_ptr<IClock> clock;
 
     /**
      * Constructs the TCP connector configuration
@@ -52,6 +52,8 @@ class TcpConnector : public IConnector {
 
     // Basic communication
 
+    using IConnector::send;
+
     /**
      * Send the data message via the connector.
      */
@@ -67,6 +67,12 @@ class HdlcFrame {
      */
     [[nodiscard]] const std::vector<uint8_t> &getData() const;
 
+    /**
+     * Checks whether a frame has been fully decoded
+     * @return true if the frame is decoded and not empty
+     */
+    [[nodiscard]] bool isComplete() const;
+
  private:
 #if BUILD_TESTS
     FRIEND_TEST(HdlcFrameTest, calculateCrc);
@@ -0,0 +1,187 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: UartBringUp.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-19
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/uart/UartConfig.h"
+#include "iqrf/connector/uart/UartConnector.h"
+#include "iqrf/gpio/Gpio.h"
+
+namespace iqrf::connector::uart {
+
+/**
+ * Role of a GPIO line in the bring-up.
+ */
+enum class GpioRole {
+    /// TR module power enable
+    Power,
+    /// TR module programming mode switch
+    ProgrammingMode,
+    /// Enable of all buses
+    BusEnable,
+    /// UART bus enable
+    UartEnable,
+    /// SPI bus enable
+    SpiEnable,
+    /// I2C bus enable
+    I2cEnable,
+    /// TR module ready input
+    TrReady
+};
+
+/**
+ * Action of a bring-up step.
+ */
+enum class GpioAction {
+    /// Initialize the line as an input with the rising edge detection
+    InitInput,
+    /// Initialize the line as an output with the value
+    InitOutput,
+    /// Set the output value of the line
+    SetValue,
+    /// Wait for the duration
+    Wait
+};
+
+/**
+ * Step of the GPIO bring-up sequence.
+ */
+struct GpioStep {
+    /// Action of the step
+    GpioAction action;
+    /// GPIO line, not set for waiting
+    std::optional<Gpio> gpio;
+    /// Output value
+    bool value = false;
+    /// Duration of waiting
+    std::chrono::milliseconds duration{0};
+};
+
+/**
+ * Brings up several UART connectors at once.
+ *
+ * The GPIO lines of all configurations are merged into a single sequence: each distinct line is
+ * initialized once, all TR modules are power cycled together and the UART buses are enabled
+ * together. A line may be shared by the configurations only in compatible roles, e.g. a common
+ * bus enable, a common power enable or a UART enable of one module used as the bus enable of
+ * another. The ports are then opened and the TR modules awaited in parallel, so the bring-up takes
+ * as long as the slowest module.
+ *
+ * The configurations sharing a GPIO line use the same Gpio instance. The connectors still drive
+ * their lines inactive on destruction, so the connectors sharing a line should be destroyed together.
+ */
+class UartBringUp {
+ public:
+    /**
+     * Constructs the bring-up and computes the GPIO sequence
+     * @param configs UART connector configurations
+     * @param clock Clock used for the waiting, the steady clock if not set
+     * @throws std::invalid_argument if a GPIO line is shared in conflicting roles
+     */
+    explicit UartBringUp(std::vector<UartConfig> configs, std::shared_ptr<IClock> clock = nullptr);
+
+    /**
+     * Returns the GPIO bring-up sequence
+     * @return GPIO bring-up sequence
+     */
+    [[nodiscard]] const std::vector<GpioStep> &getPlan() const;
+
+    /**
+     * Returns the configurations with the shared GPIO lines, as used for the connectors
+     * @return UART connector configurations
+     */
+    [[nodiscard]] const std::vector<UartConfig> &getConfigs() const;
+
+    /**
+     * Executes the GPIO bring-up sequence
+     */
+    void prepareGpio();
+
+    /**
+     * Executes the GPIO bring-up sequence and constructs the connectors in parallel
+     * @return Connectors in the order of the configurations
+     * @throws std::exception the first exception thrown by a connector construction
+     */
+    std::vector<std::unique_ptr<UartConnector>> run();
+
+    /**
+     * Returns the name of the GPIO line role
+     * @param role GPIO line role
+     * @return Name of the role
+     */
+    static const char *roleName(GpioRole role);
+
+ private:
+    /**
+     * Distinct GPIO line of the bring-up.
+     */
+    struct Line {
+        /// GPIO line shared by the configurations
+        Gpio gpio;
+        /// Role of the line
+        GpioRole role;
+        /// Power cycle the line during the bring-up
+        bool reset = false;
+    };
+
+    /**
+     * Registers the GPIO line and replaces it by the shared instance
+     * @param gpio GPIO line of the configuration
+     * @param role Role of the line in the configuration
+     * @param config Configuration the line belongs to
+     * @throws std::invalid_argument if the line is already used in a conflicting role
+     */
+    void addLine(std::optional<Gpio> &gpio, GpioRole role, const UartConfig &config);
+
+    /**
+     * Computes the GPIO bring-up sequence of the registered lines
+     */
+    void buildPlan();
+
+    /**
+     * Checks whether a line can be shared in both roles
+     * @param first Role of the line
+     * @param second Other role of the line
+     * @return true if the roles drive the line the same way
+     */
+    static bool compatible(GpioRole first, GpioRole second);
+
+    /**
+     * Returns the key identifying the GPIO line
+     * @param config GPIO line configuration
+     * @return Line key
+     */
+    static std::string lineKey(const gpio::GpioConfig &config);
+
+    /// UART connector configurations
+    std::vector<UartConfig> configs;
+    /// Clock used for the waiting
+    std::shared_ptr<IClock> clock;
+    /// Distinct GPIO lines in the order of the first use
+    std::vector<Line> lines;
+    /// Index of the lines by the line key
+    std::map<std::string, std::size_t> index;
+    /// Longest power-off hold of the power cycled modules
+    std::chrono::milliseconds resetHold{0};
+    /// GPIO bring-up sequence
+    std::vector<GpioStep> plan;
+};
+
+}  // namespace iqrf::connector::uart
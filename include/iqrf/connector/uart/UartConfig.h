@@ -12,11 +12,15 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
 
 #include "iqrf/connector/BusSwitcher.h"
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/PowerUp.h"
+#include "iqrf/connector/SendPacer.h"
 #include "iqrf/gpio/Gpio.h"
 
 namespace iqrf::connector::uart {
@@ -40,6 +44,18 @@ class UartConfig: public iqrf::connector::BusSwitcherConfig {
     bool trModuleReset = true;
     /// Disable TR module power during connector destruction
     bool disablePowerOnShutdown = true;
+    /// GPIO signalling the TR module is ready, active high
+    std::optional<Gpio> trReadyGpio;
+    /// TR module power-up and reset timing
+    PowerUpConfig powerUp;
+    /// Run the TR module reset pulse on a SCHED_FIFO timer thread, requires CAP_SYS_NICE
+    bool realtimeGpio = false;
+    /// GPIO lines are initialized and the TR module powered up by the caller, e.g. UartBringUp
+    bool gpioPrepared = false;
+    /// Outbound pacing configuration
+    std::optional<PacingConfig> pacing;
+    /// Clock used for the power-up, reset and all other timing, the steady clock if not set
+    std::shared_ptr<IClock> clock;
 
     /**
      * Constructs the minimal UART connector configuration
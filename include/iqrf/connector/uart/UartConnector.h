@@ -13,17 +13,25 @@
 
 #include <libserialport.h>
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
 #include <boost/core/ignore_unused.hpp>
 
 #include "iqrf/connector/BusSwitcher.h"
+#include "iqrf/connector/Clock.h"
 #include "iqrf/connector/IConnector.h"
 #include "iqrf/connector/ConnectorUtils.h"
+#include "iqrf/connector/PowerUp.h"
 #include "iqrf/connector/uart/HdlcFrame.h"
 #include "iqrf/connector/uart/UartConfig.h"
+#include "iqrf/gpio/GpioGroup.h"
+#include "iqrf/gpio/Waveform.h"
 #include "iqrf/log/Logging.h"
 
 namespace iqrf::connector::uart {
@@ -55,6 +63,8 @@ class UartConnector : public IConnector {
 
     // Basic communication
 
+    using IConnector::send;
+
     /**
      * Send the data message via the connector.
      */
@@ -75,10 +85,20 @@ class UartConnector : public IConnector {
     }
 
     /**
-     * Reset the TR module.
+     * Reset the TR module and wait for it to become ready.
+     *
+     * While the connector is listening, the frames are read by the listening loop, which signals
+     * them to the waiting and keeps delivering them to the handlers.
      */
     void resetTr() override;
 
+    /**
+     * Get the statistics of the TR module power-ups and resets.
+     *
+     * @return Power-up statistics.
+     */
+    PowerUpStats getPowerUpStats() const;
+
     // Programming mode
 
     /**
@@ -146,7 +166,44 @@ class UartConnector : public IConnector {
      */
     void initGpio();
 
+    /**
+     * Powers up the TR module and waits until it is ready
+     */
+    void powerUp();
+
  private:
+    /**
+     * Switches the TR module power off for the reset hold time and back on
+     */
+    void powerCycle();
+
+    /**
+     * Returns the time source of the GPIO waveforms driven by the connector clock
+     * @return Waveform time source, the monotonic clock for the steady clock
+     */
+    iqrf::gpio::WaveformTimer waveformTimer();
+
+    /**
+     * Waits for the TR module to become ready and reports the time to ready
+     *
+     * The frames received meanwhile are kept for the delivery, except the responses to the probes.
+     */
+    void awaitReady();
+
+    /**
+     * Keeps the frame read while waiting for the TR module, the listening loop delivers it
+     * @param data Frame data
+     */
+    void keepFrame(std::vector<uint8_t> data);
+
+    /**
+     * Reads the bytes until a frame is decoded or the timeout expires
+     * @param frame Frame being decoded, reset on invalid data
+     * @param timeout Maximal time to wait
+     * @return true if a frame has been decoded
+     */
+    bool readFrame(HdlcFrame &frame, IClock::Duration timeout);
+
     /**
      * Check the result of the libserialport functions and throw an exception on error.
      * @param result libserialport return code
@@ -158,8 +215,30 @@ class UartConnector : public IConnector {
     iqrf::connector::BusSwitcher busSwitcher;
     /// UART configuration
     UartConfig config;
+    /// Power enable and programming mode GPIOs switched at once
+    std::optional<iqrf::gpio::GpioGroup> controlGroup;
+    /// Mask of the power enable GPIO in the control group
+    uint64_t powerMask = 0;
+    /// Mask of the programming mode GPIO in the control group
+    uint64_t pgmMask = 0;
     /// UART port
     sp_port *port = nullptr;
+    /// Runs the TR module reset pulse
+    iqrf::gpio::WaveformEngine waveformEngine;
+    /// TR module power-up monitor
+    PowerUpMonitor powerUpMonitor;
+    /// Guards the power-up monitor
+    mutable std::mutex powerUpGuard;
+    /// Frames read while waiting for the TR module, returned by receive() first
+    std::deque<std::vector<uint8_t>> pendingFrames;
+    /// Number of frames received by the listening loop
+    uint64_t receivedFrames = 0;
+    /// Number of probes sent while listening, their responses are not delivered
+    uint64_t unansweredProbes = 0;
+    /// Guards the frames shared with the listening loop
+    std::mutex frameGuard;
+    /// Signals a frame received by the listening loop
+    std::condition_variable frameReceived;
 };
 
 }  // namespace iqrf::connector::uart
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
 #include "iqrf/gpio/Common.h"
 
 namespace iqrf::gpio {
@@ -64,6 +68,63 @@ class Base {
      * @return GPIO pin output value
      */
     virtual bool getValue() = 0;
+
+    /**
+     * Initializes GPIO line as an input with the edge detection
+     * @param config Edge detection configuration
+     */
+    virtual void initEdgeInput(const GpioEventConfig& config) = 0;
+
+    /**
+     * Waits for the next edge event of the line
+     * @param timeout Maximal wait time, negative value waits indefinitely
+     * @return Edge event or std::nullopt if no event came within the timeout
+     */
+    virtual std::optional<GpioEvent> waitEvent(std::chrono::nanoseconds timeout) = 0;
+
+    /**
+     * Returns the file descriptor which becomes readable when an edge event is pending
+     *
+     * The descriptor is meant for poll/epoll only, the events have to be read by waitEvent().
+     * @return File descriptor
+     */
+    virtual int getEventFd() = 0;
+};
+
+/**
+ * GPIO driver - base interface of a group of lines requested at once
+ *
+ * Values of the lines are passed as a bit mask, bit N belongs to the N-th line of the group.
+ */
+class GroupBase {
+ public:
+    /**
+     * Destructor
+     */
+    virtual ~GroupBase() = default;
+
+    /**
+     * Initializes all GPIO lines as inputs
+     */
+    virtual void initInput() = 0;
+
+    /**
+     * Initializes all GPIO lines as outputs
+     * @param initialValues Initial output values
+     */
+    virtual void initOutput(uint64_t initialValues) = 0;
+
+    /**
+     * Sets output values of all GPIO lines at once
+     * @param values GPIO line output values
+     */
+    virtual void setValues(uint64_t values) = 0;
+
+    /**
+     * Retrieves values of all GPIO lines at once
+     * @return GPIO line values
+     */
+    virtual uint64_t getValues() = 0;
 };
 
 }  // namespace iqrf::gpio
@@ -0,0 +1,157 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: BasicGpio.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-23
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "iqrf/gpio/Base.h"
+#include "iqrf/gpio/Common.h"
+#include "iqrf/gpio/Config.h"
+#include "iqrf/gpio/Gpio.h"
+
+namespace iqrf::gpio {
+
+/**
+ * GPIO pin with the driver selected at compile time
+ *
+ * Unlike Gpio, the driver calls are resolved statically, the driver classes are final, so the
+ * compiler calls them directly instead of through the virtual table. Copies share the driver
+ * instance like the copies of Gpio, the reference count is touched only by copying.
+ *
+ * @tparam Backend GPIO driver, a final implementation of Base
+ */
+template<typename Backend>
+class BasicGpio {
+    static_assert(std::is_base_of_v<Base, Backend>, "GPIO backend has to implement iqrf::gpio::Base");
+    static_assert(std::is_final_v<Backend>, "GPIO backend has to be final to be called directly");
+
+ public:
+    /// GPIO driver type
+    typedef Backend BackendType;
+
+    /**
+     * Constructor
+     * @param config GPIO pin configuration
+     */
+    explicit BasicGpio(const GpioConfig& config) :
+        impl(std::make_shared<Backend>(config)), config(std::make_shared<const GpioConfig>(config)) {
+    }
+
+    /**
+     * Initializes GPIO pin as an input
+     */
+    void initInput() const {
+        this->impl->initInput();
+    }
+
+    /**
+     * Initializes GPIO pin as an output
+     * @param initialValue Initial output value
+     */
+    void initOutput(const bool initialValue) const {
+        this->impl->initOutput(initialValue);
+    }
+
+    /**
+     * Sets GPIO pin direction
+     * @param direction GPIO pin direction
+     */
+    void setDirection(const GpioDirection direction) const {
+        this->impl->setDirection(direction);
+    }
+
+    /**
+     * Retrieves GPIO pin direction
+     * @return GPIO pin direction
+     */
+    [[nodiscard]] GpioDirection getDirection() const {
+        return this->impl->getDirection();
+    }
+
+    /**
+     * Sets GPIO pin output value
+     * @param value GPIO pin output value
+     */
+    void setValue(const bool value) const {
+        this->impl->setValue(value);
+    }
+
+    /**
+     * Retrieves GPIO line input value
+     * @return GPIO line input value
+     */
+    [[nodiscard]] bool getValue() const {
+        return this->impl->getValue();
+    }
+
+    /**
+     * Initializes GPIO line as an input with the edge detection
+     * @param eventConfig Edge detection configuration
+     */
+    void initEdgeInput(const GpioEventConfig& eventConfig = GpioEventConfig()) const {
+        this->impl->initEdgeInput(eventConfig);
+    }
+
+    /**
+     * Waits for the next edge event of the line
+     * @param timeout Maximal wait time, negative value waits indefinitely
+     * @return Edge event or std::nullopt if no event came within the timeout
+     */
+    [[nodiscard]] std::optional<GpioEvent> waitEvent(
+        const std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1)) const {
+        return this->impl->waitEvent(timeout);
+    }
+
+    /**
+     * Returns the file descriptor which becomes readable when an edge event is pending
+     * @return File descriptor
+     */
+    [[nodiscard]] int getEventFd() const {
+        return this->impl->getEventFd();
+    }
+
+    /**
+     * Retrieves GPIO pin configuration
+     * @return GPIO pin configuration
+     */
+    [[nodiscard]] const GpioConfig& getConfig() const {
+        return *this->config;
+    }
+
+    /**
+     * Returns the GPIO driver instance
+     * @return GPIO driver
+     */
+    [[nodiscard]] Backend& getBackend() const {
+        return *this->impl;
+    }
+
+ private:
+    /// GPIO driver instance
+    std::shared_ptr<Backend> impl;
+    /// GPIO pin configuration, shared by the copies like the driver instance
+    std::shared_ptr<const GpioConfig> config;
+};
+
+#if defined(__linux__)
+/// GPIO pin with the native driver of the platform
+typedef BasicGpio<Gpiod> NativeGpio;
+#elif defined(__FreeBSD__)
+/// GPIO pin with the native driver of the platform
+typedef BasicGpio<GpioFreeBsd> NativeGpio;
+#endif
+
+}  // namespace iqrf::gpio
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: ChipRegistry.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-21
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace iqrf::gpio {
+
+/**
+ * GPIO chip registry statistics
+ */
+struct ChipRegistryStats {
+    /// Number of opened chip devices
+    uint64_t opened = 0;
+    /// Number of handles served by an already opened chip device
+    uint64_t reused = 0;
+};
+
+/**
+ * Registry of shared GPIO chip handles
+ *
+ * All lines of a chip share a single handle and thus a single file descriptor. The handle is
+ * reference counted and the chip device is closed once the last line using it is destroyed.
+ * The handles are used to request the lines and to read the line information, the line values
+ * are accessed through the line requests.
+ *
+ * @tparam Chip GPIO chip handle type of the backend
+ */
+template<typename Chip>
+class ChipRegistry {
+ public:
+    /// Opens the chip device
+    typedef std::function<std::shared_ptr<Chip>()> Opener;
+
+    /**
+     * Returns the process-wide registry
+     * @return Chip registry
+     */
+    static ChipRegistry& instance() {
+        static ChipRegistry registry;
+        return registry;
+    }
+
+    /**
+     * Returns the shared handle of the chip, opens the chip device if it is not open
+     * @param name GPIO chip name
+     * @param open Opens the chip device
+     * @return Chip handle
+     */
+    std::shared_ptr<Chip> acquire(const std::string& name, const Opener& open) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        const auto it = this->chips.find(name);
+        if (it != this->chips.end()) {
+            if (auto chip = it->second.lock()) {
+                this->stats.reused++;
+                return chip;
+            }
+        }
+        // Opened under the lock, so concurrent users of a chip never open it twice
+        std::shared_ptr<Chip> chip = open();
+        this->chips[name] = chip;
+        this->stats.opened++;
+        this->purge();
+        return chip;
+    }
+
+    /**
+     * Returns the number of open chip devices
+     * @return Number of open chips
+     */
+    [[nodiscard]] std::size_t size() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        std::size_t count = 0;
+        for (const auto& [name, chip] : this->chips) {
+            count += !chip.expired();
+        }
+        return count;
+    }
+
+    /**
+     * Returns the registry statistics
+     * @return Registry statistics
+     */
+    [[nodiscard]] ChipRegistryStats getStats() const {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->stats;
+    }
+
+ private:
+    /**
+     * Removes the entries of the closed chips
+     */
+    void purge() {
+        for (auto it = this->chips.begin(); it != this->chips.end();) {
+            if (it->second.expired()) {
+                it = this->chips.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    /// Chip handles by the chip name
+    std::map<std::string, std::weak_ptr<Chip>> chips;
+    /// Registry statistics
+    ChipRegistryStats stats;
+    /// Guards the registry
+    mutable std::mutex mutex;
+};
+
+}  // namespace iqrf::gpio
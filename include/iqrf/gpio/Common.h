@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <string>
+
 namespace iqrf::gpio {
 
 /**
@@ -28,4 +32,82 @@ enum class GpioDirection {
     Output
 };
 
+/**
+ * GPIO line state cache statistics
+ */
+struct GpioLineStats {
+    /// Direction queries answered from the cached state
+    uint64_t directionHits = 0;
+    /// Direction queries sent to the kernel
+    uint64_t directionQueries = 0;
+    /// Output value reads answered from the cached state
+    uint64_t valueHits = 0;
+    /// Value writes and direction changes sent to the kernel
+    uint64_t writes = 0;
+    /// Value writes and direction changes skipped, the line was already in the state
+    uint64_t skippedWrites = 0;
+    /// Line information change events, each invalidates the cached state
+    uint64_t infoEvents = 0;
+};
+
+/**
+ * GPIO line information change
+ */
+enum class GpioLineChange {
+    /// Line requested by a consumer
+    Requested,
+    /// Line released by its consumer
+    Released,
+    /// Line reconfigured by its consumer
+    Reconfigured
+};
+
+/**
+ * GPIO line information change event
+ */
+struct GpioLineInfoEvent {
+    /// Kind of the change
+    GpioLineChange change = GpioLineChange::Reconfigured;
+    /// Line direction after the change
+    GpioDirection direction = GpioDirection::Input;
+    /// Whether the line is requested after the change
+    bool used = false;
+    /// Consumer of the line after the change
+    std::string consumer;
+};
+
+/**
+ * GPIO line edge
+ */
+enum class GpioEdge {
+    /// Rising edge, inactive to active
+    Rising,
+    /// Falling edge, active to inactive
+    Falling,
+    /// Both edges, used only for the edge detection
+    Both
+};
+
+/**
+ * GPIO line edge detection configuration
+ */
+struct GpioEventConfig {
+    /// Detected edges
+    GpioEdge edge = GpioEdge::Both;
+    /// Debounce period, the line has to be stable for this period for the edge to be reported
+    std::chrono::microseconds debounce{0};
+    /// Use hardware timestamps, if the platform supports them
+    bool hardwareTimestamps = false;
+};
+
+/**
+ * GPIO line edge event
+ */
+struct GpioEvent {
+    /// Edge, either rising or falling
+    GpioEdge edge = GpioEdge::Rising;
+    /// Event timestamp, monotonic clock unless the hardware timestamps are used
+    std::chrono::nanoseconds timestamp{0};
+};
+
 }  // namespace iqrf::gpio
@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #if defined(__linux__)
@@ -48,6 +51,10 @@ namespace iqrf::gpio {
 
 /**
  * GPIO pin
+ *
+ * The driver is selected at run time, which allows the mock to be used in place of the native
+ * driver. Code which does not need the mock can use BasicGpio (NativeGpio) to avoid the virtual
+ * calls.
  */
 class Gpio {
  public:
@@ -114,6 +121,35 @@ class Gpio {
      */
     [[nodiscard]] bool getValue() const;
 
+    /**
+     * Initializes GPIO line as an input with the edge detection
+     * @param eventConfig Edge detection configuration
+     */
+    void initEdgeInput(const GpioEventConfig& eventConfig = GpioEventConfig()) const;
+
+    /**
+     * Waits for the next edge event of the line, the line has to be initialized by initEdgeInput()
+     * @param timeout Maximal wait time, negative value waits indefinitely
+     * @return Edge event or std::nullopt if no event came within the timeout
+     */
+    [[nodiscard]] std::optional<GpioEvent> waitEvent(
+        std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1)) const;
+
+    /**
+     * Returns the file descriptor which becomes readable when an edge event is pending
+     *
+     * The descriptor can be registered with an external poll/epoll loop, the events have to be read
+     * by waitEvent() then.
+     * @return File descriptor
+     */
+    [[nodiscard]] int getEventFd() const;
+
+    /**
+     * Retrieves GPIO pin configuration
+     * @return GPIO pin configuration
+     */
+    [[nodiscard]] const GpioConfig& getConfig() const;
+
     /**
      * Swap function
      */
@@ -129,19 +165,37 @@ class Gpio {
     /**
      * Registers a callback for GPIO direction change
      * @param callback Callback function to be called when the GPIO direction changes
+     * @return Callback identifier
      */
-    void registerDirectionCallback(const GpioDirectionCallback& callback) const;
+    std::size_t registerDirectionCallback(const GpioDirectionCallback& callback) const;
 
     /**
      * Registers a callback for GPIO value change
      * @param callback Callback function to be called when the GPIO value changes
+     * @return Callback identifier
+     */
+    std::size_t registerValueCallback(const GpioValueCallback& callback) const;
+
+    /**
+     * Returns the mock driver, e.g. to set its clock or to read the line timeline
+     * @return GPIO mock driver
+     */
+    [[nodiscard]] std::shared_ptr<GpioMock> getMock() const;
+
+    /**
+     * Injects GPIO line edge event for testing purposes
+     * @param edge Rising or falling edge
+     * @param timestamp Event timestamp
      */
-    void registerValueCallback(const GpioValueCallback& callback) const;
+    void injectEvent(GpioEdge edge,
+        std::chrono::nanoseconds timestamp = std::chrono::steady_clock::now().time_since_epoch()) const;
 #endif
 
  private:
     /// GPIO driver instance
     std::shared_ptr<iqrf::gpio::Base> impl;
+    /// GPIO pin configuration, shared by the copies like the driver instance
+    std::shared_ptr<const GpioConfig> config;
     /// Mock flag
     bool isMock = false;
 
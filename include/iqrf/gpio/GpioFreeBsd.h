@@ -19,12 +19,17 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/gpio.h>
+#include <sys/ioctl.h>
 
+#include <cerrno>
+#include <chrono>
 #include <cstdlib>
 #include <cstdint>
 #include <exception>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 
 #include "iqrf/gpio/Common.h"
 #include "iqrf/gpio/Base.h"
@@ -35,7 +40,7 @@ namespace iqrf::gpio {
 /**
  * GPIO driver - FreeBSD
  */
-class GpioFreeBsd: public Base {
+class GpioFreeBsd final: public Base {
  public:
     /**
      * Constructor
@@ -75,15 +80,53 @@ class GpioFreeBsd: public Base {
 
     /**
      * Sets GPIO line output value
+     *
+     * Defined inline, so BasicGpio issues the ioctl without a further call.
      * @param value GPIO line output value
      */
-    void setValue(bool value) override;
+    void setValue(const bool value) override {
+        struct gpio_req rq;
+        rq.gp_pin = this->line;
+        rq.gp_value = value ? 1 : 0;
+        if (ioctl(this->fd, GPIOSET, &rq) < 0) {
+            throw std::system_error(errno, std::generic_category(), "Failed to set GPIO value");
+        }
+    }
 
     /**
      * Retrieves GPIO line input value
+     *
+     * Defined inline, so BasicGpio issues the ioctl without a further call.
      * @return GPIO line input value
      */
-    bool getValue() override;
+    bool getValue() override {
+        struct gpio_req rq;
+        rq.gp_pin = this->line;
+        if (ioctl(this->fd, GPIOGET, &rq) < 0) {
+            throw std::system_error(errno, std::generic_category(), "Failed to get GPIO value");
+        }
+        return rq.gp_value != 0;
+    }
+
+    /**
+     * Edge events are not supported by the driver
+     * @param config Edge detection configuration
+     * @throws std::runtime_error always
+     */
+    void initEdgeInput(const GpioEventConfig& config) override;
+
+    /**
+     * Edge events are not supported by the driver
+     * @param timeout Maximal wait time
+     * @throws std::runtime_error always
+     */
+    std::optional<GpioEvent> waitEvent(std::chrono::nanoseconds timeout) override;
+
+    /**
+     * Edge events are not supported by the driver
+     * @throws std::runtime_error always
+     */
+    int getEventFd() override;
 
  private:
     /**
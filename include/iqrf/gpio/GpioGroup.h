@@ -0,0 +1,134 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioGroup.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-20
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "iqrf/gpio/Base.h"
+#include "iqrf/gpio/Gpio.h"
+
+namespace iqrf::gpio {
+
+#if IQRF_TESTING_SUPPORT
+/**
+ * Callback for setting the GPIO group values
+ * @param old Old GPIO line values
+ * @param new New GPIO line values
+ * @internal
+ */
+typedef std::function<void(uint64_t, uint64_t)> GpioGroupValuesCallback;
+#endif
+
+/**
+ * Group of GPIO lines switched at once
+ *
+ * Values of the lines are passed as a bit mask, bit N belongs to the N-th line of the group.
+ *
+ * Once initialized, lines on the same gpiod chip are held by a single line request, so all values
+ * are written or read by a single syscall and change at the same moment. Other lines (mocks, lines
+ * on different chips, platforms without bulk access) and lines of a group which has not been
+ * initialized, e.g. because the lines have been initialized by the caller, are switched one by one
+ * through their Gpio instances. The lines being deactivated are switched before the lines being
+ * activated in that case.
+ *
+ * The lines of an initialized group must not be initialized through their Gpio instances.
+ */
+class GpioGroup {
+ public:
+    /// Maximal number of lines in a group, the limit of a single kernel line request
+    static constexpr std::size_t MAX_LINES = 64;
+
+    /**
+     * Constructor
+     * @param lines GPIO lines of the group
+     * @throws std::invalid_argument if the group is empty or has too many lines
+     */
+    explicit GpioGroup(std::vector<Gpio> lines);
+
+    /**
+     * Initializes all GPIO lines as inputs
+     */
+    void initInput();
+
+    /**
+     * Initializes all GPIO lines as outputs
+     * @param initialValues Initial output values
+     */
+    void initOutput(uint64_t initialValues);
+
+    /**
+     * Sets output values of all GPIO lines
+     * @param values GPIO line output values
+     */
+    void setValues(uint64_t values) const;
+
+    /**
+     * Sets output values of the masked GPIO lines, the other lines keep their values
+     * @param values GPIO line output values
+     * @param mask Lines to set
+     */
+    void setValues(uint64_t values, uint64_t mask) const;
+
+    /**
+     * Retrieves values of all GPIO lines
+     * @return GPIO line values
+     */
+    [[nodiscard]] uint64_t getValues() const;
+
+    /**
+     * Returns the number of lines in the group
+     * @return Number of lines
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * Checks whether the lines are switched by a single request
+     * @return true if the lines are switched at once
+     */
+    [[nodiscard]] bool isAtomic() const;
+
+    /**
+     * Returns the GPIO lines of the group
+     * @return GPIO lines
+     */
+    [[nodiscard]] const std::vector<Gpio>& getLines() const;
+
+#if IQRF_TESTING_SUPPORT
+    /**
+     * Sets a callback called once for each setting of the GPIO line values
+     * @param callback Callback function to be called after the values are set
+     */
+    void setValuesCallback(const GpioGroupValuesCallback& callback) const;
+#endif
+
+ private:
+    /**
+     * Creates the driver holding all lines in a single request, if the lines allow it
+     * @return Driver or nullptr if the lines are switched one by one
+     */
+    [[nodiscard]] std::shared_ptr<GroupBase> createDriver() const;
+
+    /// GPIO lines
+    std::vector<Gpio> lines;
+    /// GPIO group driver instance, set once the group is initialized
+    std::shared_ptr<GroupBase> impl;
+#if IQRF_TESTING_SUPPORT
+    /// Callback for setting the values
+    mutable GpioGroupValuesCallback valuesCallback;
+#endif
+};
+
+}  // namespace iqrf::gpio
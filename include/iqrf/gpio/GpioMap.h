@@ -11,10 +11,14 @@
 
 #pragma once
 
-#include <map>
-#include <memory>
-#include <utility>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #if defined(__linux__)
 #include <gpiod.hpp>
@@ -31,12 +35,140 @@
 
 namespace iqrf::gpio {
 
-typedef std::map<std::size_t, std::pair<std::shared_ptr<std::string>, size_t>> GpioMap;
+/**
+ * GPIO chip record of the GPIO map
+ */
+struct GpioChipRecord {
+    /// GPIO chip name
+    std::string name;
+    /// Pin number of the first line of the chip
+    std::size_t firstPin = 0;
+    /// Number of lines of the chip
+    std::size_t lineCount = 0;
+};
+
+/**
+ * GPIO line record of the GPIO map
+ */
+struct GpioLineRecord {
+    /// GPIO chip name
+    std::string chip;
+    /// Line offset
+    std::size_t line = 0;
+};
 
 /**
- * Get map of GPIO pins and chips names / line offsets
+ * Map of GPIO pin numbers to GPIO chips and line offsets
+ *
+ * Pins are numbered consecutively over the lines of all chips in the chip order. The map holds
+ * a table of the chips sorted by their first pin and resolves a pin by a binary search in it. The
+ * chips are opened lazily, only up to the chip holding the highest requested pin, and the line
+ * names of a chip are indexed on the first line name lookup on the chip.
+ *
+ * The map is thread-safe.
+ */
+class GpioMap {
+ public:
+    /// Lists the GPIO chip names in the pin order
+    typedef std::function<std::vector<std::string>()> ChipLister;
+    /// Returns the number of lines of the chip, throws if the chip cannot be opened
+    typedef std::function<std::size_t(const std::string&)> LineCounter;
+    /// Returns the line names of the chip indexed by the line offset
+    typedef std::function<std::vector<std::string>(const std::string&)> LineNamer;
+
+    /**
+     * Constructor
+     * @param lister Lists the GPIO chips
+     * @param counter Returns the number of lines of a chip
+     * @param namer Returns the line names of a chip, line names are not resolved if empty
+     */
+    GpioMap(ChipLister lister, LineCounter counter, LineNamer namer = nullptr);
+
+    /**
+     * Constructor with a fixed chip table
+     * @param chips GPIO chip names and their line counts in the pin order
+     * @param namer Returns the line names of a chip, line names are not resolved if empty
+     */
+    explicit GpioMap(const std::vector<std::pair<std::string, std::size_t>>& chips, LineNamer namer = nullptr);
+
+    /**
+     * Copy constructor
+     * @param other GPIO map to copy
+     */
+    GpioMap(const GpioMap& other);
+
+    /**
+     * Assignment operator
+     */
+    GpioMap& operator=(const GpioMap&) = delete;
+
+    /**
+     * Finds the GPIO chip and line offset of the pin
+     * @param pin GPIO pin number
+     * @return GPIO chip and line offset or std::nullopt if there is no such pin
+     */
+    [[nodiscard]] std::optional<GpioLineRecord> findPin(std::size_t pin) const;
+
+    /**
+     * Finds the offset of the named line
+     * @param chip GPIO chip name
+     * @param lineName GPIO line name
+     * @return Line offset or std::nullopt if there is no such line
+     */
+    [[nodiscard]] std::optional<std::size_t> findLine(const std::string& chip, const std::string& lineName) const;
+
+    /**
+     * Returns all GPIO chips, opens the chips which have not been opened yet
+     * @return GPIO chips sorted by their first pin
+     */
+    [[nodiscard]] std::vector<GpioChipRecord> getChips() const;
+
+    /**
+     * Returns the number of GPIO chips opened so far
+     * @return Number of opened chips
+     */
+    [[nodiscard]] std::size_t getLoadedChipCount() const;
+
+ private:
+    /**
+     * Adds the next listed chip to the chip table, the caller holds the lock
+     * @return true if a chip has been added, false if all chips are loaded
+     */
+    bool loadNextChip() const;
+
+    /// Lists the GPIO chips
+    ChipLister lister;
+    /// Returns the number of lines of a chip
+    LineCounter counter;
+    /// Returns the line names of a chip
+    LineNamer namer;
+    /// Listed GPIO chip names, set on the first pin lookup
+    mutable std::optional<std::vector<std::string>> chipNames;
+    /// Index of the next listed chip to load
+    mutable std::size_t nextChip = 0;
+    /// Table of the loaded GPIO chips sorted by the first pin
+    mutable std::vector<GpioChipRecord> chips;
+    /// Number of pins of the loaded chips
+    mutable std::size_t pinCount = 0;
+    /// Line offsets by the chip and line name
+    mutable std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> lineNames;
+    /// Guards the lazily loaded state
+    mutable std::mutex mutex;
+};
+
+/**
+ * Get map of GPIO pins and chips names / line offsets of the system, the chips are opened lazily
+ *
+ * The line counts are cached in the GPIO topology cache file set at build time, if any.
  * @return Map of GPIO pins and chips / line offsets
  */
 GpioMap getGpioMap();
 
+/**
+ * Get map of GPIO pins and chips names / line offsets of the system with the topology cache
+ * @param cachePath GPIO topology cache file path, the cache is not used if empty
+ * @return Map of GPIO pins and chips / line offsets
+ */
+GpioMap getGpioMap(const std::string& cachePath);
+
 }  // namespace iqrf::gpio
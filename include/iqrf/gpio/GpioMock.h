@@ -16,11 +16,22 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "iqrf/gpio/Common.h"
 #include "iqrf/gpio/Base.h"
 #include "iqrf/gpio/Config.h"
+#include "iqrf/gpio/Waveform.h"
 
 namespace iqrf::gpio {
 
@@ -40,6 +51,36 @@ typedef std::function<void(iqrf::gpio::GpioDirection, iqrf::gpio::GpioDirection)
  */
 typedef std::function<void(bool, bool)> GpioValueCallback;
 
+/**
+ * Time source of the GPIO mock, e.g. the connector clock adapted by connector::makeGpioTimer()
+ * @internal
+ */
+typedef WaveformTimer GpioMockClock;
+
+/**
+ * Recorded change of a mocked GPIO line
+ * @internal
+ */
+struct GpioTransition {
+    /// Time of the change
+    std::chrono::nanoseconds timestamp{0};
+    /// GPIO line direction after the change
+    GpioDirection direction = GpioDirection::Input;
+    /// GPIO line value after the change
+    bool value = false;
+};
+
+/**
+ * Latency of the mocked GPIO line accesses, slept on the mock clock
+ * @internal
+ */
+struct GpioMockLatency {
+    /// Time taken by reading the line value
+    std::chrono::nanoseconds read{0};
+    /// Time taken by writing the line value, the line changes at its end
+    std::chrono::nanoseconds write{0};
+};
+
 /**
  * GPIO mock state
  * @internal
@@ -53,9 +94,13 @@ enum class GpioMockState {
 
 /**
  * GPIO driver - mock for testing purposes
+ *
+ * The mock is thread-safe, so the line can be driven by a simulated TR module thread while
+ * a connector thread accesses it. All changes of the line are recorded with the time of the mock
+ * clock. The callbacks are called without holding the mock lock, after the change has been made.
  * @internal
  */
-class GpioMock: public Base {
+class GpioMock final: public Base {
  public:
     /**
      * Constructor
@@ -68,7 +113,7 @@ class GpioMock: public Base {
     /**
      * Destructor
      */
-    ~GpioMock() override = default;
+    ~GpioMock() override;
 
     /**
      * Initializes GPIO line as an input
@@ -101,6 +146,8 @@ class GpioMock: public Base {
 
     /**
      * Sets GPIO line input value for testing purposes
+     *
+     * Reports an edge event if the line is initialized for them, like playInput().
      * @param newValue GPIO line input value
      */
     void setInputValue(bool newValue);
@@ -111,23 +158,141 @@ class GpioMock: public Base {
      */
     bool getValue() override;
 
+    /**
+     * Initializes GPIO line as an input with the edge detection
+     * @param eventConfig Edge detection configuration
+     */
+    void initEdgeInput(const GpioEventConfig& eventConfig) override;
+
+    /**
+     * Waits for the next injected edge event of the line
+     * @param timeout Maximal wait time, negative value waits indefinitely
+     * @return Edge event or std::nullopt if no event came within the timeout
+     * @throws std::runtime_error if the line is not initialized for the edge events
+     */
+    std::optional<GpioEvent> waitEvent(std::chrono::nanoseconds timeout) override;
+
+    /**
+     * Returns the file descriptor readable while an injected edge event is pending
+     * @return File descriptor
+     * @throws std::runtime_error if the line is not initialized for the edge events
+     */
+    int getEventFd() override;
+
+    /**
+     * Injects an edge event for testing purposes, sets the line input value accordingly
+     *
+     * Edges not matching the edge detection and edges within the debounce period after the last
+     * reported edge are dropped.
+     * @param edge Rising or falling edge
+     * @param timestamp Event timestamp
+     * @throws std::invalid_argument if the edge is not rising or falling
+     * @throws std::runtime_error if the line is not initialized for the edge events
+     */
+    void injectEvent(GpioEdge edge, std::chrono::nanoseconds timestamp);
+
     /**
      * Registers a callback for GPIO direction change
      * @param callback Callback function to be called when the GPIO direction changes
+     * @return Callback identifier
      */
-    void registerDirectionCallback(const GpioDirectionCallback& callback) {
-        this->directionCallback = callback;
-    }
+    std::size_t registerDirectionCallback(const GpioDirectionCallback& callback);
 
     /**
      * Registers a callback for GPIO value change
-     * @param callback Callback function to be called when the GPIO value changes
+     * @param callback Callback function to be called when the GPIO output value changes
+     * @return Callback identifier
+     */
+    std::size_t registerValueCallback(const GpioValueCallback& callback);
+
+    /**
+     * Unregisters a direction or value callback
+     * @param id Callback identifier
+     */
+    void unregisterCallback(std::size_t id);
+
+    /**
+     * Sets the clock timestamping the changes and timing the latencies and the input waveforms
+     *
+     * The clock has to be set before the line is used.
+     * @param newClock Mock clock, the steady clock if the hooks are not set
+     */
+    void setClock(GpioMockClock newClock);
+
+    /**
+     * Sets the latency of the line accesses
+     *
+     * The latency has to be set before the line is used.
+     * @param newLatency Line access latency
+     */
+    void setLatency(const GpioMockLatency& newLatency);
+
+    /**
+     * Returns the recorded changes of the line, the oldest first
+     * @return Line timeline
+     */
+    [[nodiscard]] std::vector<GpioTransition> getTimeline() const;
+
+    /**
+     * Clears the recorded changes of the line
+     */
+    void clearTimeline();
+
+    /**
+     * Drives the line input by the waveform timed by the mock clock
+     *
+     * Bit 0 of the step values is the input value, steps without bit 0 in the mask keep the value.
+     * Changes of a line initialized for the edge events are reported as edge events.
+     * @param steps Input waveform
+     * @return Future completed once the waveform is complete
      */
-    void registerValueCallback(const GpioValueCallback& callback) {
-        this->valueCallback = callback;
-    }
+    std::future<WaveformResult> playInput(std::vector<WaveformStep> steps);
 
  private:
+    /**
+     * Returns a copy of the mock clock taken under the mock lock
+     * @return Mock clock
+     */
+    [[nodiscard]] GpioMockClock getClock() const;
+
+    /**
+     * Returns a copy of the line access latency taken under the mock lock
+     * @return Line access latency
+     */
+    [[nodiscard]] GpioMockLatency getLatency() const;
+
+    /**
+     * Returns the current time of the mock clock, the mock lock must not be held
+     * @return Current time
+     */
+    [[nodiscard]] std::chrono::nanoseconds now() const;
+
+    /**
+     * Sleeps for the latency on the mock clock, the mock lock must not be held
+     * @param latency Access latency
+     */
+    void delay(std::chrono::nanoseconds latency) const;
+
+    /**
+     * Records the current state of the line, the mock lock has to be held
+     * @param timestamp Time of the change
+     */
+    void record(std::chrono::nanoseconds timestamp);
+
+    /**
+     * Sets the line input value, reports an edge event if the line is initialized for them
+     * @param newValue GPIO line input value
+     */
+    void driveInput(bool newValue);
+
+    /**
+     * Queues the edge event, the mock lock has to be held
+     * @param edge Rising or falling edge
+     * @param timestamp Event timestamp
+     * @return true if the event has been queued
+     */
+    bool queueEvent(GpioEdge edge, std::chrono::nanoseconds timestamp);
+
     /// GPIO configuration
     GpioConfig config;
     /// GPIO line direction
@@ -137,9 +302,33 @@ class GpioMock: public Base {
     /// GPIO line value
     bool value = false;
 
-    /// Callback for GPIO direction change
-    GpioDirectionCallback directionCallback = nullptr;
-    /// Callback for GPIO value change
-    GpioValueCallback valueCallback = nullptr;
+    /// Callbacks for GPIO direction change by their identifiers
+    std::vector<std::pair<std::size_t, GpioDirectionCallback>> directionCallbacks;
+    /// Callbacks for GPIO value change by their identifiers
+    std::vector<std::pair<std::size_t, GpioValueCallback>> valueCallbacks;
+    /// Identifier of the next registered callback
+    std::size_t nextCallbackId = 0;
+
+    /// Mock clock
+    GpioMockClock clock;
+    /// Line access latency
+    GpioMockLatency latency;
+    /// Recorded changes of the line
+    std::vector<GpioTransition> timeline;
+
+    /// Edge detection configuration, set if the line is initialized for the edge events
+    std::optional<GpioEventConfig> eventConfig;
+    /// Pending edge events
+    std::deque<GpioEvent> events;
+    /// Timestamp of the last reported edge event
+    std::optional<std::chrono::nanoseconds> lastEvent;
+    /// Pipe holding a byte per pending edge event, read end is the event file descriptor
+    int eventPipe[2] = {-1, -1};
+    /// Guards the line state, the clock and the latency
+    mutable std::mutex mutex;
+    /// Signals an injected edge event
+    std::condition_variable eventCondition;
+    /// Runs the input waveforms, created by the first one and stopped before the line is destroyed
+    std::unique_ptr<WaveformEngine> inputEngine;
 };
 }  // namespace iqrf::gpio
@@ -12,6 +12,8 @@
 #pragma once
 
 #include <iomanip>
+#include <cstddef>
+#include <optional>
 #include <string>
 
 #include "iqrf/gpio/GpioMap.h"
@@ -65,6 +67,14 @@ class GpioResolver {
      */
     void resolveGpioPin(int64_t pin, ::std::string& chip, ::std::size_t& line);  // NOLINT(runtime/references)
 
+    /**
+     * Resolves GPIO line name to line offset using the line name index of the chip
+     * @param chip GPIO chip name
+     * @param lineName GPIO line name
+     * @return Line offset or std::nullopt if the line is not indexed
+     */
+    std::optional<::std::size_t> resolveLineName(const ::std::string& chip, const ::std::string& lineName) const;
+
     /**
      * Dumps map of pin numbers and gpio chips / line numbers
      */
@@ -0,0 +1,125 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioTopologyCache.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-25
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace iqrf::gpio {
+
+/**
+ * GPIO chip record of the topology cache
+ */
+struct GpioTopologyRecord {
+    /// Device number of the chip device node
+    uint64_t device = 0;
+    /// Inode of the chip device node
+    uint64_t inode = 0;
+    /// Status change time of the chip device node, seconds
+    int64_t ctimeSec = 0;
+    /// Status change time of the chip device node, nanoseconds
+    int64_t ctimeNsec = 0;
+    /// Number of lines of the chip
+    uint64_t lineCount = 0;
+};
+
+/**
+ * GPIO topology cache statistics
+ */
+struct GpioTopologyCacheStats {
+    /// Line counts served from the cache
+    uint64_t hits = 0;
+    /// Line counts missing in the cache or invalidated
+    uint64_t misses = 0;
+};
+
+/**
+ * Persistent cache of the GPIO chip topology
+ *
+ * Holds the line counts of the GPIO chips, so the chips do not have to be opened on every process
+ * start. A record is valid as long as the chip device node has the same device number, inode and
+ * status change time, which change whenever the chip is registered again. The file is read by
+ * mmap when the cache is created and rewritten atomically whenever a record is stored.
+ *
+ * The cache is not thread-safe, the owner is responsible for locking.
+ */
+class GpioTopologyCache {
+ public:
+    /// Magic bytes of the cache file
+    static constexpr char MAGIC[4] = {'I', 'Q', 'G', 'T'};
+    /// Format version of the cache file
+    static constexpr uint32_t VERSION = 1;
+    /// Maximal length of a chip name stored in the cache
+    static constexpr std::size_t MAX_NAME_LENGTH = 31;
+
+    /**
+     * Constructor, loads the cache file if it exists and is valid
+     * @param path Cache file path
+     * @param deviceDirectory Directory of the GPIO chip device nodes
+     */
+    explicit GpioTopologyCache(std::string path, std::string deviceDirectory = "/dev");
+
+    /**
+     * Returns the cached line count of the chip if the record is still valid
+     * @param chip GPIO chip name
+     * @return Number of lines or std::nullopt if not cached or invalidated
+     */
+    std::optional<std::size_t> find(const std::string& chip);
+
+    /**
+     * Stores the line count of the chip and rewrites the cache file
+     *
+     * Failures to write the file are ignored, the cache works in memory then.
+     * @param chip GPIO chip name
+     * @param lineCount Number of lines
+     */
+    void store(const std::string& chip, std::size_t lineCount);
+
+    /**
+     * Returns the cache statistics
+     * @return Cache statistics
+     */
+    [[nodiscard]] const GpioTopologyCacheStats& getStats() const;
+
+ private:
+    /**
+     * Loads the cache file by mmap, invalid files are ignored
+     */
+    void load();
+
+    /**
+     * Writes the cache file to a temporary file and renames it over the cache file
+     * @return true if the file has been written
+     */
+    bool save() const;
+
+    /**
+     * Reads the identity of the chip device node
+     * @param chip GPIO chip name
+     * @return Record with the identity of the node or std::nullopt if the node does not exist
+     */
+    [[nodiscard]] std::optional<GpioTopologyRecord> statNode(const std::string& chip) const;
+
+    /// Cache file path
+    std::string path;
+    /// Directory of the GPIO chip device nodes
+    std::string deviceDirectory;
+    /// Records by the chip name
+    std::unordered_map<std::string, GpioTopologyRecord> records;
+    /// Cache statistics
+    GpioTopologyCacheStats stats;
+};
+
+}  // namespace iqrf::gpio
@@ -16,8 +16,14 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 #include <gpiod.hpp>
 #if BUILD_TESTS
@@ -26,14 +32,27 @@
 
 #include "iqrf/gpio/Common.h"
 #include "iqrf/gpio/Base.h"
+#include "iqrf/gpio/ChipRegistry.h"
 #include "iqrf/gpio/Config.h"
 
 namespace iqrf::gpio {
 
+/// Registry of the shared gpiod chip handles
+typedef ChipRegistry<::gpiod::chip> GpiodChipRegistry;
+
 /**
  * GPIO driver - gpiod
+ *
+ * The direction and the output value of the line are cached while the line is requested by the
+ * instance, the kernel does not let anyone else reconfigure or drive a requested line. Redundant
+ * writes are skipped and the direction of a line not requested by the instance is always queried.
+ * The cached state is guarded by a mutex, as the lines may be shared by the connectors.
+ *
+ * The v1 kernel interface supports neither the debounce period nor the hardware timestamps, the
+ * debounce period is applied in software by dropping the edges following the last reported one
+ * within the period and the kernel timestamps are used.
  */
-class Gpiod: public Base {
+class Gpiod final: public Base {
  public:
     /**
      * Constructor
@@ -73,21 +92,170 @@ class Gpiod: public Base {
 
     /**
      * Sets GPIO line output value
+     *
+     * Defined inline, so the redundant writes are skipped without a call through BasicGpio.
      * @param value GPIO line output value
      */
-    void setValue(bool value) override;
+    void setValue(bool value) override {
+        ::std::lock_guard<::std::mutex> lock(this->stateMutex);
+        if (this->line.is_requested() && this->outputValue == value) {
+            this->stats.skippedWrites++;
+            return;
+        }
+        this->writeValue(value);
+    }
 
     /**
      * Retrieves GPIO line input value
+     *
+     * Defined inline, so the cached output value is returned without a call through BasicGpio.
      * @return GPIO line input value
      */
-    bool getValue() override;
+    bool getValue() override {
+        ::std::lock_guard<::std::mutex> lock(this->stateMutex);
+        if (this->line.is_requested() && this->direction == GpioDirection::Output && this->outputValue) {
+            this->stats.valueHits++;
+            return *this->outputValue;
+        }
+        return this->readValue();
+    }
+
+    /**
+     * Initializes GPIO line as an input with the edge detection
+     * @param config Edge detection configuration
+     */
+    void initEdgeInput(const GpioEventConfig& config) override;
+
+    /**
+     * Waits for the next edge event of the line
+     *
+     * Initializing the line again waits until the pending wait returns.
+     * @param timeout Maximal wait time, negative value waits indefinitely
+     * @return Edge event or std::nullopt if no event came within the timeout
+     * @throws std::logic_error if the line is not initialized
+     */
+    std::optional<GpioEvent> waitEvent(std::chrono::nanoseconds timeout) override;
+
+    /**
+     * Returns the file descriptor of the line request, readable when an edge event is pending
+     * @return File descriptor
+     * @throws std::logic_error if the line is not initialized
+     */
+    int getEventFd() override;
+
+    /**
+     * Returns the line state cache statistics
+     * @return Line state cache statistics
+     */
+    [[nodiscard]] GpioLineStats getStats() const;
 
  private:
-    /// GPIO chip
-    ::gpiod::chip chip;
+    /**
+     * Writes the output value to the line and caches it, the state mutex has to be held
+     * @param value GPIO line output value
+     */
+    void writeValue(bool value);
+
+    /**
+     * Reads the value of the line, the state mutex has to be held
+     * @return GPIO line value
+     */
+    bool readValue();
+
+    /// GPIO chip, shared by all lines of the chip
+    std::shared_ptr<::gpiod::chip> chip;
     /// GPIO line
     ::gpiod::line line;
+    /// Debounce period of the edge events, applied in software
+    ::std::chrono::microseconds debounce{0};
+    /// Timestamp of the last reported edge event
+    ::std::optional<::std::chrono::nanoseconds> lastEvent;
+    /// Direction of the line requested by this instance
+    ::std::optional<iqrf::gpio::GpioDirection> direction;
+    /// Output value of the line requested by this instance, if known
+    ::std::optional<bool> outputValue;
+    /// Line state cache statistics
+    GpioLineStats stats;
+    /// Guards the cached state
+    mutable ::std::mutex stateMutex;
+    /// Guards the waiting for the edge events, locked before the state mutex
+    ::std::mutex eventMutex;
+    /// Name
+    ::std::string name;
+};
+
+/**
+ * GPIO driver - gpiod group of lines in a single bulk request
+ *
+ * The output values are cached like the value of a single line, the group is not thread-safe,
+ * the owner is responsible for locking.
+ */
+class GpiodGroup final: public GroupBase {
+ public:
+    /**
+     * Constructor
+     * @param configs GPIO configurations of the lines, all on the same chip
+     * @throws std::invalid_argument if the lines are not on the same chip
+     * @throws std::runtime_error for invalid chip name or line
+     */
+    explicit GpiodGroup(const std::vector<GpioConfig>& configs);
+
+    /**
+     * Destructor
+     */
+    ~GpiodGroup() override;
+
+    /**
+     * Initializes all GPIO lines as inputs
+     */
+    void initInput() override;
+
+    /**
+     * Initializes all GPIO lines as outputs
+     * @param initialValues Initial output values
+     */
+    void initOutput(uint64_t initialValues) override;
+
+    /**
+     * Sets output values of all GPIO lines at once
+     * @param values GPIO line output values
+     */
+    void setValues(uint64_t values) override;
+
+    /**
+     * Retrieves values of all GPIO lines at once
+     * @return GPIO line values
+     */
+    uint64_t getValues() override;
+
+    /**
+     * Returns the line state cache statistics
+     * @return Line state cache statistics
+     */
+    [[nodiscard]] GpioLineStats getStats() const;
+
+ private:
+    /**
+     * Returns the mask of the group lines
+     * @return Line mask
+     */
+    [[nodiscard]] uint64_t mask() const;
+
+    /**
+     * Releases the lines if they are requested
+     */
+    void release();
+
+    /// GPIO chip, shared by all lines of the chip
+    std::shared_ptr<::gpiod::chip> chip;
+    /// GPIO lines
+    ::gpiod::line_bulk lines;
+    /// Buffer of the line values
+    std::vector<int> values;
+    /// Output values of the lines requested as outputs
+    std::optional<uint64_t> outputValues;
+    /// Line state cache statistics
+    GpioLineStats stats;
     /// Name
     ::std::string name;
 };
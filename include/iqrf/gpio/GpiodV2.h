@@ -16,9 +16,17 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gpiod.hpp>
 #if BUILD_TESTS
@@ -27,14 +35,34 @@
 
 #include "iqrf/gpio/Common.h"
 #include "iqrf/gpio/Base.h"
+#include "iqrf/gpio/ChipRegistry.h"
 #include "iqrf/gpio/Config.h"
 
 namespace iqrf::gpio {
 
+/// Registry of the shared gpiod chip handles
+typedef ChipRegistry<::gpiod::chip> GpiodChipRegistry;
+
+/**
+ * Callback for GPIO line information change
+ */
+typedef std::function<void(const GpioLineInfoEvent&)> GpioLineInfoCallback;
+
 /**
  * GPIO driver - gpiod
+ *
+ * The direction and the output value of the line are cached while the line is requested by the
+ * instance, the kernel does not let anyone else reconfigure or drive a requested line. Redundant
+ * writes are skipped. The cached state is guarded by a mutex, as the lines may be shared by the
+ * connectors.
+ *
+ * The direction of a line not requested by the instance is queried, unless the line information
+ * is watched. The watch caches the direction as well, each line information change event
+ * invalidates the cached state and is passed to the registered callbacks. The events are read
+ * when the direction of a line not requested by the instance is retrieved, or by
+ * readLineInfoEvents() once the watch file descriptor becomes readable.
  */
-class Gpiod: public Base {
+class Gpiod final: public Base {
  public:
     /**
      * Constructor
@@ -74,23 +102,234 @@ class Gpiod: public Base {
 
     /**
      * Sets GPIO line output value
+     *
+     * Defined inline, so the redundant writes are skipped without a call through BasicGpio.
      * @param value GPIO line output value
      */
-    void setValue(bool value) override;
+    void setValue(bool value) override {
+        ::std::lock_guard<::std::mutex> lock(this->stateMutex);
+        if (this->request && this->outputValue == value) {
+            this->stats.skippedWrites++;
+            return;
+        }
+        this->writeValue(value);
+    }
 
     /**
      * Retrieves GPIO line input value
+     *
+     * Defined inline, so the cached output value is returned without a call through BasicGpio.
      * @return GPIO line input value
      */
-    bool getValue() override;
+    bool getValue() override {
+        ::std::lock_guard<::std::mutex> lock(this->stateMutex);
+        if (this->request && this->direction == GpioDirection::Output && this->outputValue) {
+            this->stats.valueHits++;
+            return *this->outputValue;
+        }
+        return this->readValue();
+    }
+
+    /**
+     * Initializes GPIO line as an input with the edge detection
+     * @param config Edge detection configuration
+     */
+    void initEdgeInput(const GpioEventConfig& config) override;
+
+    /**
+     * Waits for the next edge event of the line
+     *
+     * Initializing the line again waits until the pending wait returns.
+     * @param timeout Maximal wait time, negative value waits indefinitely
+     * @return Edge event or std::nullopt if no event came within the timeout
+     * @throws std::logic_error if the line is not initialized
+     */
+    std::optional<GpioEvent> waitEvent(std::chrono::nanoseconds timeout) override;
+
+    /**
+     * Returns the file descriptor of the line request, readable when an edge event is pending
+     * @return File descriptor
+     * @throws std::logic_error if the line is not initialized
+     */
+    int getEventFd() override;
+
+    /**
+     * Starts watching the line information changes, does nothing if the line is already watched
+     *
+     * The watch uses its own chip handle, the events of the handle shared by the lines would be
+     * read by any of them.
+     * @throws std::system_error if the chip cannot be opened or the line cannot be watched
+     */
+    void watchLineInfo();
+
+    /**
+     * Registers a callback for the line information changes, starts watching the line
+     * @param callback Callback function to be called when the line is requested, released or
+     *                 reconfigured, including the changes made by this instance
+     * @return Callback identifier
+     */
+    std::size_t registerLineInfoCallback(const GpioLineInfoCallback& callback);
+
+    /**
+     * Unregisters the line information callback
+     * @param id Callback identifier
+     */
+    void unregisterLineInfoCallback(std::size_t id);
+
+    /**
+     * Returns the file descriptor of the line information watch, readable when an event is pending
+     * @return File descriptor
+     * @throws std::logic_error if the line is not watched
+     */
+    int getLineInfoFd();
+
+    /**
+     * Reads the pending line information change events
+     *
+     * Each event invalidates the cached state and is passed to the registered callbacks, the
+     * callbacks are called without holding the state mutex.
+     * @param timeout Maximal wait time for the first event, zero does not wait, negative value
+     *                waits indefinitely
+     * @return Number of the events read
+     * @throws std::logic_error if the line is not watched
+     */
+    std::size_t readLineInfoEvents(std::chrono::nanoseconds timeout = std::chrono::nanoseconds(0));
+
+    /**
+     * Returns the line state cache statistics
+     * @return Line state cache statistics
+     */
+    [[nodiscard]] GpioLineStats getStats() const;
 
  private:
-    /// GPIO chip
-    std::unique_ptr<::gpiod::chip> chip;
+    /**
+     * Reads the pending line information change events and invalidates the cached state, the
+     * state mutex has to be held
+     * @return Line information change events
+     */
+    std::vector<GpioLineInfoEvent> drainLineInfoEvents();
+
+    /**
+     * Passes the line information change events to the registered callbacks
+     * @param events Line information change events
+     */
+    void notifyLineInfo(const std::vector<GpioLineInfoEvent>& events);
+
+    /**
+     * Writes the output value to the line and caches it, the state mutex has to be held
+     * @param value GPIO line output value
+     */
+    void writeValue(bool value);
+
+    /**
+     * Reads the value of the line, the state mutex has to be held
+     * @return GPIO line value
+     */
+    bool readValue();
+
+    /// GPIO chip, shared by all lines of the chip
+    std::shared_ptr<::gpiod::chip> chip;
     /// GPIO line
     ::gpiod::line::offset line;
     /// Request
     std::unique_ptr<::gpiod::line_request> request;
+    /// Edge events read from the request
+    ::gpiod::edge_event_buffer events;
+    /// Number of the events in the buffer
+    ::std::size_t eventCount = 0;
+    /// Index of the next event to return from the buffer
+    ::std::size_t eventIndex = 0;
+    /// Direction of the line requested by this instance or reported by the line information watch
+    ::std::optional<iqrf::gpio::GpioDirection> direction;
+    /// Output value of the line requested by this instance, if known
+    ::std::optional<bool> outputValue;
+    /// Path of the GPIO chip device
+    ::std::filesystem::path chipPath;
+    /// Chip handle watching the line information, if watched
+    std::unique_ptr<::gpiod::chip> infoChip;
+    /// Line information callbacks by their identifiers
+    ::std::vector<::std::pair<::std::size_t, GpioLineInfoCallback>> infoCallbacks;
+    /// Next callback identifier
+    ::std::size_t nextCallbackId = 0;
+    /// Line state cache statistics
+    GpioLineStats stats;
+    /// Guards the cached state
+    mutable ::std::mutex stateMutex;
+    /// Guards the waiting for the edge events, locked before the state mutex
+    ::std::mutex eventMutex;
+    /// Name
+    ::std::string name;
+};
+
+/**
+ * GPIO driver - gpiod group of lines in a single line request
+ *
+ * The output values are cached like the value of a single line, the group is not thread-safe,
+ * the owner is responsible for locking.
+ */
+class GpiodGroup final: public GroupBase {
+ public:
+    /**
+     * Constructor
+     * @param configs GPIO configurations of the lines, all on the same chip
+     * @throws std::invalid_argument if the lines are not on the same chip
+     * @throws std::system_error for invalid chip name
+     */
+    explicit GpiodGroup(const std::vector<GpioConfig>& configs);
+
+    /**
+     * Destructor
+     */
+    ~GpiodGroup() override;
+
+    /**
+     * Initializes all GPIO lines as inputs
+     */
+    void initInput() override;
+
+    /**
+     * Initializes all GPIO lines as outputs
+     * @param initialValues Initial output values
+     */
+    void initOutput(uint64_t initialValues) override;
+
+    /**
+     * Sets output values of all GPIO lines at once
+     * @param values GPIO line output values
+     */
+    void setValues(uint64_t values) override;
+
+    /**
+     * Retrieves values of all GPIO lines at once
+     * @return GPIO line values
+     */
+    uint64_t getValues() override;
+
+    /**
+     * Returns the line state cache statistics
+     * @return Line state cache statistics
+     */
+    [[nodiscard]] GpioLineStats getStats() const;
+
+ private:
+    /**
+     * Returns the mask of the group lines
+     * @return Line mask
+     */
+    [[nodiscard]] uint64_t mask() const;
+
+    /// GPIO chip, shared by all lines of the chip
+    std::shared_ptr<::gpiod::chip> chip;
+    /// GPIO line offsets
+    ::gpiod::line::offsets offsets;
+    /// Request of all lines
+    std::unique_ptr<::gpiod::line_request> request;
+    /// Buffer of the line values
+    ::gpiod::line::values values;
+    /// Output values of the lines requested as outputs
+    ::std::optional<uint64_t> outputValues;
+    /// Line state cache statistics
+    GpioLineStats stats;
     /// Name
     ::std::string name;
 };
@@ -0,0 +1,169 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: Waveform.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-26
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iqrf::gpio {
+
+/**
+ * Step of a GPIO waveform
+ *
+ * Values of the lines are passed as a bit mask, bit N belongs to the N-th line, e.g. of a GpioGroup.
+ */
+struct WaveformStep {
+    /// GPIO line output values
+    uint64_t values = 0;
+    /// Lines set by the step, the other lines keep their values
+    uint64_t mask = 0;
+    /// Time the values are held for before the next step is applied
+    std::chrono::nanoseconds hold{0};
+};
+
+/**
+ * Time source of a waveform
+ *
+ * The hooks measure the time since an arbitrary epoch. If not set, the monotonic clock is used
+ * and the engine sleeps by clock_nanosleep() with an absolute deadline, so the sleeps do not
+ * accumulate the scheduling latency of the previous steps.
+ */
+struct WaveformTimer {
+    /// Returns the current time
+    std::function<std::chrono::nanoseconds()> now;
+    /// Blocks the calling thread until the deadline
+    std::function<void(std::chrono::nanoseconds)> sleepUntil;
+};
+
+/**
+ * GPIO waveform
+ */
+struct Waveform {
+    /// Writes the step values to the GPIO lines
+    typedef std::function<void(uint64_t values, uint64_t mask)> Writer;
+
+    /// Steps applied one after another
+    std::vector<WaveformStep> steps;
+    /// Writes the step values to the GPIO lines
+    Writer writer;
+    /// Time source, the monotonic clock if not set
+    WaveformTimer timer;
+};
+
+/**
+ * Timing of a completed GPIO waveform
+ */
+struct WaveformResult {
+    /// Lateness of each step, the time the step has been written at minus its scheduled time
+    std::vector<std::chrono::nanoseconds> jitter;
+    /// Maximal lateness of the steps
+    std::chrono::nanoseconds maxJitter{0};
+    /// Whether the waveform has been run with the real-time scheduling policy
+    bool realtime = false;
+};
+
+/**
+ * GPIO waveform engine configuration
+ */
+struct WaveformConfig {
+    /// Run the timer thread with the SCHED_FIFO scheduling policy, requires CAP_SYS_NICE
+    bool realtime = false;
+    /// SCHED_FIFO priority of the timer thread
+    int priority = 50;
+};
+
+/**
+ * Engine running GPIO waveforms on a dedicated timer thread
+ *
+ * Waveforms are run one after another in the order they have been submitted. The deadline of each
+ * step is computed from the start of the waveform, so a late step does not delay the following
+ * steps. The waveform is complete once the hold time of its last step has elapsed.
+ *
+ * The timer thread is started by the first submitted waveform. If the real-time scheduling policy
+ * is requested but cannot be set, the waveforms are run with the default policy and the results
+ * report it.
+ */
+class WaveformEngine {
+ public:
+    /**
+     * Constructor
+     * @param config Engine configuration
+     */
+    explicit WaveformEngine(WaveformConfig config = WaveformConfig());
+
+    /**
+     * Destructor, stops the timer thread once the running waveform is complete
+     *
+     * Futures of the waveforms which have not been started report std::future_error.
+     */
+    ~WaveformEngine();
+
+    WaveformEngine(const WaveformEngine&) = delete;
+    WaveformEngine& operator=(const WaveformEngine&) = delete;
+
+    /**
+     * Queues the waveform to be run on the timer thread
+     *
+     * An exception thrown by the writer aborts the waveform and is reported by the future.
+     * @param waveform GPIO waveform
+     * @return Future completed once the waveform is complete
+     * @throws std::invalid_argument if the waveform has no writer
+     */
+    std::future<WaveformResult> submit(Waveform waveform);
+
+ private:
+    /**
+     * Queued waveform
+     */
+    struct Job {
+        /// GPIO waveform
+        Waveform waveform;
+        /// Completes the future of the waveform
+        std::promise<WaveformResult> promise;
+    };
+
+    /**
+     * Timer thread body
+     */
+    void run();
+
+    /**
+     * Runs the waveform
+     * @param waveform GPIO waveform
+     * @return Waveform timing
+     */
+    WaveformResult play(const Waveform& waveform) const;
+
+    /// Engine configuration
+    WaveformConfig config;
+    /// Queued waveforms
+    std::deque<Job> jobs;
+    /// Whether the timer thread is being stopped
+    bool stopping = false;
+    /// Whether the real-time scheduling policy has been set for the timer thread
+    bool realtime = false;
+    /// Guards the queue
+    std::mutex mutex;
+    /// Signals a queued waveform or stopping
+    std::condition_variable condition;
+    /// Timer thread
+    std::thread worker;
+};
+
+}  // namespace iqrf::gpio
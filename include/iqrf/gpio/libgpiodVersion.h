@@ -0,0 +1,7 @@
+#pragma once
+
+#define libgpiod_VERSION "2.1.0"
+#define libgpiod_VERSION_MAJOR 2
+#define libgpiod_VERSION_MINOR 1
+#define libgpiod_VERSION_PATCH 0
+#define libgpiod_VERSION_EXT ""
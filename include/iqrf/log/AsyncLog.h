@@ -0,0 +1,192 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: AsyncLog.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-27
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "iqrf/log/Logging.h"
+
+namespace iqrf::log {
+
+/**
+ * Handling of the messages logged while the queue is full.
+ */
+enum class OverflowPolicy {
+    /// Drop the message and count it, the logging thread never waits
+    Drop,
+    /// Wait until the background thread makes room for the message
+    Block,
+};
+
+/**
+ * Asynchronous log configuration.
+ */
+struct AsyncLogConfig {
+    /// Number of queued messages, rounded up to a power of two
+    std::size_t capacity = 4096;
+    /// Handling of the messages logged while the queue is full
+    OverflowPolicy overflow = OverflowPolicy::Drop;
+    /// Maximal number of messages written to the sink at once
+    std::size_t maxBatch = 256;
+};
+
+/**
+ * Asynchronous log statistics.
+ */
+struct AsyncLogStats {
+    /// Number of messages written to the sink
+    uint64_t written = 0;
+    /// Number of messages dropped because the queue was full
+    uint64_t dropped = 0;
+    /// Number of batches written to the sink
+    uint64_t batches = 0;
+};
+
+/**
+ * Log writing the messages to another log on a background thread.
+ *
+ * The logging threads copy the message into a slot of a bounded lock-free queue, the background
+ * thread passes the queued messages of the same severity to the sink at once by
+ * ILog::appendBatch(), each of them remains a record of its own.
+ * Fatal messages are appended synchronously: the logging thread waits until they are written.
+ * All queued messages are written before the log is destroyed.
+ *
+ * Usage:
+ * @code
+ * Logger::log = std::make_unique<AsyncLog>(std::make_unique<StderrLog>());
+ * @endcode
+ */
+class AsyncLog : public ILog {
+ public:
+    /**
+     * Constructor
+     *
+     * Starts the background thread.
+     *
+     * @param sink is the log the messages are written to.
+     * @param config is the queue configuration.
+     * @throws std::invalid_argument if the sink is null or the capacity is zero
+     */
+    explicit AsyncLog(std::unique_ptr<ILog> sink, const AsyncLogConfig &config = AsyncLogConfig());
+
+    /**
+     * Writes all queued messages and stops the background thread.
+     */
+    ~AsyncLog() override;
+
+    AsyncLog(const AsyncLog&) = delete;
+    AsyncLog& operator=(const AsyncLog&) = delete;
+
+    /**
+     * Queue the message `msg` with the Info severity level.
+     *
+     * @param msg is a message which shall be appended.
+     */
+    void append(const std::string& msg) override;
+
+    /**
+     * Queue the message `msg` with severity level `severity`.
+     *
+     * @param msg is a message which shall be appended.
+     * @param severity is the severity level of the message.
+     */
+    void append(const std::string& msg, const Level& severity) override;
+
+    /**
+     * Blocks until all messages queued before the call are written to the sink.
+     */
+    void flush();
+
+    /**
+     * Get the queue statistics.
+     *
+     * @return Queue statistics.
+     */
+    [[nodiscard]] AsyncLogStats getStats() const;
+
+ private:
+    /**
+     * Queue slot.
+     */
+    struct Slot {
+        /// Position of the message the slot is ready for, see push() and run()
+        std::atomic<std::size_t> sequence{0};
+        /// Severity level of the message
+        Level severity = Level::Info;
+        /// Message, keeps its capacity between the uses of the slot
+        std::string message;
+    };
+
+    /**
+     * Copies the message into the queue.
+     *
+     * @param msg is the message.
+     * @param severity is the severity level of the message.
+     * @return true if the message has been queued, false if it has been dropped
+     */
+    bool push(const std::string& msg, Level severity);
+
+    /**
+     * Background thread body.
+     */
+    void run();
+
+    /**
+     * Wakes up the background thread if it is waiting for messages.
+     */
+    void wake();
+
+    /// Log the messages are written to
+    std::unique_ptr<ILog> sink;
+    /// Handling of the messages logged while the queue is full
+    const OverflowPolicy overflow;
+    /// Maximal number of messages written to the sink at once
+    const std::size_t maxBatch;
+    /// Queue slots, the number of slots is a power of two
+    std::vector<Slot> slots;
+    /// Mask of the slot index
+    const std::size_t mask;
+    /// Position of the next queued message
+    std::atomic<std::size_t> enqueuePosition{0};
+    /// Position of the next message written by the background thread
+    std::size_t dequeuePosition = 0;
+    /// Number of positions written to the sink, messages are written in the order of their positions
+    std::atomic<std::size_t> writtenPosition{0};
+    /// Number of dropped messages
+    std::atomic<uint64_t> dropped{0};
+    /// Number of written messages
+    std::atomic<uint64_t> written{0};
+    /// Number of written batches
+    std::atomic<uint64_t> batches{0};
+    /// Whether the background thread is waiting for messages
+    std::atomic<bool> idle{false};
+    /// Whether the background thread is being stopped
+    std::atomic<bool> stopping{false};
+    /// Guards the waiting of the background thread and the flushing threads
+    std::mutex mutex;
+    /// Signals queued messages or stopping to the background thread
+    std::condition_variable queued;
+    /// Signals written messages to the flushing threads
+    std::condition_variable flushed;
+    /// Background thread
+    std::thread worker;
+};
+
+}  // namespace iqrf::log
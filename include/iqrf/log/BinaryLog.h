@@ -0,0 +1,430 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: BinaryLog.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-28
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "iqrf/log/Logging.h"
+
+/**
+ * Binary logging macro.
+ *
+ * Only the identifier of the call site and the raw argument bytes are recorded at the call site,
+ * the message is formatted later by the background thread of the running BinaryLog or offline by
+ * BinaryLogDecoder. Each `{}` in the format is replaced by the next argument. The message is
+ * formatted immediately and appended to Logger::log if no binary log is running.
+ *
+ * The level has to be a constant expression.
+ *
+ * Usage:
+ * @code
+ * IQRF_BLOG(Level::Debug, "Frame received: {} ({} B)", hexBytes(frame), frame.size());
+ * @endcode
+ */
+#define IQRF_BLOG(level, format, ...)                                              \
+    if (!::iqrf::log::isCompiledIn(level)                                          \
+        || IQRF_LOG_LIKELY((level) > ::iqrf::log::Logger::logLevel))               \
+        ;                                                                          \
+    else                                                                           \
+        ::iqrf::log::BinaryLog::write([] {                                         \
+            static const uint32_t formatId = ::iqrf::log::BinaryLog::registerFormat( \
+                {(level), (format), __FILENAME__, __LINE__});                      \
+            return formatId;                                                       \
+        }(), ##__VA_ARGS__)
+
+namespace iqrf::log {
+
+/**
+ * Static description of a binary logging call site.
+ */
+struct BinaryFormat {
+    /// Severity level of the messages
+    Level level;
+    /// Message format, `{}` is replaced by the next argument
+    const char *format;
+    /// Source file name
+    const char *file;
+    /// Source line
+    int line;
+};
+
+/**
+ * Bytes logged as a hex dump, e.g. a frame.
+ */
+struct HexBytes {
+    /// First byte
+    const uint8_t *data;
+    /// Number of bytes
+    std::size_t size;
+};
+
+/**
+ * Wrap the bytes to be logged as a hex dump.
+ *
+ * @param bytes are the bytes, have to be alive until the statement ends.
+ *
+ * @return Hex dump argument.
+ */
+inline HexBytes hexBytes(const std::vector<uint8_t>& bytes) {
+    return HexBytes{bytes.data(), bytes.size()};
+}
+
+/**
+ * Wrap the bytes to be logged as a hex dump.
+ *
+ * @param data is the first byte.
+ * @param size is the number of bytes.
+ *
+ * @return Hex dump argument.
+ */
+inline HexBytes hexBytes(const uint8_t *data, const std::size_t size) {
+    return HexBytes{data, size};
+}
+
+/**
+ * Type of a recorded argument.
+ */
+enum class BinaryArgument : uint8_t {
+    /// int64_t
+    Signed = 'i',
+    /// uint64_t
+    Unsigned = 'u',
+    /// double
+    Floating = 'f',
+    /// uint8_t, 0 or 1
+    Boolean = 'b',
+    /// char
+    Character = 'c',
+    /// uint32_t length and the characters
+    String = 's',
+    /// uint32_t length and the bytes
+    Bytes = 'x',
+};
+
+/**
+ * Encoder of the recorded arguments.
+ *
+ * Values are stored in the native byte order.
+ */
+class BinaryEncoder {
+ public:
+    /**
+     * Constructor
+     *
+     * @param output is the buffer the arguments are appended to.
+     */
+    explicit BinaryEncoder(std::vector<uint8_t>& output): output(output) {}
+
+    /**
+     * Append the argument.
+     *
+     * @param value is the argument.
+     */
+    template<typename T>
+    void encode(const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            this->tag(BinaryArgument::Boolean);
+            this->put(static_cast<uint8_t>(value));
+        } else if constexpr (std::is_same_v<T, char>) {
+            this->tag(BinaryArgument::Character);
+            this->put(value);
+        } else if constexpr (std::is_enum_v<T>) {
+            this->encode(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            this->tag(BinaryArgument::Signed);
+            this->put(static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<T>) {
+            this->tag(BinaryArgument::Unsigned);
+            this->put(static_cast<uint64_t>(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            this->tag(BinaryArgument::Floating);
+            this->put(static_cast<double>(value));
+        } else if constexpr (std::is_same_v<T, HexBytes>) {
+            this->tag(BinaryArgument::Bytes);
+            this->put(static_cast<uint32_t>(value.size));
+            this->output.insert(this->output.end(), value.data, value.data + value.size);
+        } else {
+            static_assert(std::is_convertible_v<const T&, std::string_view>, "Unsupported binary log argument");
+            const std::string_view text(value);
+            this->tag(BinaryArgument::String);
+            this->put(static_cast<uint32_t>(text.size()));
+            this->output.insert(this->output.end(), text.begin(), text.end());
+        }
+    }
+
+ private:
+    /**
+     * Append the argument type.
+     *
+     * @param type is the argument type.
+     */
+    void tag(const BinaryArgument type) {
+        this->output.push_back(static_cast<uint8_t>(type));
+    }
+
+    /**
+     * Append the raw bytes of the value.
+     *
+     * @param value is the value.
+     */
+    template<typename T>
+    void put(const T value) {
+        const std::size_t offset = this->output.size();
+        this->output.resize(offset + sizeof(T));
+        std::memcpy(this->output.data() + offset, &value, sizeof(T));
+    }
+
+    /// Buffer the arguments are appended to
+    std::vector<uint8_t>& output;
+};
+
+/**
+ * Binary log configuration.
+ */
+struct BinaryLogConfig {
+    /// Maximal number of bytes buffered by a thread, further records are dropped
+    std::size_t threadBufferSize = 64 * 1024;
+    /// Period of collecting the records from the thread buffers
+    std::chrono::milliseconds interval{10};
+};
+
+/**
+ * Binary log statistics.
+ */
+struct BinaryLogStats {
+    /// Number of records written to the output
+    uint64_t records = 0;
+    /// Number of records dropped because a thread buffer was full
+    uint64_t dropped = 0;
+};
+
+/**
+ * Collector of the binary log records.
+ *
+ * Each logging thread appends the records to a buffer of its own, the background thread collects
+ * the buffers periodically, orders the records by their timestamps and either formats them into
+ * the text log, or writes them with the formats of their call sites to a binary stream decoded by
+ * BinaryLogDecoder. A single binary log may run at once, the records are collected until it is
+ * destroyed.
+ */
+class BinaryLog {
+ public:
+    /**
+     * Constructor
+     *
+     * Formats the records into the text log on the background thread.
+     *
+     * @param sink is the log the formatted messages are appended to.
+     * @param config is the binary log configuration.
+     * @throws std::invalid_argument if the sink is null
+     * @throws std::logic_error if another binary log is running
+     */
+    explicit BinaryLog(std::unique_ptr<ILog> sink, const BinaryLogConfig& config = BinaryLogConfig());
+
+    /**
+     * Constructor
+     *
+     * Writes the records to the binary stream on the background thread.
+     *
+     * @param output is the binary stream, e.g. a std::ofstream opened in the binary mode.
+     * @param config is the binary log configuration.
+     * @throws std::invalid_argument if the output is null
+     * @throws std::logic_error if another binary log is running
+     */
+    explicit BinaryLog(std::unique_ptr<std::ostream> output, const BinaryLogConfig& config = BinaryLogConfig());
+
+    /**
+     * Collects the remaining records and stops the background thread.
+     */
+    ~BinaryLog();
+
+    BinaryLog(const BinaryLog&) = delete;
+    BinaryLog& operator=(const BinaryLog&) = delete;
+
+    /**
+     * Blocks until the records logged before the call are written.
+     */
+    void flush();
+
+    /**
+     * Get the binary log statistics.
+     *
+     * @return Binary log statistics.
+     */
+    [[nodiscard]] BinaryLogStats getStats() const;
+
+    /**
+     * Register the call site.
+     *
+     * @param format is the call site description, the strings have to be static.
+     *
+     * @return Format identifier.
+     *
+     * @details Preferred use is via the IQRF_BLOG macro.
+     */
+    static uint32_t registerFormat(const BinaryFormat& format);
+
+    /**
+     * Get the registered call site.
+     *
+     * @param id is the format identifier.
+     *
+     * @return Call site description.
+     * @throws std::out_of_range if the format is not registered
+     */
+    static BinaryFormat getFormat(uint32_t id);
+
+    /**
+     * Record the message.
+     *
+     * @param id is the format identifier.
+     * @param args are the message arguments.
+     *
+     * @details Preferred use is via the IQRF_BLOG macro.
+     */
+    template<typename... Args>
+    static void write(const uint32_t id, const Args&... args) {
+        thread_local std::vector<uint8_t> arguments;
+        arguments.clear();
+        BinaryEncoder encoder(arguments);
+        (encoder.encode(args), ...);
+        BinaryLog::commit(id, arguments);
+    }
+
+ private:
+    /**
+     * Record of a thread buffer.
+     */
+    struct Record {
+        /// Timestamp of the steady clock
+        uint64_t timestamp;
+        /// Format identifier
+        uint32_t id;
+        /// Encoded arguments
+        std::vector<uint8_t> arguments;
+    };
+
+    /**
+     * Append the record to the buffer of the calling thread, or format it to Logger::log if no
+     * binary log is running.
+     *
+     * @param id is the format identifier.
+     * @param arguments are the encoded arguments.
+     */
+    static void commit(uint32_t id, const std::vector<uint8_t>& arguments);
+
+    /**
+     * Append the record to the buffer of the calling thread.
+     *
+     * @param id is the format identifier.
+     * @param arguments are the encoded arguments.
+     *
+     * @return false if the binary log has stopped, the record is not appended then.
+     */
+    static bool append(uint32_t id, const std::vector<uint8_t>& arguments);
+
+    /**
+     * Start collecting the records.
+     *
+     * @param config is the binary log configuration.
+     */
+    void start(const BinaryLogConfig& config);
+
+    /**
+     * Background thread body.
+     */
+    void run();
+
+    /**
+     * Collect the thread buffers and write their records.
+     */
+    void collect();
+
+    /**
+     * Write the record to the binary stream.
+     *
+     * @param record is the record.
+     */
+    void writeRecord(const Record& record);
+
+    /// Log the formatted messages are appended to, null in the binary mode
+    std::unique_ptr<ILog> sink;
+    /// Binary stream, null in the text mode
+    std::unique_ptr<std::ostream> output;
+    /// Formats already written to the binary stream
+    std::vector<bool> writtenFormats;
+    /// Period of collecting the records
+    std::chrono::milliseconds interval{10};
+    /// Dropped records counter at the start
+    uint64_t droppedAtStart = 0;
+    /// Number of written records
+    uint64_t records = 0;
+    /// Number of requested collections
+    uint64_t requested = 0;
+    /// Number of finished collections
+    uint64_t finished = 0;
+    /// Whether the background thread is being stopped
+    bool stopping = false;
+    /// Guards the collection state
+    mutable std::mutex mutex;
+    /// Signals a requested collection or stopping
+    std::condition_variable wake;
+    /// Signals a finished collection
+    std::condition_variable collected;
+    /// Background thread
+    std::thread worker;
+};
+
+/**
+ * Decoder of the binary log.
+ */
+class BinaryLogDecoder {
+ public:
+    /**
+     * Format the message as IQRF_LOG would.
+     *
+     * @param format is the call site description.
+     * @param arguments are the encoded arguments.
+     * @param size is the number of bytes of the encoded arguments.
+     *
+     * @return Message ending with a new line.
+     * @throws std::runtime_error if the arguments are malformed
+     */
+    static std::string format(const BinaryFormat& format, const uint8_t *arguments, std::size_t size);
+
+    /**
+     * Decode the binary stream written by BinaryLog.
+     *
+     * @param input is the binary stream.
+     * @param output is the text output.
+     * @param timestamps is whether the messages are prefixed by their steady clock timestamps.
+     *
+     * @return Number of decoded messages.
+     * @throws std::runtime_error if the stream is malformed
+     */
+    static std::size_t decode(std::istream& input, std::ostream& output, bool timestamps = true);
+};
+
+}  // namespace iqrf::log
@@ -0,0 +1,156 @@
+/**
+ * Copyright 2023-2025 MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: Hex.h
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-29
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace iqrf::log {
+
+/// Separator of the bytes in a hex dump, e.g. `00.1f.ff`
+constexpr char HexSeparator = '.';
+
+/// No separator of the bytes in a hex dump, e.g. `001fff`
+constexpr char NoHexSeparator = '\0';
+
+/**
+ * Get the length of a hex dump.
+ *
+ * @param size is the number of bytes.
+ * @param separator is the separator of the bytes, NoHexSeparator for none.
+ *
+ * @return Number of characters of the hex dump.
+ */
+constexpr std::size_t hexLength(const std::size_t size, const char separator = HexSeparator) {
+    if (size == 0) {
+        return 0;
+    }
+    return separator == NoHexSeparator ? 2 * size : 3 * size - 1;
+}
+
+/**
+ * Write the lowercase hex dump of the bytes.
+ *
+ * Long buffers are encoded by SIMD instructions if the CPU supports them, see toHexScalar().
+ *
+ * @param data is the first byte.
+ * @param size is the number of bytes.
+ * @param output is the output buffer of at least hexLength(size, separator) characters, no null
+ *               terminator is written.
+ * @param separator is the separator of the bytes, NoHexSeparator for none.
+ *
+ * @return Pointer past the last written character.
+ */
+char *toHex(const uint8_t *data, std::size_t size, char *output, char separator = HexSeparator);
+
+/**
+ * Write the lowercase hex dump of the bytes using a lookup table only.
+ *
+ * @param data is the first byte.
+ * @param size is the number of bytes.
+ * @param output is the output buffer of at least hexLength(size, separator) characters, no null
+ *               terminator is written.
+ * @param separator is the separator of the bytes, NoHexSeparator for none.
+ *
+ * @return Pointer past the last written character.
+ */
+char *toHexScalar(const uint8_t *data, std::size_t size, char *output, char separator = HexSeparator);
+
+/**
+ * Append the lowercase hex dump of the bytes to the string.
+ *
+ * @param output is the string.
+ * @param data is the first byte.
+ * @param size is the number of bytes.
+ * @param separator is the separator of the bytes, NoHexSeparator for none.
+ */
+void appendHex(std::string& output, const uint8_t *data, std::size_t size, char separator = HexSeparator);
+
+/**
+ * Get the lowercase hex dump of the bytes.
+ *
+ * @param data are the bytes.
+ * @param separator is the separator of the bytes, NoHexSeparator for none.
+ *
+ * @return Hex dump, e.g. `00.1f.ff`.
+ */
+std::string toHex(const std::vector<uint8_t>& data, char separator = HexSeparator);
+
+/**
+ * Parse the hex dump.
+ *
+ * Both letter cases are accepted. The bytes may be separated by a single `.`, `:`, `-` or a space,
+ * leading and trailing whitespace is ignored.
+ *
+ * @param text is the hex dump, e.g. `00.1F.ff` or `001fff`.
+ *
+ * @return Parsed bytes.
+ * @throws std::invalid_argument if the text is not a hex dump
+ */
+std::vector<uint8_t> hexToBytes(std::string_view text);
+
+/**
+ * Hex dump of the bytes formatted when written to a stream.
+ *
+ * The bytes are encoded straight into the stream without a temporary string, so a log statement
+ * of a disabled level costs nothing but the construction of the view.
+ *
+ * Usage:
+ * @code
+ * IQRF_LOG(Level::Debug) << "Frame: " << HexView(frame);
+ * @endcode
+ */
+class HexView {
+ public:
+    /**
+     * Constructor
+     *
+     * @param data are the bytes, have to be alive until the view is written.
+     * @param separator is the separator of the bytes, NoHexSeparator for none.
+     */
+    explicit HexView(const std::vector<uint8_t>& data, const char separator = HexSeparator):
+        data(data.data()), size(data.size()), separator(separator) {}
+
+    /**
+     * Constructor
+     *
+     * @param data is the first byte, has to be alive until the view is written.
+     * @param size is the number of bytes.
+     * @param separator is the separator of the bytes, NoHexSeparator for none.
+     */
+    HexView(const uint8_t *data, const std::size_t size, const char separator = HexSeparator):
+        data(data), size(size), separator(separator) {}
+
+    /**
+     * Write the hex dump to the stream.
+     *
+     * @param stream is the output stream.
+     * @param view is the hex dump.
+     *
+     * @return Output stream.
+     */
+    friend std::ostream& operator<<(std::ostream& stream, const HexView& view);
+
+ private:
+    /// First byte
+    const uint8_t *data;
+    /// Number of bytes
+    std::size_t size;
+    /// Separator of the bytes
+    char separator;
+};
+
+}  // namespace iqrf::log
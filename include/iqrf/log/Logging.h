@@ -12,9 +12,11 @@
 #pragma once
 
 #include <memory>
-#include <unordered_map>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 /**
  * IQRF severity levels.
@@ -29,11 +31,33 @@ X(Info, 6)               \
 X(Debug, 7)              \
 X(Trace, 10)
 
+/**
+ * Least severe level compiled in, e.g. Info removes the Debug and Trace statements.
+ *
+ * Set by the IQRF_LOG_MIN_LEVEL CMake option for the library, all levels are compiled in by default.
+ */
+#ifndef IQRF_LOG_MIN_LEVEL
+#define IQRF_LOG_MIN_LEVEL Trace
+#endif
+
+/**
+ * Branch hint for the check of the reporting level, most statements are filtered out.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define IQRF_LOG_LIKELY(condition) __builtin_expect(!!(condition), 1)
+#else
+#define IQRF_LOG_LIKELY(condition) (condition)
+#endif
+
 /**
  * Main logging macro.
+ *
+ * Statements of the levels less severe than IQRF_LOG_MIN_LEVEL are constant false conditions,
+ * removed from the binary by the optimizer.
  */
 #define IQRF_LOG(level)            \
-    if ((level) > ::iqrf::log::Logger::logLevel)  \
+    if (!::iqrf::log::isCompiledIn(level) \
+        || IQRF_LOG_LIKELY((level) > ::iqrf::log::Logger::logLevel))  \
         ;                          \
     else                           \
         iqrf::log::Logger().stream(level) << IQRF_LOG_HEADER(level)
@@ -50,7 +74,7 @@ X(Trace, 10)
  * Log header is prepended to every log message.
  */
 #ifndef IQRF_LOG_HEADER
-#define IQRF_LOG_HEADER(level) "[" << ::iqrf::log::LevelNames.at(level) << "] "
+#define IQRF_LOG_HEADER(level) "[" << ::iqrf::log::levelName(level) << "] "
 #endif
 
 /**
@@ -71,14 +95,57 @@ enum class Level {
     #undef X
 };
 
+/**
+ * Least severe level compiled in.
+ */
+constexpr Level MinLevel = Level::IQRF_LOG_MIN_LEVEL;
+
+/**
+ * Get the name of the severity level.
+ *
+ * @param level is the severity level.
+ *
+ * @return Severity level name, empty for unknown levels.
+ */
+constexpr std::string_view levelName(const Level level) noexcept {
+    switch (level) {
+        #define X(name, value) case Level::name: return #name;
+        _IQRF_LOG_LEVELS
+        #undef X
+    }
+    return {};
+}
+
 /**
  * Map of severity level names.
+ *
+ * @deprecated Kept for compatibility, use levelName() instead.
  */
-const std::unordered_map<Level, std::string> LevelNames = {
-    #define X(name, value) {Level::name, #name},
+#if defined(__GNUC__) || defined(__clang__)
+// GCC reports the definition itself as a use of the deprecated variable
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+[[deprecated("Use iqrf::log::levelName() instead")]]
+inline const std::unordered_map<Level, std::string> LevelNames = {
+    #define X(name, value) {Level::name, std::string(levelName(Level::name))},
     _IQRF_LOG_LEVELS
     #undef X
 };
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+/**
+ * Check whether the statements of the severity level are compiled in.
+ *
+ * @param level is the severity level.
+ *
+ * @return true if the level is at least as severe as IQRF_LOG_MIN_LEVEL.
+ */
+constexpr bool isCompiledIn(const Level level) noexcept {
+    return level <= MinLevel;
+}
 
 /**
  * Log interface.
@@ -106,6 +173,17 @@ class ILog {
      * @param severity is the severity level of the message.
      */
     virtual void append(const std::string& msg, const Level& severity);
+
+    /**
+     * Add the messages `msgs` with severity level `severity` to the log at once.
+     *
+     * Each message remains a record of its own, the default implementation appends them
+     * one by one. Used by the logs collecting the messages, e.g. AsyncLog.
+     *
+     * @param msgs are the messages which shall be appended.
+     * @param severity is the severity level of the messages.
+     */
+    virtual void appendBatch(const std::vector<std::string_view>& msgs, const Level& severity);
 };
 
 /**
@@ -157,8 +235,12 @@ class Logger {
  protected:
     /**
      * String stream where the log message is accumulated.
+     *
+     * The stream is owned by the thread and reused by its loggers, so a message does not construct
+     * a new stream. Nested loggers, e.g. logging from an operator<< of a logged value, use streams
+     * of their own.
      */
-    std::ostringstream buffer;
+    std::ostringstream& buffer;
 
  private:
     /**
@@ -176,6 +258,11 @@ class StderrLog : public ILog {
      * Appends the message to stderr.
      */
     void append(const std::string& msg) override;
+
+    /**
+     * Appends the messages to stderr with a single flush.
+     */
+    void appendBatch(const std::vector<std::string_view>& msgs, const Level& severity) override;
 };
 
 }  // namespace iqrf::log
@@ -0,0 +1,497 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: SimConnector.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-16
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include "iqrf/connector/sim/SimConnector.h"
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "iqrf/connector/dpa/DpaPayload.h"
+
+namespace iqrf::connector::sim {
+
+using dpa::ResponseCode;
+
+/// Length of the FRC data in the FRC response
+constexpr std::size_t FRC_DATA_SIZE = 55;
+/// Value of 0 degrees Celsius in the FRC temperature data, 0 means no response
+constexpr uint8_t FRC_ZERO_CELSIUS = 0x7F;
+
+SimConnector::SimConnector(const SimConfig &config):
+    config(config),
+    virtualClock(config.clock ? config.clock : std::make_shared<VirtualClock>()),
+    epoch(virtualClock->now()),
+    randomState(config.seed) {
+    if (config.nodeCount > dpa::MAX_NODE_ADDRESS) {
+        throw std::invalid_argument("Too many nodes in the simulated network");
+    }
+    if (config.nodesPerHop == 0) {
+        throw std::invalid_argument("Number of nodes in a routing hop has to be positive");
+    }
+    if (config.linkLoss < 0.0 || config.linkLoss > 1.0) {
+        throw std::invalid_argument("Link loss has to be a probability");
+    }
+    this->nodes.resize(dpa::MAX_NODE_ADDRESS + 1);
+    for (uint16_t address = 0; address < this->nodes.size(); ++address) {
+        SimNode &node = this->nodes[address];
+        node.address = address;
+        node.bonded = address <= config.nodeCount;
+        node.hops = address == dpa::COORDINATOR_ADDRESS
+            ? 0
+            : static_cast<uint8_t>((address - 1) / config.nodesPerHop + 1);
+        node.linkLoss = config.linkLoss;
+        node.hwpid = config.hwpid;
+        node.mid = 0x81000000 | address;
+    }
+    this->setClock(this->virtualClock);
+}
+
+SimConnector::~SimConnector() {
+    this->stopListen();
+}
+
+State SimConnector::getState() const {
+    return State::Ready;
+}
+
+std::vector<uint8_t> SimConnector::receive() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (this->events.empty()) {
+        return {};
+    }
+    if (this->events.top().time > this->elapsed()) {
+        if (!this->config.autoAdvance) {
+            return {};
+        }
+        this->virtualClock->advanceTo(this->epoch + this->events.top().time);
+    }
+    std::vector<uint8_t> frame = this->events.top().frame;
+    this->events.pop();
+    return frame;
+}
+
+TrInfo SimConnector::readTrInfo() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    const SimNode &coordinator = this->nodes[dpa::COORDINATOR_ADDRESS];
+    return TrInfo{coordinator.mid, coordinator.osVersion, coordinator.trType, coordinator.osBuild};
+}
+
+void SimConnector::resetTr() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->events = {};
+    this->rfFreeAt = this->elapsed();
+    this->nodes[dpa::COORDINATOR_ADDRESS].resets++;
+}
+
+SimConnector::Duration SimConnector::now() const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->elapsed();
+}
+
+void SimConnector::advance(const Duration duration) {
+    this->virtualClock->advance(duration);
+}
+
+VirtualClock &SimConnector::getVirtualClock() const {
+    return *this->virtualClock;
+}
+
+SimNode SimConnector::getNode(const uint16_t address) const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (address >= this->nodes.size()) {
+        throw std::out_of_range("Address is not a device address");
+    }
+    return this->nodes[address];
+}
+
+void SimConnector::updateNode(const uint16_t address, const std::function<void(SimNode&)> &modifier) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    SimNode &node = this->nodeAt(address);
+    modifier(node);
+    node.address = address;
+}
+
+SimStats SimConnector::getStats() const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->stats;
+}
+
+SimConnector::Duration SimConnector::timeslot(const std::size_t pdataLength) {
+    if (pdataLength <= 16) {
+        return std::chrono::milliseconds(40);
+    }
+    if (pdataLength <= 39) {
+        return std::chrono::milliseconds(50);
+    }
+    return std::chrono::milliseconds(60);
+}
+
+void SimConnector::send(const std::vector<uint8_t> &data) {
+    const auto request = dpa::DpaRequestView::tryParse(data);
+    if (!request.has_value()) {
+        throw std::invalid_argument("Simulated network accepts only DPA requests");
+    }
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stats.requests++;
+    const Duration start = std::max(this->elapsed(), this->rfFreeAt);
+    if (request->nadr() == dpa::COORDINATOR_ADDRESS || request->nadr() == dpa::LOCAL_ADDRESS) {
+        this->handleLocal(*request, start);
+    } else {
+        this->handleRemote(*request, start);
+    }
+}
+
+void SimConnector::schedule(const Duration time, std::vector<uint8_t> frame) {
+    this->events.push(Event{time, this->nextSequence++, std::move(frame)});
+}
+
+void SimConnector::handleLocal(const dpa::DpaRequestView &request, const Duration start) {
+    if (request.pnum() == dpa::pnum::FRC && request.pcmd() == dpa::pcmd::FRC_SEND) {
+        this->handleFrc(request, start);
+        return;
+    }
+    SimNode &coordinator = this->nodes[dpa::COORDINATOR_ADDRESS];
+    std::vector<uint8_t> pdata;
+    const ResponseCode code = this->execute(coordinator, request, pdata);
+    this->stats.responses++;
+    this->schedule(start + this->config.interfaceDelay, SimConnector::buildResponse(request, coordinator, code, pdata));
+}
+
+void SimConnector::handleRemote(const dpa::DpaRequestView &request, const Duration start) {
+    const SimNode &coordinator = this->nodes[dpa::COORDINATOR_ADDRESS];
+    const Duration confirmed = start + this->config.interfaceDelay;
+    const uint16_t nadr = request.nadr();
+    const bool broadcast = nadr == dpa::BROADCAST_ADDRESS;
+    if (!broadcast && (nadr > dpa::MAX_NODE_ADDRESS || !this->nodes[nadr].bonded)) {
+        this->stats.responses++;
+        const SimNode &target = nadr > dpa::MAX_NODE_ADDRESS ? coordinator : this->nodes[nadr];
+        this->schedule(confirmed, SimConnector::buildResponse(request, target, ResponseCode::ErrorNadr, {}));
+        return;
+    }
+
+    uint8_t hops = 0;
+    if (broadcast) {
+        for (const auto &node : this->nodes) {
+            if (node.bonded) {
+                hops = std::max(hops, node.hops);
+            }
+        }
+    } else {
+        hops = this->nodes[nadr].hops;
+    }
+    const Duration requestSlot = SimConnector::timeslot(request.pdata().size());
+    std::vector<uint8_t> confirmation(request.bytes().begin(), request.bytes().begin() + dpa::REQUEST_HEADER_SIZE);
+    confirmation.push_back(static_cast<uint8_t>(ResponseCode::StatusConfirmation));
+    confirmation.push_back(coordinator.dpaValue);
+    confirmation.push_back(hops);
+    confirmation.push_back(static_cast<uint8_t>(requestSlot / std::chrono::milliseconds(10)));
+    confirmation.push_back(broadcast ? 0 : hops);
+    this->stats.confirmations++;
+    this->schedule(confirmed, std::move(confirmation));
+
+    const Duration arrival = confirmed + (hops + 1) * requestSlot;
+    if (broadcast) {
+        for (auto &node : this->nodes) {
+            if (node.bonded && node.address != dpa::COORDINATOR_ADDRESS && this->delivered(node.hops, node.linkLoss)) {
+                std::vector<uint8_t> ignored;
+                this->execute(node, request, ignored);
+            }
+        }
+        this->rfFreeAt = arrival;
+        this->stats.rfBusyTime += arrival - confirmed;
+        return;
+    }
+
+    SimNode &node = this->nodes[nadr];
+    if (!this->delivered(hops, node.linkLoss)) {
+        // The coordinator waits for the response anyway
+        this->stats.lostRequests++;
+        this->rfFreeAt = arrival + (hops + 1) * requestSlot;
+        this->stats.rfBusyTime += this->rfFreeAt - confirmed;
+        return;
+    }
+    std::vector<uint8_t> pdata;
+    const ResponseCode code = this->execute(node, request, pdata);
+    const Duration responded = arrival + (hops + 1) * SimConnector::timeslot(pdata.size());
+    this->rfFreeAt = responded;
+    this->stats.rfBusyTime += responded - confirmed;
+    if (!this->delivered(hops, node.linkLoss)) {
+        this->stats.lostResponses++;
+        return;
+    }
+    this->stats.responses++;
+    this->schedule(responded, SimConnector::buildResponse(request, node, code, pdata));
+}
+
+void SimConnector::handleFrc(const dpa::DpaRequestView &request, const Duration start) {
+    SimNode &coordinator = this->nodes[dpa::COORDINATOR_ADDRESS];
+    coordinator.requests++;
+    const Duration confirmed = start + this->config.interfaceDelay;
+    if (request.pdata().empty()) {
+        this->stats.responses++;
+        this->schedule(confirmed, SimConnector::buildResponse(request, coordinator, ResponseCode::ErrorDataLength, {}));
+        return;
+    }
+    const uint8_t command = request.pdata()[0];
+    const bool byteFrc = command >= dpa::frc::FIRST_BYTE_COMMAND;
+    if (command != dpa::frc::PING && command != dpa::frc::TEMPERATURE) {
+        this->stats.responses++;
+        this->schedule(
+            confirmed,
+            SimConnector::buildResponse(request, coordinator, ResponseCode::ErrorNotImplemented, {})
+        );
+        return;
+    }
+
+    std::vector<uint8_t> pdata(1 + FRC_DATA_SIZE, 0);
+    uint8_t responded = 0;
+    uint8_t maxHops = 0;
+    uint32_t bonded = 0;
+    for (auto &node : this->nodes) {
+        if (!node.bonded || node.address == dpa::COORDINATOR_ADDRESS) {
+            continue;
+        }
+        bonded++;
+        maxHops = std::max(maxHops, node.hops);
+        // The FRC command travels to the node and its value back
+        if (!this->delivered(2 * static_cast<uint32_t>(node.hops), node.linkLoss)) {
+            continue;
+        }
+        node.requests++;
+        responded++;
+        uint8_t *data = pdata.data() + 1;
+        if (byteFrc) {
+            if (node.address < FRC_DATA_SIZE) {
+                data[node.address] = node.temperature == 0 ? FRC_ZERO_CELSIUS : static_cast<uint8_t>(node.temperature);
+            }
+        } else {
+            // Ping sets the first bit only, the second bits follow at offset 32
+            data[node.address / 8] |= static_cast<uint8_t>(1 << (node.address % 8));
+        }
+    }
+    pdata[0] = responded;
+
+    const Duration slot = byteFrc ? 2 * this->config.frcSlot : this->config.frcSlot;
+    const Duration duration = 2 * (maxHops + 1) * SimConnector::timeslot(0) + bonded * slot;
+    this->rfFreeAt = confirmed + duration;
+    this->stats.rfBusyTime += duration;
+    this->stats.frcRounds++;
+    this->stats.responses++;
+    this->schedule(this->rfFreeAt, SimConnector::buildResponse(request, coordinator, ResponseCode::NoError, pdata));
+}
+
+ResponseCode SimConnector::execute(SimNode &node, const dpa::DpaRequestView &request, std::vector<uint8_t> &pdata) {
+    node.requests++;
+    if (request.hwpid() != dpa::HWPID_ANY && request.hwpid() != node.hwpid) {
+        return ResponseCode::ErrorHwpid;
+    }
+    const dpa::ByteView data = request.pdata();
+    switch (request.pnum()) {
+        case dpa::pnum::COORDINATOR: {
+            if (node.address != dpa::COORDINATOR_ADDRESS) {
+                return ResponseCode::ErrorPnum;
+            }
+            if (request.pcmd() == dpa::pcmd::COORDINATOR_ADDR_INFO) {
+                const auto count = std::count_if(this->nodes.begin() + 1, this->nodes.end(),
+                    [](const SimNode &other) { return other.bonded; });
+                pdata = {static_cast<uint8_t>(count), 0x2A};
+                return ResponseCode::NoError;
+            }
+            if (request.pcmd() == dpa::pcmd::COORDINATOR_DISCOVERED_DEVICES ||
+                request.pcmd() == dpa::pcmd::COORDINATOR_BONDED_DEVICES) {
+                pdata.assign(32, 0);
+                for (const auto &other : this->nodes) {
+                    if (other.bonded && other.address != dpa::COORDINATOR_ADDRESS) {
+                        pdata[other.address / 8] |= static_cast<uint8_t>(1 << (other.address % 8));
+                    }
+                }
+                return ResponseCode::NoError;
+            }
+            return ResponseCode::ErrorPcmd;
+        }
+        case dpa::pnum::OS:
+            switch (request.pcmd()) {
+                case dpa::pcmd::OS_READ:
+                    pdata = {
+                        static_cast<uint8_t>(node.mid), static_cast<uint8_t>(node.mid >> 8),
+                        static_cast<uint8_t>(node.mid >> 16), static_cast<uint8_t>(node.mid >> 24),
+                        node.osVersion, node.trType,
+                        static_cast<uint8_t>(node.osBuild), static_cast<uint8_t>(node.osBuild >> 8),
+                        node.dpaValue, 0x35, 0x01, 0x00
+                    };
+                    return ResponseCode::NoError;
+                case dpa::pcmd::OS_RESET:
+                    node.resets++;
+                    return ResponseCode::NoError;
+                case dpa::pcmd::OS_BATCH: {
+                    std::optional<dpa::OsBatchView> batch;
+                    try {
+                        batch.emplace(request);
+                    } catch (const std::invalid_argument &) {
+                        return ResponseCode::ErrorData;
+                    }
+                    for (const auto &entry : *batch) {
+                        std::vector<uint8_t> embedded = {
+                            static_cast<uint8_t>(request.nadr()), static_cast<uint8_t>(request.nadr() >> 8),
+                            entry.pnum, entry.pcmd,
+                            static_cast<uint8_t>(entry.hwpid), static_cast<uint8_t>(entry.hwpid >> 8)
+                        };
+                        embedded.insert(embedded.end(), entry.pdata.begin(), entry.pdata.end());
+                        std::vector<uint8_t> ignored;
+                        this->execute(node, dpa::DpaRequestView(embedded), ignored);
+                    }
+                    return ResponseCode::NoError;
+                }
+                default:
+                    return ResponseCode::ErrorPcmd;
+            }
+        case dpa::pnum::EEPROM:
+            return SimConnector::executeMemory(node.eeprom.data(), node.eeprom.size(), request, pdata);
+        case dpa::pnum::RAM:
+            return SimConnector::executeMemory(node.ram.data(), node.ram.size(), request, pdata);
+        case dpa::pnum::LEDR:
+        case dpa::pnum::LEDG: {
+            bool &led = request.pnum() == dpa::pnum::LEDR ? node.ledr : node.ledg;
+            switch (request.pcmd()) {
+                case dpa::pcmd::LED_SET_OFF:
+                    led = false;
+                    return ResponseCode::NoError;
+                case dpa::pcmd::LED_SET_ON:
+                    led = true;
+                    return ResponseCode::NoError;
+                case dpa::pcmd::LED_PULSE:
+                case dpa::pcmd::LED_FLASHING:
+                    return ResponseCode::NoError;
+                default:
+                    return ResponseCode::ErrorPcmd;
+            }
+        }
+        case dpa::pnum::IO: {
+            if (request.pcmd() == dpa::pcmd::IO_GET) {
+                pdata.assign(node.ioOutput.begin(), node.ioOutput.end());
+                return ResponseCode::NoError;
+            }
+            if (request.pcmd() != dpa::pcmd::IO_DIRECTION && request.pcmd() != dpa::pcmd::IO_SET) {
+                return ResponseCode::ErrorPcmd;
+            }
+            if (data.size() % 3 != 0) {
+                return ResponseCode::ErrorDataLength;
+            }
+            const dpa::IoTripletsView triplets(request);
+            auto &ports = request.pcmd() == dpa::pcmd::IO_DIRECTION ? node.ioDirection : node.ioOutput;
+            for (std::size_t i = 0; i < triplets.size(); ++i) {
+                const dpa::IoTriplet triplet = triplets.at(i);
+                if (triplet.port >= ports.size()) {
+                    // Delays and unknown ports are ignored
+                    continue;
+                }
+                ports[triplet.port] = (ports[triplet.port] & ~triplet.mask) | (triplet.value & triplet.mask);
+            }
+            return ResponseCode::NoError;
+        }
+        case dpa::pnum::THERMOMETER: {
+            if (request.pcmd() != dpa::pcmd::THERMOMETER_READ) {
+                return ResponseCode::ErrorPcmd;
+            }
+            const auto sixteenths = static_cast<uint16_t>(node.temperature * 16);
+            pdata = {
+                static_cast<uint8_t>(node.temperature),
+                static_cast<uint8_t>(sixteenths),
+                static_cast<uint8_t>(sixteenths >> 8)
+            };
+            return ResponseCode::NoError;
+        }
+        default:
+            return ResponseCode::ErrorPnum;
+    }
+}
+
+ResponseCode SimConnector::executeMemory(
+    uint8_t *memory,
+    const std::size_t size,
+    const dpa::DpaRequestView &request,
+    std::vector<uint8_t> &pdata
+) {
+    const dpa::ByteView data = request.pdata();
+    switch (request.pcmd()) {
+        case dpa::pcmd::MEMORY_READ: {
+            if (data.size() != 2 || data[1] > dpa::MAX_PDATA_SIZE) {
+                return ResponseCode::ErrorDataLength;
+            }
+            if (static_cast<std::size_t>(data[0]) + data[1] > size) {
+                return ResponseCode::ErrorAddress;
+            }
+            pdata.assign(memory + data[0], memory + data[0] + data[1]);
+            return ResponseCode::NoError;
+        }
+        case dpa::pcmd::MEMORY_WRITE: {
+            if (data.empty()) {
+                return ResponseCode::ErrorDataLength;
+            }
+            if (data[0] + data.size() - 1 > size) {
+                return ResponseCode::ErrorAddress;
+            }
+            std::copy(data.begin() + 1, data.end(), memory + data[0]);
+            return ResponseCode::NoError;
+        }
+        default:
+            return ResponseCode::ErrorPcmd;
+    }
+}
+
+std::vector<uint8_t> SimConnector::buildResponse(
+    const dpa::DpaRequestView &request,
+    const SimNode &node,
+    const ResponseCode code,
+    const std::vector<uint8_t> &pdata
+) {
+    std::vector<uint8_t> response = {
+        static_cast<uint8_t>(request.nadr()), static_cast<uint8_t>(request.nadr() >> 8),
+        request.pnum(), static_cast<uint8_t>(request.pcmd() | dpa::RESPONSE_FLAG),
+        static_cast<uint8_t>(node.hwpid), static_cast<uint8_t>(node.hwpid >> 8),
+        static_cast<uint8_t>(code), node.dpaValue
+    };
+    response.insert(response.end(), pdata.begin(), pdata.end());
+    return response;
+}
+
+bool SimConnector::delivered(const uint32_t hops, const double linkLoss) {
+    if (linkLoss <= 0.0) {
+        return true;
+    }
+    for (uint32_t hop = 0; hop < hops; ++hop) {
+        // SplitMix64, the same sequence on every platform
+        uint64_t value = (this->randomState += 0x9E3779B97F4A7C15ULL);
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        value ^= value >> 31;
+        if (static_cast<double>(value >> 11) * 0x1.0p-53 < linkLoss) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SimConnector::Duration SimConnector::elapsed() const {
+    return std::chrono::duration_cast<Duration>(this->virtualClock->now() - this->epoch);
+}
+
+SimNode &SimConnector::nodeAt(const uint16_t address) {
+    if (address >= this->nodes.size()) {
+        throw std::out_of_range("Address is not a device address");
+    }
+    return this->nodes[address];
+}
+
+}  // namespace iqrf::connector::sim
@@ -24,6 +24,9 @@ TcpConnector::TcpConnector(TcpConfig config):
     socket(ioContext),
     resolver(ioContext),
     timer(ioContext) {
+    if (this->config.clock) {
+        this->setClock(this->config.clock);
+    }
     this->connect();
 }
 
@@ -157,9 +160,7 @@ void TcpConnector::connect() {
             IQRF_LOG(log::Level::Warning) << "Connection attempt failed: " << e.what()
                 << ". Retrying in " << currentTimeout.count() << " seconds.";
 
-            boost::asio::steady_timer delay(ioContext);
-            delay.expires_after(currentTimeout);
-            delay.wait();
+            this->getClock().sleepFor(currentTimeout);
 
             // exponential backoff
             if (currentTimeout < maxTimeout) {
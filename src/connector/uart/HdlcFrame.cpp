@@ -115,6 +115,10 @@ const std::vector<uint8_t> &HdlcFrame::getData() const {
     return this->data;
 }
 
+bool HdlcFrame::isComplete() const {
+    return !this->decoding && !this->data.empty();
+}
+
 uint8_t HdlcFrame::calculateCrc(const std::vector<uint8_t> &data) {
     uint8_t crc = 0xFF;
     for (const uint8_t byte : data) {
@@ -0,0 +1,216 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: UartBringUp.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-19
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include "iqrf/connector/uart/UartBringUp.h"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "iqrf/log/Logging.h"
+
+namespace iqrf::connector::uart {
+
+namespace log = ::iqrf::log;
+
+UartBringUp::UartBringUp(std::vector<UartConfig> configs, std::shared_ptr<IClock> clock):
+    configs(std::move(configs)),
+    clock(clock ? std::move(clock) : SteadyClock::instance()) {
+    for (auto &config : this->configs) {
+        this->addLine(config.powerEnableGpio, GpioRole::Power, config);
+        this->addLine(config.pgmSwitchGpio, GpioRole::ProgrammingMode, config);
+        if (config.busEnableGpio) {
+            // The bus switcher ignores the other bus enables
+            this->addLine(config.busEnableGpio, GpioRole::BusEnable, config);
+        } else {
+            this->addLine(config.uartEnableGpio, GpioRole::UartEnable, config);
+            this->addLine(config.spiEnableGpio, GpioRole::SpiEnable, config);
+            this->addLine(config.i2cEnableGpio, GpioRole::I2cEnable, config);
+        }
+        this->addLine(config.trReadyGpio, GpioRole::TrReady, config);
+        config.gpioPrepared = true;
+    }
+    this->buildPlan();
+}
+
+const std::vector<GpioStep> &UartBringUp::getPlan() const {
+    return this->plan;
+}
+
+const std::vector<UartConfig> &UartBringUp::getConfigs() const {
+    return this->configs;
+}
+
+void UartBringUp::prepareGpio() {
+    for (const auto &step : this->plan) {
+        switch (step.action) {
+            case GpioAction::InitInput:
+                step.gpio->initEdgeInput(gpio::GpioEventConfig{gpio::GpioEdge::Rising});
+                break;
+            case GpioAction::InitOutput:
+                step.gpio->initOutput(step.value);
+                break;
+            case GpioAction::SetValue:
+                step.gpio->setValue(step.value);
+                break;
+            case GpioAction::Wait:
+                this->clock->sleepFor(step.duration);
+                break;
+        }
+    }
+}
+
+std::vector<std::unique_ptr<UartConnector>> UartBringUp::run() {
+    const IClock::TimePoint start = this->clock->now();
+    this->prepareGpio();
+    std::vector<std::future<std::unique_ptr<UartConnector>>> pending;
+    pending.reserve(this->configs.size());
+    for (const auto &config : this->configs) {
+        pending.push_back(std::async(std::launch::async, [&config]() {
+            return std::make_unique<UartConnector>(config);
+        }));
+    }
+    std::vector<std::unique_ptr<UartConnector>> connectors;
+    connectors.reserve(this->configs.size());
+    std::exception_ptr error;
+    for (auto &future : pending) {
+        try {
+            connectors.push_back(future.get());
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(this->clock->now() - start);
+    IQRF_LOG(log::Level::Info) << connectors.size() << " UART connectors brought up in " << elapsed.count() << " ms";
+    return connectors;
+}
+
+const char *UartBringUp::roleName(const GpioRole role) {
+    switch (role) {
+        case GpioRole::Power:
+            return "power enable";
+        case GpioRole::ProgrammingMode:
+            return "programming mode switch";
+        case GpioRole::BusEnable:
+            return "bus enable";
+        case GpioRole::UartEnable:
+            return "UART enable";
+        case GpioRole::SpiEnable:
+            return "SPI enable";
+        case GpioRole::I2cEnable:
+            return "I2C enable";
+        default:
+            return "TR ready";
+    }
+}
+
+void UartBringUp::addLine(std::optional<Gpio> &gpio, const GpioRole role, const UartConfig &config) {
+    if (!gpio.has_value()) {
+        return;
+    }
+    const std::string key = UartBringUp::lineKey(gpio->getConfig());
+    const auto it = this->index.find(key);
+    if (it == this->index.end()) {
+        this->index.emplace(key, this->lines.size());
+        this->lines.push_back(Line{*gpio, role, role == GpioRole::Power && config.trModuleReset});
+    } else {
+        Line &line = this->lines[it->second];
+        if (!UartBringUp::compatible(line.role, role)) {
+            std::ostringstream message;
+            message << "GPIO line " << key << " of " << config.device << " is used as "
+                << UartBringUp::roleName(line.role) << " and " << UartBringUp::roleName(role);
+            throw std::invalid_argument(message.str());
+        }
+        line.reset = line.reset || (role == GpioRole::Power && config.trModuleReset);
+        gpio = line.gpio;
+    }
+    if (role == GpioRole::Power && config.trModuleReset) {
+        this->resetHold = std::max(this->resetHold, config.powerUp.resetHold);
+    }
+}
+
+void UartBringUp::buildPlan() {
+    this->plan.clear();
+    for (const auto &line : this->lines) {
+        if (line.role == GpioRole::TrReady) {
+            this->plan.push_back(GpioStep{GpioAction::InitInput, line.gpio});
+        } else {
+            this->plan.push_back(GpioStep{GpioAction::InitOutput, line.gpio, line.role == GpioRole::Power});
+        }
+    }
+    if (this->lines.empty()) {
+        return;
+    }
+    this->plan.push_back(GpioStep{GpioAction::Wait, std::nullopt, false, std::chrono::milliseconds(1)});
+    // All modules are power cycled at once
+    bool reset = false;
+    for (const auto &line : this->lines) {
+        if (line.reset) {
+            this->plan.push_back(GpioStep{GpioAction::SetValue, line.gpio, false});
+            reset = true;
+        }
+    }
+    if (reset) {
+        this->plan.push_back(GpioStep{GpioAction::Wait, std::nullopt, false, this->resetHold});
+        for (const auto &line : this->lines) {
+            if (line.reset) {
+                this->plan.push_back(GpioStep{GpioAction::SetValue, line.gpio, true});
+            }
+        }
+    }
+    for (const auto &line : this->lines) {
+        if (line.role == GpioRole::BusEnable || line.role == GpioRole::UartEnable) {
+            this->plan.push_back(GpioStep{GpioAction::SetValue, line.gpio, true});
+        }
+    }
+}
+
+bool UartBringUp::compatible(const GpioRole first, const GpioRole second) {
+    if (first == second) {
+        return true;
+    }
+    if (first == GpioRole::Power || second == GpioRole::Power) {
+        // Power cycling would disturb the other role
+        return false;
+    }
+    if (first == GpioRole::TrReady || second == GpioRole::TrReady) {
+        return false;
+    }
+    const auto enabled = [](const GpioRole role) {
+        return role == GpioRole::BusEnable || role == GpioRole::UartEnable;
+    };
+    return enabled(first) == enabled(second);
+}
+
+std::string UartBringUp::lineKey(const gpio::GpioConfig &config) {
+    std::ostringstream key;
+    if (!config.chip.empty()) {
+        key << config.chip << ':';
+        if (config.line_name.empty()) {
+            key << config.line;
+        } else {
+            key << config.line_name;
+        }
+    } else {
+        key << "pin:" << config.pin;
+    }
+    return key.str();
+}
+
+}  // namespace iqrf::connector::uart
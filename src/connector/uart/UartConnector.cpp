@@ -11,17 +11,54 @@
 
 #include "iqrf/connector/uart/UartConnector.h"
 
+#include <chrono>
 #include <stdexcept>
 #include <sstream>
 #include <string>
 #include <vector>
 #include <utility>
-#include <thread>
+
+#include "iqrf/connector/dpa/DpaBuilder.h"
+#include "iqrf/connector/dpa/DpaFrame.h"
+#include "iqrf/log/BinaryLog.h"
 
 namespace iqrf::connector::uart {
 
-UartConnector::UartConnector(UartConfig config): busSwitcher(config.busSwitch()), config(std::move(config)) {
-    this->initGpio();
+/**
+ * Checks whether the frame is the response to the probe sent while waiting for the TR module
+ * @param data Frame data
+ * @return true if the frame is the OS Read response of the coordinator
+ */
+static bool isProbeResponse(const std::vector<uint8_t> &data) {
+    const auto response = dpa::DpaResponseView::tryParse(data);
+    return response.has_value() && response->isResponse() && !response->isConfirmation() &&
+        !response->isAsynchronous() && response->nadr() == dpa::COORDINATOR_ADDRESS &&
+        response->pnum() == dpa::pnum::OS && response->requestPcmd() == dpa::pcmd::OS_READ;
+}
+
+UartConnector::UartConnector(UartConfig config):
+    busSwitcher(config.busSwitch()),
+    config(std::move(config)),
+    waveformEngine(iqrf::gpio::WaveformConfig{this->config.realtimeGpio}),
+    powerUpMonitor(this->config.powerUp) {
+    if (this->config.clock) {
+        this->setClock(this->config.clock);
+    }
+    std::vector<Gpio> controlLines;
+    if (this->config.powerEnableGpio) {
+        controlLines.push_back(*this->config.powerEnableGpio);
+        this->powerMask = uint64_t{1} << (controlLines.size() - 1);
+    }
+    if (this->config.pgmSwitchGpio) {
+        controlLines.push_back(*this->config.pgmSwitchGpio);
+        this->pgmMask = uint64_t{1} << (controlLines.size() - 1);
+    }
+    if (!controlLines.empty()) {
+        this->controlGroup.emplace(std::move(controlLines));
+    }
+    if (!this->config.gpioPrepared) {
+        this->initGpio();
+    }
     IQRF_LOG(log::Level::Debug) << "Opening UART port: " << this->config.device;
     UartConnector::checkSerialResult(sp_get_port_by_name(this->config.device.c_str(), &this->port));
     IQRF_LOG(log::Level::Debug) << "UART port created: " << this->config.device
@@ -60,21 +97,27 @@ UartConnector::UartConnector(UartConfig config): busSwitcher(config.busSwitch())
     UartConnector::checkSerialResult(sp_set_parity(this->port, SP_PARITY_NONE));
     UartConnector::checkSerialResult(sp_set_stopbits(this->port, 1));
     UartConnector::checkSerialResult(sp_set_flowcontrol(this->port, SP_FLOWCONTROL_NONE));
+
+    this->powerUp();
+
+    if (this->config.pacing) {
+        this->enablePacing(*this->config.pacing);
+    }
 }
 
 UartConnector::~UartConnector() {
     this->stopListen();
 
-    if (this->config.powerEnableGpio && this->config.disablePowerOnShutdown) {
-        this->config.powerEnableGpio->setValue(false);
+    if (this->controlGroup) {
+        // Power and programming mode switched off at once
+        const uint64_t mask = this->pgmMask | (this->config.disablePowerOnShutdown ? this->powerMask : 0);
+        if (mask != 0) {
+            this->controlGroup->setValues(0, mask);
+        }
     }
 
     this->busSwitcher.toggleUart(false);
 
-    if (this->config.pgmSwitchGpio) {
-        this->config.pgmSwitchGpio->setValue(false);
-    }
-
     if (this->port) {
         sp_close(this->port);
         sp_free_port(this->port);
@@ -82,31 +125,177 @@ UartConnector::~UartConnector() {
 }
 
 void UartConnector::initGpio() {
-    if (this->config.pgmSwitchGpio) {
-        this->config.pgmSwitchGpio->initOutput(false);
+    if (this->controlGroup) {
+        this->controlGroup->initOutput(this->powerMask);
     }
-    if (this->config.powerEnableGpio) {
-        this->config.powerEnableGpio->initOutput(true);
+    if (this->config.trReadyGpio) {
+        this->config.trReadyGpio->initEdgeInput(gpio::GpioEventConfig{gpio::GpioEdge::Rising});
     }
     this->busSwitcher.init();
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    this->getClock().sleepFor(std::chrono::milliseconds(1));
+}
 
-    if (this->config.trModuleReset) {
-        this->resetTr();
+void UartConnector::powerUp() {
+    if (!this->config.gpioPrepared) {
+        if (this->config.trModuleReset) {
+            this->powerCycle();
+        }
+        this->busSwitcher.toggleUart(true);
     }
-
-    this->busSwitcher.toggleUart(true);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    this->awaitReady();
 }
 
 void UartConnector::resetTr() {
     if (!this->config.powerEnableGpio.has_value()) {
         return;
     }
-    this->config.powerEnableGpio->setValue(false);
-    std::this_thread::sleep_for(std::chrono::milliseconds(300));
-    this->config.powerEnableGpio->setValue(true);
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    this->powerCycle();
+    this->awaitReady();
+}
+
+PowerUpStats UartConnector::getPowerUpStats() const {
+    std::lock_guard<std::mutex> lock(this->powerUpGuard);
+    return this->powerUpMonitor.getStats();
+}
+
+void UartConnector::powerCycle() {
+    if (this->powerMask == 0) {
+        return;
+    }
+    gpio::Waveform waveform;
+    waveform.steps = {
+        {0, this->powerMask, this->config.powerUp.resetHold},
+        {this->powerMask, this->powerMask, std::chrono::nanoseconds::zero()},
+    };
+    waveform.writer = [this](const uint64_t values, const uint64_t mask) {
+        if ((values & this->powerMask) != 0 && this->port) {
+            // Drop everything received before the reset
+            sp_flush(this->port, SP_BUF_INPUT);
+        }
+        this->controlGroup->setValues(values, mask);
+    };
+    waveform.timer = this->waveformTimer();
+    const gpio::WaveformResult result = this->waveformEngine.submit(std::move(waveform)).get();
+    IQRF_LOG(log::Level::Debug) << "TR module reset pulse jitter: "
+        << std::chrono::duration_cast<std::chrono::microseconds>(result.maxJitter).count() << " us"
+        << (result.realtime ? " (real-time)" : "");
+}
+
+gpio::WaveformTimer UartConnector::waveformTimer() {
+    if (dynamic_cast<SteadyClock *>(&this->getClock()) != nullptr) {
+        // The steady clock is the monotonic clock, slept on by clock_nanosleep() precisely
+        return {};
+    }
+    return makeGpioTimer(this->getClock());
+}
+
+void UartConnector::awaitReady() {
+    const bool listening = this->isListening();
+    HdlcFrame frame;
+    PowerUpMonitor::FrameWaiter awaitFrame;
+    if (listening) {
+        // The frames are read by the listening loop, it signals them
+        uint64_t seen;
+        {
+            std::lock_guard<std::mutex> lock(this->frameGuard);
+            seen = this->receivedFrames;
+        }
+        awaitFrame = [this, seen](const IClock::Duration timeout) {
+            std::unique_lock<std::mutex> lock(this->frameGuard);
+            return this->frameReceived.wait_for(lock, timeout, [this, seen] {
+                return this->receivedFrames != seen;
+            });
+        };
+    } else {
+        awaitFrame = [this, &frame](const IClock::Duration timeout) {
+            return this->readFrame(frame, timeout);
+        };
+    }
+    const auto probe = [this, listening]() {
+        if (listening) {
+            std::lock_guard<std::mutex> lock(this->frameGuard);
+            this->unansweredProbes++;
+        }
+        this->send(dpa::OsRead::toVector(dpa::COORDINATOR_ADDRESS));
+    };
+    PowerUpMonitor::ReadyLine readyLine;
+    if (this->config.trReadyGpio) {
+        readyLine = [this]() {
+            // A pending rising edge catches a ready pulse shorter than the check interval
+            return this->config.trReadyGpio->waitEvent(std::chrono::nanoseconds(0)).has_value()
+                || this->config.trReadyGpio->getValue();
+        };
+    }
+    ReadySignal signal;
+    PowerUpStats stats;
+    {
+        std::lock_guard<std::mutex> lock(this->powerUpGuard);
+        signal = this->powerUpMonitor.awaitReady(this->getClock(), awaitFrame, probe, readyLine);
+        stats = this->powerUpMonitor.getStats();
+    }
+    if (listening) {
+        // Responses to the probes which come later are delivered
+        std::lock_guard<std::mutex> lock(this->frameGuard);
+        this->unansweredProbes = 0;
+    } else if (signal == ReadySignal::Frame || signal == ReadySignal::Probe) {
+        if (signal == ReadySignal::Frame || !isProbeResponse(frame.getData())) {
+            this->keepFrame(frame.getData());
+        }
+        if (signal == ReadySignal::Probe) {
+            // Drop the responses to the other probes, nobody is waiting for them
+            HdlcFrame rest;
+            while (this->readFrame(rest, std::chrono::milliseconds(10))) {
+                if (!isProbeResponse(rest.getData())) {
+                    this->keepFrame(rest.getData());
+                }
+                rest = HdlcFrame();
+            }
+        }
+    }
+    const auto timeToReady = std::chrono::duration_cast<std::chrono::milliseconds>(stats.lastTimeToReady);
+    if (signal == ReadySignal::Timeout) {
+        IQRF_LOG(log::Level::Warning) << "TR module not confirmed ready within "
+            << this->config.powerUp.readyTimeout.count() << " ms";
+        return;
+    }
+    IQRF_LOG(log::Level::Info) << "TR module ready after " << timeToReady.count() << " ms ("
+        << PowerUpMonitor::signalName(signal) << ")";
+}
+
+void UartConnector::keepFrame(std::vector<uint8_t> data) {
+    std::lock_guard<std::mutex> lock(this->frameGuard);
+    this->pendingFrames.push_back(std::move(data));
+}
+
+bool UartConnector::readFrame(HdlcFrame &frame, const IClock::Duration timeout) {
+    // Serial port timeouts run in real time
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    uint8_t byte;
+    while (true) {
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()
+        );
+        if (remaining <= std::chrono::milliseconds::zero()) {
+            return false;
+        }
+        const int bytesRead = sp_blocking_read(this->port, &byte, 1, static_cast<unsigned int>(remaining.count()));
+        if (bytesRead < 0) {
+            throw std::runtime_error("Failed to read from UART port");
+        }
+        if (bytesRead == 0) {
+            return false;
+        }
+        try {
+            frame.decodeByte(byte);
+        } catch (const std::logic_error &) {
+            // Line noise during the power-up
+            frame = HdlcFrame();
+            continue;
+        }
+        if (frame.isComplete()) {
+            return true;
+        }
+    }
 }
 
 int UartConnector::checkSerialResult(const sp_return result) {
@@ -127,6 +316,14 @@ int UartConnector::checkSerialResult(const sp_return result) {
 }
 
 std::vector<uint8_t> UartConnector::receive() {
+    {
+        std::lock_guard<std::mutex> lock(this->frameGuard);
+        if (!this->pendingFrames.empty()) {
+            std::vector<uint8_t> data = std::move(this->pendingFrames.front());
+            this->pendingFrames.pop_front();
+            return data;
+        }
+    }
     int bytesRead = 0;
     uint8_t byte;
     HdlcFrame frame;
@@ -138,7 +335,19 @@ std::vector<uint8_t> UartConnector::receive() {
         throw std::runtime_error("Failed to read from UART port");
     }
 
-    return frame.getData();
+    std::vector<uint8_t> data = frame.getData();
+    IQRF_BLOG(log::Level::Debug, "UART frame received: {}", log::hexBytes(data));
+    if (!data.empty()) {
+        std::lock_guard<std::mutex> lock(this->frameGuard);
+        // Signals the TR module is ready to the reset waiting for it
+        this->receivedFrames++;
+        this->frameReceived.notify_all();
+        if (this->unansweredProbes > 0 && isProbeResponse(data)) {
+            this->unansweredProbes--;
+            return {};
+        }
+    }
+    return data;
 }
 
 void UartConnector::send(const std::vector<uint8_t> &data) {
@@ -147,6 +356,7 @@ void UartConnector::send(const std::vector<uint8_t> &data) {
     }
     HdlcFrame hdlcFrame(data);
     const std::vector<uint8_t> frame = hdlcFrame.encode();
+    IQRF_BLOG(log::Level::Debug, "UART frame sent: {}", log::hexBytes(data));
     UartConnector::checkSerialResult(sp_blocking_write(this->port, frame.data(), frame.size(), 1000));
 }
 
@@ -16,13 +16,16 @@
 
 #include "iqrf/gpio/Gpio.h"
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
 namespace iqrf::gpio {
 
-Gpio::Gpio(const GpioConfig& config) {
+Gpio::Gpio(const GpioConfig& config) : config(std::make_shared<const GpioConfig>(config)) {
 #if IQRF_TESTING_SUPPORT
     if (config.use_mock) {
         this->impl = std::make_shared<iqrf::gpio::GpioMock>(config);
@@ -37,10 +40,11 @@ Gpio::Gpio(const GpioConfig& config) {
 #endif
 }
 
-Gpio::Gpio(const Gpio& other) noexcept : impl(other.impl), isMock(other.isMock) {
+Gpio::Gpio(const Gpio& other) noexcept : impl(other.impl), config(other.config), isMock(other.isMock) {
 }
 
-Gpio::Gpio(Gpio&& other) noexcept : impl(std::move(other.impl)), isMock(other.isMock) {
+Gpio::Gpio(Gpio&& other) noexcept :
+    impl(std::move(other.impl)), config(std::move(other.config)), isMock(other.isMock) {
 }
 
 Gpio::~Gpio() {
@@ -77,9 +81,26 @@ bool Gpio::getValue() const {
     return impl->getValue();
 }
 
+void Gpio::initEdgeInput(const GpioEventConfig& eventConfig) const {
+    this->impl->initEdgeInput(eventConfig);
+}
+
+std::optional<GpioEvent> Gpio::waitEvent(const std::chrono::nanoseconds timeout) const {
+    return this->impl->waitEvent(timeout);
+}
+
+int Gpio::getEventFd() const {
+    return this->impl->getEventFd();
+}
+
+const GpioConfig& Gpio::getConfig() const {
+    return *this->config;
+}
+
 void swap(Gpio& first, Gpio& second) noexcept {
     using std::swap;  // Enable ADL
     swap(first.impl, second.impl);
+    swap(first.config, second.config);
     swap(first.isMock, second.isMock);
 }
 
@@ -91,19 +112,33 @@ void Gpio::setInputValue(const bool value) const {
     std::dynamic_pointer_cast<GpioMock>(impl)->setInputValue(value);
 }
 
-void Gpio::registerDirectionCallback(const GpioDirectionCallback& callback) const {
+std::size_t Gpio::registerDirectionCallback(const GpioDirectionCallback& callback) const {
     if (!this->isMock) {
         throw std::logic_error("registerDirectionCallback is only available for mock GPIO");
     }
-    std::dynamic_pointer_cast<GpioMock>(this->impl)->registerDirectionCallback(callback);
+    return std::dynamic_pointer_cast<GpioMock>(this->impl)->registerDirectionCallback(callback);
 }
 
 
-void Gpio::registerValueCallback(const GpioValueCallback& callback) const {
+std::size_t Gpio::registerValueCallback(const GpioValueCallback& callback) const {
     if (!this->isMock) {
         throw std::logic_error("registerValueCallback is only available for mock GPIO");
     }
-    std::dynamic_pointer_cast<GpioMock>(this->impl)->registerValueCallback(callback);
+    return std::dynamic_pointer_cast<GpioMock>(this->impl)->registerValueCallback(callback);
+}
+
+std::shared_ptr<GpioMock> Gpio::getMock() const {
+    if (!this->isMock) {
+        throw std::logic_error("getMock is only available for mock GPIO");
+    }
+    return std::dynamic_pointer_cast<GpioMock>(this->impl);
+}
+
+void Gpio::injectEvent(const GpioEdge edge, const std::chrono::nanoseconds timestamp) const {
+    if (!this->isMock) {
+        throw std::logic_error("injectEvent is only available for mock GPIO");
+    }
+    std::dynamic_pointer_cast<GpioMock>(this->impl)->injectEvent(edge, timestamp);
 }
 #endif
 
@@ -73,23 +73,18 @@ iqrf::gpio::GpioDirection GpioFreeBsd::getDirection() {
     return (pin.gp_flags & GPIO_PIN_INPUT) ? GpioDirection::Input : GpioDirection::Output;
 }
 
-void GpioFreeBsd::setValue(const bool value) {
-    struct gpio_req rq;
-    rq.gp_pin = this->line;
-    rq.gp_value = value ? 1 : 0;
+void GpioFreeBsd::initEdgeInput(const GpioEventConfig& config) {
+    (void)config;
+    throw std::runtime_error("GPIO edge events are not supported on FreeBSD");
+}
 
-    if (ioctl(this->fd, GPIOSET, &rq) < 0) {
-        throw std::system_error(errno, std::generic_category(), "Failed to set GPIO value");
-    }
+std::optional<GpioEvent> GpioFreeBsd::waitEvent(const std::chrono::nanoseconds timeout) {
+    (void)timeout;
+    throw std::runtime_error("GPIO edge events are not supported on FreeBSD");
 }
 
-bool GpioFreeBsd::getValue() {
-    struct gpio_req rq;
-    rq.gp_pin = this->line;
-    if (ioctl(this->fd, GPIOGET, &rq) < 0) {
-        throw std::system_error(errno, std::generic_category(), "Failed to get GPIO value");
-    }
-    return rq.gp_value != 0;
+int GpioFreeBsd::getEventFd() {
+    throw std::runtime_error("GPIO edge events are not supported on FreeBSD");
 }
 
 void GpioFreeBsd::setConsumerName(const std::string &name) const {
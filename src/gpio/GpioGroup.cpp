@@ -0,0 +1,135 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioGroup.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-20
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include "iqrf/gpio/GpioGroup.h"
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace iqrf::gpio {
+
+GpioGroup::GpioGroup(std::vector<Gpio> lines) : lines(std::move(lines)) {
+    if (this->lines.empty()) {
+        throw std::invalid_argument("GPIO group is empty");
+    }
+    if (this->lines.size() > MAX_LINES) {
+        throw std::invalid_argument("GPIO group has too many lines");
+    }
+}
+
+void GpioGroup::initInput() {
+    this->impl = this->createDriver();
+    if (this->impl) {
+        this->impl->initInput();
+        return;
+    }
+    for (const auto& line : this->lines) {
+        line.initInput();
+    }
+}
+
+void GpioGroup::initOutput(const uint64_t initialValues) {
+    this->impl = this->createDriver();
+    if (this->impl) {
+        this->impl->initOutput(initialValues);
+        return;
+    }
+    for (std::size_t i = 0; i < this->lines.size(); ++i) {
+        this->lines[i].initOutput((initialValues >> i) & 1U);
+    }
+}
+
+void GpioGroup::setValues(const uint64_t values) const {
+#if IQRF_TESTING_SUPPORT
+    const uint64_t oldValues = this->valuesCallback ? this->getValues() : 0;
+#endif
+    if (this->impl) {
+        this->impl->setValues(values);
+    } else {
+        // Break before make
+        for (const bool active : {false, true}) {
+            for (std::size_t i = 0; i < this->lines.size(); ++i) {
+                if (static_cast<bool>((values >> i) & 1U) == active) {
+                    this->lines[i].setValue(active);
+                }
+            }
+        }
+    }
+#if IQRF_TESTING_SUPPORT
+    if (this->valuesCallback) {
+        this->valuesCallback(oldValues, values);
+    }
+#endif
+}
+
+void GpioGroup::setValues(const uint64_t values, const uint64_t mask) const {
+    this->setValues((this->getValues() & ~mask) | (values & mask));
+}
+
+uint64_t GpioGroup::getValues() const {
+    if (this->impl) {
+        return this->impl->getValues();
+    }
+    uint64_t values = 0;
+    for (std::size_t i = 0; i < this->lines.size(); ++i) {
+        if (this->lines[i].getValue()) {
+            values |= uint64_t{1} << i;
+        }
+    }
+    return values;
+}
+
+std::size_t GpioGroup::size() const {
+    return this->lines.size();
+}
+
+bool GpioGroup::isAtomic() const {
+    return this->impl != nullptr;
+}
+
+const std::vector<Gpio>& GpioGroup::getLines() const {
+    return this->lines;
+}
+
+#if IQRF_TESTING_SUPPORT
+void GpioGroup::setValuesCallback(const GpioGroupValuesCallback& callback) const {
+    this->valuesCallback = callback;
+}
+#endif
+
+std::shared_ptr<GroupBase> GpioGroup::createDriver() const {
+    if (this->impl) {
+        return this->impl;
+    }
+#if IQRF_TESTING_SUPPORT
+    for (const auto& line : this->lines) {
+        if (line.getConfig().use_mock) {
+            return nullptr;
+        }
+    }
+#endif
+#if defined(__linux__)
+    std::vector<GpioConfig> configs;
+    configs.reserve(this->lines.size());
+    for (const auto& line : this->lines) {
+        if (line.getConfig().chip != this->lines.front().getConfig().chip) {
+            return nullptr;
+        }
+        configs.push_back(line.getConfig());
+    }
+    return std::make_shared<GpiodGroup>(configs);
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace iqrf::gpio
@@ -12,12 +12,16 @@
 #include "iqrf/gpio/GpioMap.h"
 
 #include <algorithm>
+#include <exception>
 #include <filesystem>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "iqrf/gpio/GpioTopologyCache.h"
+
 #if defined(__linux__) or defined(__FreeBSD__)
 #define GPIO_DIRECTORY "/dev"
 #endif
@@ -28,88 +32,243 @@
 #define GPIO_CHIP_PREFIX "gpioc"
 #define GPIO_CHIP_PREFIX_LEN (sizeof(GPIO_CHIP_PREFIX) - 1)  // Excluding the null terminator
 #endif
+#if !defined(IQRF_GPIO_TOPOLOGY_CACHE)
+#define IQRF_GPIO_TOPOLOGY_CACHE ""
+#endif
 
 namespace iqrf::gpio {
 
-GpioMap getGpioMap() {
-    GpioMap map;
-    std::size_t npin = 0;
+GpioMap::GpioMap(ChipLister lister, LineCounter counter, LineNamer namer)
+    : lister(std::move(lister)), counter(std::move(counter)), namer(std::move(namer)) {
+}
 
-#if defined(__linux__)
-#if libgpiod_VERSION_MAJOR == 1
-    for (auto &chip : ::gpiod::make_chip_iter()) {
-        std::shared_ptr<std::string> chip_name = std::make_shared<std::string>(chip.name());
+GpioMap::GpioMap(const std::vector<std::pair<std::string, std::size_t>>& chips, LineNamer namer)
+    : namer(std::move(namer)) {
+    this->lister = [chips]() {
+        std::vector<std::string> names;
+        names.reserve(chips.size());
+        for (const auto& [name, _] : chips) {
+            names.push_back(name);
+        }
+        return names;
+    };
+    this->counter = [chips](const std::string& name) {
+        const auto it = std::find_if(chips.begin(), chips.end(), [&name](const auto& chip) {
+            return chip.first == name;
+        });
+        return it->second;
+    };
+}
+
+GpioMap::GpioMap(const GpioMap& other) {
+    std::lock_guard<std::mutex> lock(other.mutex);
+    this->lister = other.lister;
+    this->counter = other.counter;
+    this->namer = other.namer;
+    this->chipNames = other.chipNames;
+    this->nextChip = other.nextChip;
+    this->chips = other.chips;
+    this->pinCount = other.pinCount;
+    this->lineNames = other.lineNames;
+}
 
-        for (auto &line : ::gpiod::line_iter(chip)) {
-            map.insert_or_assign(npin++, std::make_pair(chip_name, line.offset()));
+std::optional<GpioLineRecord> GpioMap::findPin(const std::size_t pin) const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    while (pin >= this->pinCount) {
+        if (!this->loadNextChip()) {
+            return std::nullopt;
         }
     }
-#else
-    std::vector< std::pair<unsigned long, std::filesystem::path> > chips;  // NOLINT(runtime/int)
-
-    // Load all GPIO chips
-    for (auto const &entry : std::filesystem::directory_iterator{GPIO_DIRECTORY}) {
-        auto const &path_str = entry.path().filename().string();
-        if (path_str.find(GPIO_CHIP_PREFIX) == 0) {  // We care only about /dev/gpiochip* entries
-            if (gpiod::is_gpiochip_device(entry.path())) {  // Make sure it is GPIO
-                try {
-                    chips.emplace_back(
-                        std::stoul(path_str.substr(GPIO_CHIP_PREFIX_LEN)),
-                        entry.path());
-                } catch (const std::exception &e) {}  // Ignore invalid chip names
+    // The last chip starting at or before the pin
+    const auto it = std::upper_bound(this->chips.begin(), this->chips.end(), pin,
+        [](const std::size_t value, const GpioChipRecord& chip) { return value < chip.firstPin; });
+    const auto& chip = *std::prev(it);
+    return GpioLineRecord{chip.name, pin - chip.firstPin};
+}
+
+std::optional<std::size_t> GpioMap::findLine(const std::string& chip, const std::string& lineName) const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto index = this->lineNames.find(chip);
+    if (index == this->lineNames.end()) {
+        if (!this->namer) {
+            return std::nullopt;
+        }
+        std::vector<std::string> names;
+        try {
+            names = this->namer(chip);
+        } catch (const std::exception& e) {
+            // Not indexed, the chip may appear later
+            return std::nullopt;
+        }
+        std::unordered_map<std::string, std::size_t> offsets;
+        offsets.reserve(names.size());
+        for (std::size_t offset = 0; offset < names.size(); ++offset) {
+            if (!names[offset].empty()) {
+                // The first line of the name wins, as with the kernel lookup
+                offsets.emplace(names[offset], offset);
             }
         }
+        index = this->lineNames.emplace(chip, std::move(offsets)).first;
+    }
+    const auto line = index->second.find(lineName);
+    if (line == index->second.end()) {
+        return std::nullopt;
     }
+    return line->second;
+}
 
-    // Sort the chips in numerical order by their ordinal number
-    std::sort(chips.begin(), chips.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+std::vector<GpioChipRecord> GpioMap::getChips() const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    while (this->loadNextChip()) {
+    }
+    return this->chips;
+}
+
+std::size_t GpioMap::getLoadedChipCount() const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->chips.size();
+}
 
-    // Create the mapping according to the sorted chips
-    for (auto const &[_, chip_path] : chips) {
+bool GpioMap::loadNextChip() const {
+    if (!this->chipNames) {
+        this->chipNames = this->lister ? this->lister() : std::vector<std::string>();
+    }
+    while (this->nextChip < this->chipNames->size()) {
+        const std::string& name = (*this->chipNames)[this->nextChip++];
+        std::size_t lineCount;
         try {
-            auto chip_info = ::gpiod::chip(chip_path).get_info();
-            std::shared_ptr<std::string> chip_name = std::make_shared<std::string>(chip_info.name());
+            lineCount = this->counter(name);
+        } catch (const std::exception& e) {
+            // Ignore the failed chips
+            continue;
+        }
+        if (lineCount == 0) {
+            continue;
+        }
+        this->chips.push_back(GpioChipRecord{name, this->pinCount, lineCount});
+        this->pinCount += lineCount;
+        return true;
+    }
+    return false;
+}
 
-            for (std::size_t line = 0; line < chip_info.num_lines(); ++line) {
-                map.insert_or_assign(npin++, std::make_pair(chip_name, line));
-            }
-        } catch (const std::exception &e) {}  // Ignore the failed chips
+/**
+ * Lists the GPIO chip devices
+ * @return GPIO chip names in the pin order
+ */
+static std::vector<std::string> listChips() {
+    std::vector<std::pair<unsigned long, std::string>> chips;  // NOLINT(runtime/int)
+#if defined(__linux__) or defined(__FreeBSD__)
+    for (const auto &entry : std::filesystem::directory_iterator{GPIO_DIRECTORY}) {
+        const auto &filename = entry.path().filename().string();
+        if (filename.find(GPIO_CHIP_PREFIX) != 0) {  // We care only about the GPIO chip entries
+            continue;
+        }
+#if defined(__linux__) && libgpiod_VERSION_MAJOR != 1
+        if (!gpiod::is_gpiochip_device(entry.path())) {  // Make sure it is GPIO
+            continue;
+        }
+#endif
+        try {
+            chips.emplace_back(std::stoul(filename.substr(GPIO_CHIP_PREFIX_LEN)), filename);
+        } catch (const std::exception &e) {}  // Ignore invalid chip names
     }
 #endif
+#if defined(__linux__) && libgpiod_VERSION_MAJOR == 1
+    // Keep the order of the libgpiod v1 chip iterator, which sorts the chips alphabetically
+    std::sort(chips.begin(), chips.end(), [](const auto &a, const auto &b) { return a.second < b.second; });
+#else
+    // Sort the chips in numerical order by their ordinal number
+    std::sort(chips.begin(), chips.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+#endif
+    std::vector<std::string> names;
+    names.reserve(chips.size());
+    for (auto &[_, name] : chips) {
+        names.push_back(std::move(name));
+    }
+    return names;
+}
+
+/**
+ * Returns the number of lines of the GPIO chip
+ * @param name GPIO chip name
+ * @return Number of lines
+ */
+static std::size_t countLines(const std::string &name) {
+#if defined(__linux__)
+#if libgpiod_VERSION_MAJOR == 1
+    return ::gpiod::chip(name).num_lines();
+#else
+    return ::gpiod::chip(std::filesystem::path(GPIO_DIRECTORY) / name).get_info().num_lines();
+#endif
 #elif defined(__FreeBSD__)
-    // Load all GPIO chips
-    for (const auto &entry : std::filesystem::directory_iterator{GPIO_DIRECTORY}) {
-        auto const &path = entry.path();
-        auto const &filename = path.filename().string();
-
-        // We care only about /dev/gpioc* entries
-        if (filename.find(GPIO_CHIP_PREFIX) == 0) {
-            try {
-                // Open the chip file to retrieve its information
-                int fd = open(path.c_str(), O_RDONLY);
-                if (fd < 0) {
-                    // Failed to open the chip file, skip it
-                    continue;
-                }
-
-                // Retrieve GPIO chip information
-                int pin_count = 0;
-                if (ioctl(fd, GPIOMAXPIN, &pin_count) >= 0) {
-                    std::shared_ptr<std::string> chip_name = std::make_shared<std::string>(filename);
-
-                    // Create the mapping for each pin in the chip
-                    for (int line = 0; line < pin_count; ++line) {
-                        map.insert_or_assign(npin++, std::make_pair(chip_name, line));
-                    }
-                }
-
-                close(fd);
-            } catch (const std::exception &e) {}  // Ignore the failed chips
-        }
+    const std::string path = std::string(GPIO_DIRECTORY "/") + name;
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open GPIO chip " + name);
     }
+    int pin_count = 0;
+    const int ret = ioctl(fd, GPIOMAXPIN, &pin_count);
+    close(fd);
+    if (ret < 0) {
+        throw std::runtime_error("Failed to get the number of pins of GPIO chip " + name);
+    }
+    return static_cast<std::size_t>(pin_count);
+#else
+    (void)name;
+    return 0;
 #endif
+}
 
-    return map;
+#if defined(__linux__)
+/**
+ * Returns the line names of the GPIO chip
+ * @param name GPIO chip name
+ * @return Line names indexed by the line offset
+ */
+static std::vector<std::string> nameLines(const std::string &name) {
+    std::vector<std::string> names;
+#if libgpiod_VERSION_MAJOR == 1
+    ::gpiod::chip chip(name);
+    names.reserve(chip.num_lines());
+    for (unsigned int offset = 0; offset < chip.num_lines(); ++offset) {
+        names.push_back(chip.get_line(offset).name());
+    }
+#else
+    ::gpiod::chip chip(std::filesystem::path(GPIO_DIRECTORY) / name);
+    const std::size_t lineCount = chip.get_info().num_lines();
+    names.reserve(lineCount);
+    for (std::size_t offset = 0; offset < lineCount; ++offset) {
+        names.push_back(chip.get_line_info(offset).name());
+    }
+#endif
+    return names;
+}
+#endif
+
+GpioMap getGpioMap() {
+    return getGpioMap(IQRF_GPIO_TOPOLOGY_CACHE);
+}
+
+GpioMap getGpioMap(const std::string &cachePath) {
+    GpioMap::LineCounter counter = countLines;
+    if (!cachePath.empty()) {
+        // Called under the lock of the map
+        auto cache = std::make_shared<GpioTopologyCache>(cachePath);
+        counter = [cache](const std::string &name) {
+            if (const auto lineCount = cache->find(name)) {
+                return *lineCount;
+            }
+            const std::size_t lineCount = countLines(name);
+            cache->store(name, lineCount);
+            return lineCount;
+        };
+    }
+#if defined(__linux__)
+    return GpioMap(listChips, counter, nameLines);
+#else
+    return GpioMap(listChips, counter);
+#endif
 }
 
 }  // namespace iqrf::gpio
@@ -14,38 +14,87 @@
  * limitations under the License.
  */
 
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
 #include <utility>
 
 #include "iqrf/gpio/GpioMock.h"
 
 namespace iqrf::gpio {
 
+/**
+ * Returns the current time of the mock clock
+ * @param clock Mock clock, the steady clock if the hooks are not set
+ * @return Current time
+ */
+static std::chrono::nanoseconds clockNow(const GpioMockClock& clock) {
+    if (clock.now) {
+        return clock.now();
+    }
+    return std::chrono::steady_clock::now().time_since_epoch();
+}
+
 GpioMock::GpioMock(iqrf::gpio::GpioConfig config): config(std::move(config)) {
     // No actual GPIO implementation, just a mock
 }
 
+GpioMock::~GpioMock() {
+    // The input waveform drives the line, so it is stopped first
+    this->inputEngine.reset();
+    for (const int fd : this->eventPipe) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
 void GpioMock::initInput() {
+    const auto timestamp = this->now();
+    std::lock_guard<std::mutex> lock(this->mutex);
     this->direction = GpioDirection::Input;
     this->state = GpioMockState::Initialized;
+    this->record(timestamp);
 }
 
 void GpioMock::initOutput(const bool initialValue) {
+    const auto timestamp = this->now();
+    std::lock_guard<std::mutex> lock(this->mutex);
     this->direction = GpioDirection::Output;
     this->value = initialValue;
     this->state = GpioMockState::Initialized;
+    this->record(timestamp);
 }
 
 void GpioMock::setDirection(const iqrf::gpio::GpioDirection newDirection) {
-    if (this->state == GpioMockState::Uninitialized) {
-        throw std::runtime_error("GPIO line is not initialized");
+    const auto timestamp = this->now();
+    std::vector<std::pair<std::size_t, GpioDirectionCallback>> callbacks;
+    GpioDirection oldDirection;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->state == GpioMockState::Uninitialized) {
+            throw std::runtime_error("GPIO line is not initialized");
+        }
+        oldDirection = this->direction;
+        if (oldDirection == newDirection) {
+            return;
+        }
+        this->direction = newDirection;
+        this->record(timestamp);
+        callbacks = this->directionCallbacks;
     }
-    if (this->direction != newDirection && this->directionCallback) {
-        this->directionCallback(this->direction, newDirection);
+    for (const auto& [id, callback] : callbacks) {
+        callback(oldDirection, newDirection);
     }
-    this->direction = newDirection;
 }
 
 iqrf::gpio::GpioDirection GpioMock::getDirection() {
+    std::lock_guard<std::mutex> lock(this->mutex);
     if (this->state == GpioMockState::Uninitialized) {
         throw std::runtime_error("GPIO line is not initialized");
     }
@@ -53,30 +102,235 @@ iqrf::gpio::GpioDirection GpioMock::getDirection() {
 }
 
 void GpioMock::setValue(const bool newValue) {
-    if (this->state == GpioMockState::Uninitialized) {
-        throw std::runtime_error("GPIO line is not initialized");
+    this->delay(this->getLatency().write);
+    const auto timestamp = this->now();
+    std::vector<std::pair<std::size_t, GpioValueCallback>> callbacks;
+    bool oldValue;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->state == GpioMockState::Uninitialized) {
+            throw std::runtime_error("GPIO line is not initialized");
+        }
+        if (this->direction != GpioDirection::Output) {
+            throw std::runtime_error("Cannot set value on GPIO line that is not an output");
+        }
+        oldValue = this->value;
+        if (oldValue == newValue) {
+            return;
+        }
+        this->value = newValue;
+        this->record(timestamp);
+        callbacks = this->valueCallbacks;
     }
-    if (this->direction != GpioDirection::Output) {
-        throw std::runtime_error("Cannot set value on GPIO line that is not an output");
+    for (const auto& [id, callback] : callbacks) {
+        callback(oldValue, newValue);
     }
-    if (this->value != newValue && this->valueCallback) {
-        this->valueCallback(this->value, newValue);
-    }
-    this->value = newValue;
 }
 
 void GpioMock::setInputValue(const bool newValue) {
-    if (this->direction != GpioDirection::Input) {
-        throw std::runtime_error("Cannot set input value on GPIO line that is not an input");
-    }
-    this->value = newValue;
+    this->driveInput(newValue);
 }
 
 bool GpioMock::getValue() {
+    this->delay(this->getLatency().read);
+    std::lock_guard<std::mutex> lock(this->mutex);
     if (this->state == GpioMockState::Uninitialized) {
         throw std::runtime_error("GPIO line is not initialized");
     }
     return this->value;
 }
 
+void GpioMock::initEdgeInput(const GpioEventConfig& newEventConfig) {
+    this->initInput();
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (this->eventPipe[0] < 0 && pipe(this->eventPipe) != 0) {
+        throw std::system_error(errno, std::generic_category(), "Failed to create GPIO mock event pipe");
+    }
+    // Drop the events of the previous request
+    char byte;
+    for (std::size_t i = 0; i < this->events.size(); ++i) {
+        (void)!read(this->eventPipe[0], &byte, 1);
+    }
+    this->events.clear();
+    this->lastEvent.reset();
+    this->eventConfig = newEventConfig;
+}
+
+std::optional<GpioEvent> GpioMock::waitEvent(const std::chrono::nanoseconds timeout) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (!this->eventConfig) {
+        throw std::runtime_error("GPIO line is not initialized for edge events");
+    }
+    const auto pending = [this]() { return !this->events.empty(); };
+    if (timeout.count() < 0) {
+        this->eventCondition.wait(lock, pending);
+    } else if (!this->eventCondition.wait_for(lock, timeout, pending)) {
+        return std::nullopt;
+    }
+    const GpioEvent event = this->events.front();
+    this->events.pop_front();
+    char byte;
+    (void)!read(this->eventPipe[0], &byte, 1);
+    return event;
+}
+
+int GpioMock::getEventFd() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (!this->eventConfig) {
+        throw std::runtime_error("GPIO line is not initialized for edge events");
+    }
+    return this->eventPipe[0];
+}
+
+void GpioMock::injectEvent(const GpioEdge edge, const std::chrono::nanoseconds timestamp) {
+    if (edge == GpioEdge::Both) {
+        throw std::invalid_argument("Injected GPIO edge has to be rising or falling");
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (!this->eventConfig) {
+            throw std::runtime_error("GPIO line is not initialized for edge events");
+        }
+        if (!this->queueEvent(edge, timestamp)) {
+            return;
+        }
+    }
+    this->eventCondition.notify_all();
+}
+
+std::size_t GpioMock::registerDirectionCallback(const GpioDirectionCallback& callback) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    const std::size_t id = this->nextCallbackId++;
+    this->directionCallbacks.emplace_back(id, callback);
+    return id;
+}
+
+std::size_t GpioMock::registerValueCallback(const GpioValueCallback& callback) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    const std::size_t id = this->nextCallbackId++;
+    this->valueCallbacks.emplace_back(id, callback);
+    return id;
+}
+
+void GpioMock::unregisterCallback(const std::size_t id) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    const auto matches = [id](const auto& entry) { return entry.first == id; };
+    this->directionCallbacks.erase(
+        std::remove_if(this->directionCallbacks.begin(), this->directionCallbacks.end(), matches),
+        this->directionCallbacks.end()
+    );
+    this->valueCallbacks.erase(
+        std::remove_if(this->valueCallbacks.begin(), this->valueCallbacks.end(), matches),
+        this->valueCallbacks.end()
+    );
+}
+
+void GpioMock::setClock(GpioMockClock newClock) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->clock = std::move(newClock);
+}
+
+void GpioMock::setLatency(const GpioMockLatency& newLatency) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->latency = newLatency;
+}
+
+std::vector<GpioTransition> GpioMock::getTimeline() const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->timeline;
+}
+
+void GpioMock::clearTimeline() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->timeline.clear();
+}
+
+std::future<WaveformResult> GpioMock::playInput(std::vector<WaveformStep> steps) {
+    Waveform waveform;
+    waveform.steps = std::move(steps);
+    waveform.writer = [this](const uint64_t values, const uint64_t mask) {
+        if ((mask & 1U) != 0) {
+            this->driveInput((values & 1U) != 0);
+        }
+    };
+    std::lock_guard<std::mutex> lock(this->mutex);
+    waveform.timer = this->clock;
+    if (!this->inputEngine) {
+        this->inputEngine = std::make_unique<WaveformEngine>();
+    }
+    return this->inputEngine->submit(std::move(waveform));
+}
+
+GpioMockClock GpioMock::getClock() const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->clock;
+}
+
+GpioMockLatency GpioMock::getLatency() const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->latency;
+}
+
+std::chrono::nanoseconds GpioMock::now() const {
+    return clockNow(this->getClock());
+}
+
+void GpioMock::delay(const std::chrono::nanoseconds duration) const {
+    if (duration <= std::chrono::nanoseconds::zero()) {
+        return;
+    }
+    // Called without the mock lock, the clock may drive the line from another thread
+    const GpioMockClock mockClock = this->getClock();
+    if (mockClock.sleepUntil) {
+        mockClock.sleepUntil(clockNow(mockClock) + duration);
+    } else {
+        std::this_thread::sleep_for(duration);
+    }
+}
+
+void GpioMock::record(const std::chrono::nanoseconds timestamp) {
+    this->timeline.push_back(GpioTransition{timestamp, this->direction, this->value});
+}
+
+void GpioMock::driveInput(const bool newValue) {
+    const auto timestamp = this->now();
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->direction != GpioDirection::Input) {
+            throw std::runtime_error("Cannot set input value on GPIO line that is not an input");
+        }
+        if (this->value == newValue) {
+            return;
+        }
+        if (!this->eventConfig) {
+            this->value = newValue;
+            this->record(timestamp);
+            return;
+        }
+        if (!this->queueEvent(newValue ? GpioEdge::Rising : GpioEdge::Falling, timestamp)) {
+            return;
+        }
+    }
+    this->eventCondition.notify_all();
+}
+
+bool GpioMock::queueEvent(const GpioEdge edge, const std::chrono::nanoseconds timestamp) {
+    const bool newValue = edge == GpioEdge::Rising;
+    if (this->value != newValue) {
+        this->value = newValue;
+        this->record(timestamp);
+    }
+    if (this->eventConfig->edge != GpioEdge::Both && this->eventConfig->edge != edge) {
+        return false;
+    }
+    if (this->lastEvent && timestamp - *this->lastEvent < this->eventConfig->debounce) {
+        return false;
+    }
+    this->lastEvent = timestamp;
+    this->events.push_back(GpioEvent{edge, timestamp});
+    const char byte = 0;
+    (void)!write(this->eventPipe[1], &byte, 1);
+    return true;
+}
+
 }  // namespace iqrf::gpio
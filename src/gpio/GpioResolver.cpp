@@ -11,7 +11,9 @@
 
 #include "iqrf/gpio/GpioResolver.h"
 
+#include <cstddef>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -35,22 +37,28 @@ GpioResolver* GpioResolver::GetResolver(const GpioMap& map) {
 }
 
 void GpioResolver::resolveGpioPin(const int64_t pin, ::std::string& chip, ::std::size_t& line) {
-    const auto record = gpioMap.find(pin);
-    if (record == gpioMap.end()) {
+    const auto record = pin < 0 ? std::nullopt : gpioMap.findPin(static_cast<std::size_t>(pin));
+    if (!record) {
         throw std::runtime_error("No chip and line found for pin no. " + std::to_string(pin));
     }
-    auto pair = record->second;
-    chip = *pair.first;
-    line = pair.second;
+    chip = record->chip;
+    line = record->line;
+}
+
+std::optional<::std::size_t> GpioResolver::resolveLineName(const ::std::string& chip,
+                                                           const ::std::string& lineName) const {
+    return gpioMap.findLine(chip, lineName);
 }
 
 void GpioResolver::dump() const {
-    for (const auto& record : gpioMap) {
-        std::cout << *record.second.first
-                  << " - line "
-                  << record.second.second
-                  << " (pin " << record.first << ')'
-                  << std::endl;
+    for (const auto& chip : gpioMap.getChips()) {
+        for (std::size_t line = 0; line < chip.lineCount; ++line) {
+            std::cout << chip.name
+                      << " - line "
+                      << line
+                      << " (pin " << chip.firstPin + line << ')'
+                      << std::endl;
+        }
     }
 }
 
@@ -0,0 +1,173 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioTopologyCache.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-25
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include "iqrf/gpio/GpioTopologyCache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace iqrf::gpio {
+
+/**
+ * Cache file header
+ */
+struct GpioTopologyFileHeader {
+    /// Magic bytes
+    char magic[4];
+    /// Format version
+    uint32_t version;
+    /// Number of records
+    uint32_t count;
+    /// Reserved, zero
+    uint32_t reserved;
+};
+
+/**
+ * Cache file record
+ */
+struct GpioTopologyFileRecord {
+    /// Chip name, null terminated
+    char name[GpioTopologyCache::MAX_NAME_LENGTH + 1];
+    /// Chip record
+    GpioTopologyRecord record;
+};
+
+GpioTopologyCache::GpioTopologyCache(std::string path, std::string deviceDirectory)
+    : path(std::move(path)), deviceDirectory(std::move(deviceDirectory)) {
+    this->load();
+}
+
+std::optional<std::size_t> GpioTopologyCache::find(const std::string& chip) {
+    const auto it = this->records.find(chip);
+    const auto node = this->statNode(chip);
+    if (it == this->records.end() || !node
+        || it->second.device != node->device || it->second.inode != node->inode
+        || it->second.ctimeSec != node->ctimeSec || it->second.ctimeNsec != node->ctimeNsec) {
+        this->stats.misses++;
+        return std::nullopt;
+    }
+    this->stats.hits++;
+    return static_cast<std::size_t>(it->second.lineCount);
+}
+
+void GpioTopologyCache::store(const std::string& chip, const std::size_t lineCount) {
+    auto node = this->statNode(chip);
+    if (!node || chip.size() > MAX_NAME_LENGTH) {
+        return;
+    }
+    node->lineCount = lineCount;
+    this->records.insert_or_assign(chip, *node);
+    this->save();
+}
+
+const GpioTopologyCacheStats& GpioTopologyCache::getStats() const {
+    return this->stats;
+}
+
+void GpioTopologyCache::load() {
+    const int fd = open(this->path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(GpioTopologyFileHeader)) {
+        close(fd);
+        return;
+    }
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return;
+    }
+    GpioTopologyFileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION
+        && size == sizeof(header) + header.count * sizeof(GpioTopologyFileRecord)) {
+        const auto *bytes = static_cast<const char*>(data) + sizeof(header);
+        for (uint32_t i = 0; i < header.count; ++i) {
+            GpioTopologyFileRecord record;
+            std::memcpy(&record, bytes + i * sizeof(record), sizeof(record));
+            record.name[MAX_NAME_LENGTH] = '\0';
+            this->records.insert_or_assign(record.name, record.record);
+        }
+    }
+    munmap(data, size);
+}
+
+bool GpioTopologyCache::save() const {
+    std::vector<char> buffer(sizeof(GpioTopologyFileHeader) + this->records.size() * sizeof(GpioTopologyFileRecord));
+    GpioTopologyFileHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.count = static_cast<uint32_t>(this->records.size());
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    char *bytes = buffer.data() + sizeof(header);
+    for (const auto& [name, record] : this->records) {
+        GpioTopologyFileRecord fileRecord = {};
+        std::memcpy(fileRecord.name, name.data(), name.size());
+        fileRecord.record = record;
+        std::memcpy(bytes, &fileRecord, sizeof(fileRecord));
+        bytes += sizeof(fileRecord);
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(this->path).parent_path(), ec);
+    // Readers never see a partially written file
+    const std::string tmpPath = this->path + ".tmp." + std::to_string(getpid());
+    const int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    std::size_t written = 0;
+    while (written < buffer.size()) {
+        const ssize_t ret = write(fd, buffer.data() + written, buffer.size() - written);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        written += static_cast<std::size_t>(ret);
+    }
+    close(fd);
+    if (written != buffer.size() || rename(tmpPath.c_str(), this->path.c_str()) != 0) {
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::optional<GpioTopologyRecord> GpioTopologyCache::statNode(const std::string& chip) const {
+    struct stat st = {};
+    if (stat((this->deviceDirectory + "/" + chip).c_str(), &st) != 0) {
+        return std::nullopt;
+    }
+    GpioTopologyRecord record;
+    record.device = static_cast<uint64_t>(st.st_rdev);
+    record.inode = static_cast<uint64_t>(st.st_ino);
+    record.ctimeSec = static_cast<int64_t>(st.st_ctim.tv_sec);
+    record.ctimeNsec = static_cast<int64_t>(st.st_ctim.tv_nsec);
+    return record;
+}
+
+}  // namespace iqrf::gpio
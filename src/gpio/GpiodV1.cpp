@@ -16,18 +16,57 @@
 
 #include "iqrf/gpio/GpiodV1.h"
 
+#include <poll.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+
 namespace iqrf::gpio {
 
-Gpiod::Gpiod(const GpioConfig& config) : chip(::gpiod::chip(config.chip)) {
-    if (!chip) {
-        throw std::runtime_error("No GPIO chip '" + config.chip + "' found");
-    }
+/**
+ * Returns the shared handle of the chip
+ * @param name GPIO chip name
+ * @return Chip handle
+ * @throws std::runtime_error if the chip is not found
+ */
+static std::shared_ptr<::gpiod::chip> acquireChip(const std::string& name) {
+    return GpiodChipRegistry::instance().acquire(name, [&name]() {
+        auto chip = std::make_shared<::gpiod::chip>(name);
+        if (!*chip) {
+            throw std::runtime_error("No GPIO chip '" + name + "' found");
+        }
+        return chip;
+    });
+}
 
+/**
+ * Returns the GPIO line of the configuration
+ * @param chip GPIO chip
+ * @param config GPIO configuration
+ * @return GPIO line, invalid if the line is not found
+ */
+static ::gpiod::line findLine(const ::gpiod::chip& chip, const GpioConfig& config) {
     if (config.line_name.empty()) {
-        line = chip.get_line(config.line);
-    } else {
-        line = chip.find_line(config.line_name);
+        return chip.get_line(config.line);
+    }
+    const auto offset = GpioResolver::GetResolver()->resolveLineName(config.chip, config.line_name);
+    if (offset) {
+        return chip.get_line(*offset);
     }
+    // Not indexed, e.g. the line has been named after the index was built
+    return chip.find_line(config.line_name);
+}
+
+Gpiod::Gpiod(const GpioConfig& config) : chip(acquireChip(config.chip)) {
+    line = findLine(*chip, config);
     if (!line) {
         throw std::runtime_error("No line '"
             + (config.line_name.empty() ? std::to_string(config.line) : config.line_name)
@@ -44,34 +83,50 @@ Gpiod::~Gpiod() {
 }
 
 void Gpiod::initInput() {
+    // A pending wait for the edge events uses the request, it is released after the wait
+    std::lock_guard<std::mutex> eventLock(eventMutex);
+    std::lock_guard<std::mutex> lock(stateMutex);
     // To be safe check whether the line wasn't already initialised
     if (line.is_requested()) {
         line.release();
     }
+    direction.reset();
+    outputValue.reset();
 
     // Request the access to the line
     ::gpiod::line_request req_conf;
     req_conf.consumer = name;
     req_conf.request_type = ::gpiod::line_request::DIRECTION_INPUT;
     line.request(req_conf);
+    direction = GpioDirection::Input;
 }
 
 void Gpiod::initOutput(const bool initialValue) {
+    std::lock_guard<std::mutex> eventLock(eventMutex);
+    std::lock_guard<std::mutex> lock(stateMutex);
     // To be safe check whether the line wasn't already initialised
-    if (line.is_requested())
+    if (line.is_requested()) {
         line.release();
+    }
+    direction.reset();
+    outputValue.reset();
 
-    // Request the access to the line
+    // Request the access to the line, the initial value is set by the request
     ::gpiod::line_request req_conf;
     req_conf.consumer = name;
     req_conf.request_type = ::gpiod::line_request::DIRECTION_OUTPUT;
-    line.request(req_conf);
-
-    this->setValue(initialValue);
+    line.request(req_conf, initialValue ? 1 : 0);
+    direction = GpioDirection::Output;
+    outputValue = initialValue;
 }
 
-void Gpiod::setDirection(const iqrf::gpio::GpioDirection direction) {
-    switch (direction) {
+void Gpiod::setDirection(const iqrf::gpio::GpioDirection newDirection) {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (line.is_requested() && direction == newDirection) {
+        stats.skippedWrites++;
+        return;
+    }
+    switch (newDirection) {
         case GpioDirection::Output:
             line.set_direction_output();
             break;
@@ -81,11 +136,23 @@ void Gpiod::setDirection(const iqrf::gpio::GpioDirection direction) {
         default:
             throw ::std::invalid_argument("Unknown direction");
     }
+    stats.writes++;
+    direction = newDirection;
+    // The output value is not set by the reconfiguration
+    outputValue.reset();
 }
 
 iqrf::gpio::GpioDirection Gpiod::getDirection() {
-    const int direction = line.direction();
-    switch (direction) {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (line.is_requested() && direction) {
+        stats.directionHits++;
+        return *direction;
+    }
+    // Refresh the line info, the line may be requested by someone else
+    stats.directionQueries++;
+    line.update();
+    const int lineDirection = line.direction();
+    switch (lineDirection) {
         case ::gpiod::line::DIRECTION_OUTPUT:
             return iqrf::gpio::GpioDirection::Output;
         case ::gpiod::line::DIRECTION_INPUT:
@@ -95,12 +162,181 @@ iqrf::gpio::GpioDirection Gpiod::getDirection() {
     }
 }
 
-void Gpiod::setValue(bool value) {
+void Gpiod::writeValue(const bool value) {
     line.set_value(value);
+    stats.writes++;
+    outputValue = value;
 }
 
-bool Gpiod::getValue() {
+bool Gpiod::readValue() {
     return line.get_value();
 }
 
+GpioLineStats Gpiod::getStats() const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return stats;
+}
+
+void Gpiod::initEdgeInput(const GpioEventConfig& config) {
+    std::lock_guard<std::mutex> eventLock(eventMutex);
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (line.is_requested()) {
+        line.release();
+    }
+    direction.reset();
+    outputValue.reset();
+
+    ::gpiod::line_request req_conf;
+    req_conf.consumer = name;
+    switch (config.edge) {
+        case GpioEdge::Rising:
+            req_conf.request_type = ::gpiod::line_request::EVENT_RISING_EDGE;
+            break;
+        case GpioEdge::Falling:
+            req_conf.request_type = ::gpiod::line_request::EVENT_FALLING_EDGE;
+            break;
+        default:
+            req_conf.request_type = ::gpiod::line_request::EVENT_BOTH_EDGES;
+            break;
+    }
+    line.request(req_conf);
+    direction = GpioDirection::Input;
+    debounce = config.debounce;
+    lastEvent.reset();
+}
+
+std::optional<GpioEvent> Gpiod::waitEvent(const std::chrono::nanoseconds timeout) {
+    // Held for the whole wait, the line is released and requested again under it
+    std::lock_guard<std::mutex> eventLock(eventMutex);
+    const int fd = this->getEventFd();
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        int waitMs = -1;
+        if (timeout.count() >= 0) {
+            const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+            waitMs = static_cast<int>(std::max<int64_t>(remaining.count(), 0));
+        }
+        struct pollfd pfd = {fd, POLLIN, 0};
+        const int ret = ::poll(&pfd, 1, waitMs);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "Failed to wait for GPIO line event");
+        }
+        if (ret == 0) {
+            return std::nullopt;
+        }
+        const ::gpiod::line_event event = line.event_read();
+        GpioEvent result;
+        result.edge = event.event_type == ::gpiod::line_event::RISING_EDGE ? GpioEdge::Rising : GpioEdge::Falling;
+        result.timestamp = event.timestamp;
+        if (lastEvent && result.timestamp - *lastEvent < debounce) {
+            // Bounce of the last reported edge
+            continue;
+        }
+        lastEvent = result.timestamp;
+        return result;
+    }
+}
+
+int Gpiod::getEventFd() {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (!line.is_requested()) {
+        throw std::logic_error("GPIO line is not initialized");
+    }
+    return line.event_get_fd();
+}
+
+GpiodGroup::GpiodGroup(const std::vector<GpioConfig>& configs) {
+    if (configs.empty()) {
+        throw std::invalid_argument("GPIO group is empty");
+    }
+    chip = acquireChip(configs.front().chip);
+    for (const auto& config : configs) {
+        if (config.chip != configs.front().chip) {
+            throw std::invalid_argument("GPIO group lines have to be on the same chip");
+        }
+        ::gpiod::line line = findLine(*chip, config);
+        if (!line) {
+            throw std::runtime_error("No line '"
+                + (config.line_name.empty() ? std::to_string(config.line) : config.line_name)
+                + "' found at chip '" + config.chip + "'");
+        }
+        lines.append(line);
+    }
+    values.resize(lines.size(), 0);
+    name = configs.front().consumer_name;
+}
+
+GpiodGroup::~GpiodGroup() {
+    release();
+}
+
+void GpiodGroup::release() {
+    if (lines.size() > 0 && lines.get(0).is_requested()) {
+        lines.release();
+    }
+}
+
+void GpiodGroup::initInput() {
+    release();
+    outputValues.reset();
+    ::gpiod::line_request req_conf;
+    req_conf.consumer = name;
+    req_conf.request_type = ::gpiod::line_request::DIRECTION_INPUT;
+    lines.request(req_conf);
+}
+
+void GpiodGroup::initOutput(const uint64_t initialValues) {
+    release();
+    outputValues.reset();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>((initialValues >> i) & 1U);
+    }
+    ::gpiod::line_request req_conf;
+    req_conf.consumer = name;
+    req_conf.request_type = ::gpiod::line_request::DIRECTION_OUTPUT;
+    lines.request(req_conf, values);
+    outputValues = initialValues & mask();
+}
+
+void GpiodGroup::setValues(const uint64_t newValues) {
+    if (outputValues == (newValues & mask())) {
+        stats.skippedWrites++;
+        return;
+    }
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>((newValues >> i) & 1U);
+    }
+    // Single ioctl for all lines
+    lines.set_values(values);
+    stats.writes++;
+    outputValues = newValues & mask();
+}
+
+uint64_t GpiodGroup::getValues() {
+    if (outputValues) {
+        stats.valueHits++;
+        return *outputValues;
+    }
+    const std::vector<int> current = lines.get_values();
+    uint64_t result = 0;
+    for (std::size_t i = 0; i < current.size(); ++i) {
+        if (current[i] != 0) {
+            result |= uint64_t{1} << i;
+        }
+    }
+    return result;
+}
+
+GpioLineStats GpiodGroup::getStats() const {
+    return stats;
+}
+
+uint64_t GpiodGroup::mask() const {
+    return values.size() >= 64 ? ~uint64_t{0} : (uint64_t{1} << values.size()) - 1;
+}
+
 }  // namespace iqrf::gpio
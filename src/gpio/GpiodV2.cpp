@@ -16,16 +16,77 @@
 
 #include "iqrf/gpio/GpiodV2.h"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace iqrf::gpio {
 
+/**
+ * Returns the path of the chip device
+ * @param name GPIO chip name
+ * @return Chip device path
+ */
+static ::std::filesystem::path chipDevicePath(const std::string& name) {
+    return ::std::filesystem::path("/dev/" + name);
+}
+
+/**
+ * Returns the shared handle of the chip
+ * @param name GPIO chip name
+ * @return Chip handle
+ */
+static std::shared_ptr<::gpiod::chip> acquireChip(const std::string& name) {
+    return GpiodChipRegistry::instance().acquire(name, [&name]() {
+        return std::make_shared<::gpiod::chip>(chipDevicePath(name));
+    });
+}
+
+/**
+ * Converts the gpiod line direction
+ * @param direction gpiod line direction
+ * @return GPIO line direction
+ * @throws std::out_of_range for unknown direction
+ */
+static GpioDirection toDirection(const ::gpiod::line::direction direction) {
+    switch (direction) {
+        case ::gpiod::line::direction::OUTPUT:
+            return iqrf::gpio::GpioDirection::Output;
+        case ::gpiod::line::direction::INPUT:
+            return iqrf::gpio::GpioDirection::Input;
+        default:
+            throw ::std::out_of_range("Unknown direction");
+    }
+}
+
+/**
+ * Returns the offset of the named line
+ * @param chip GPIO chip
+ * @param config GPIO configuration with the line name
+ * @return Line offset or -1 if the line is not found
+ */
+static int findLineOffset(const ::gpiod::chip& chip, const GpioConfig& config) {
+    const auto offset = GpioResolver::GetResolver()->resolveLineName(config.chip, config.line_name);
+    if (offset) {
+        return static_cast<int>(*offset);
+    }
+    // Not indexed, e.g. the line has been named after the index was built
+    return chip.get_line_offset_from_name(config.line_name);
+}
+
 Gpiod::Gpiod(const GpioConfig& config)
-    : chip(std::make_unique<::gpiod::chip>(::std::filesystem::path("/dev/" + config.chip))) {
+    : chip(acquireChip(config.chip)), chipPath(chipDevicePath(config.chip)) {
     if (config.line_name.empty()) {
         line = config.line;
     } else {
-        int offset = chip->get_line_offset_from_name(config.line_name);
+        int offset = findLineOffset(*chip, config);
         if (offset >= 0) {
             line = offset;
         } else {
@@ -40,6 +101,13 @@ Gpiod::~Gpiod() {
 }
 
 void Gpiod::initInput() {
+    // A pending wait for the edge events uses the request, it is released after the wait
+    std::lock_guard<std::mutex> eventLock(eventMutex);
+    std::lock_guard<std::mutex> lock(stateMutex);
+    // Release the previous request first, the line would be busy otherwise
+    request.reset();
+    direction.reset();
+    outputValue.reset();
     // Initialize line request
     request = std::make_unique<::gpiod::line_request>(
         chip->prepare_request()
@@ -50,11 +118,17 @@ void Gpiod::initInput() {
                     .set_direction(::gpiod::line::direction::INPUT)
             )
             .do_request());
+    direction = GpioDirection::Input;
 }
 
 void Gpiod::initOutput(const bool initialValue) {
     const auto val = initialValue ? ::gpiod::line::value::ACTIVE : ::gpiod::line::value::INACTIVE;
 
+    std::lock_guard<std::mutex> eventLock(eventMutex);
+    std::lock_guard<std::mutex> lock(stateMutex);
+    request.reset();
+    direction.reset();
+    outputValue.reset();
     // Initialize line request
     request = std::make_unique<::gpiod::line_request>(
         chip->prepare_request()
@@ -66,13 +140,20 @@ void Gpiod::initOutput(const bool initialValue) {
                     .set_output_value(val)
             )
             .do_request());
+    direction = GpioDirection::Output;
+    outputValue = initialValue;
 }
 
-void Gpiod::setDirection(const iqrf::gpio::GpioDirection direction) {
-    const auto dir = direction == iqrf::gpio::GpioDirection::Input ?
+void Gpiod::setDirection(const iqrf::gpio::GpioDirection newDirection) {
+    const auto dir = newDirection == iqrf::gpio::GpioDirection::Input ?
         ::gpiod::line::direction::INPUT :
         ::gpiod::line::direction::OUTPUT;
 
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (request && direction == newDirection) {
+        stats.skippedWrites++;
+        return;
+    }
     // Reconfigure line direction
     request->reconfigure_lines(
         ::gpiod::line_config()
@@ -82,28 +163,325 @@ void Gpiod::setDirection(const iqrf::gpio::GpioDirection direction) {
                     .set_direction(dir)
             )
     );  // NOLINT(whitespace/parens)
+    stats.writes++;
+    direction = newDirection;
+    // The output value is not set by the reconfiguration
+    outputValue.reset();
 }
 
 iqrf::gpio::GpioDirection Gpiod::getDirection() {
-    // Get line direction
-    const auto direction = chip->get_line_info(line).direction();
-    switch (direction) {
-        case ::gpiod::line::direction::OUTPUT:
-            return iqrf::gpio::GpioDirection::Output;
-        case ::gpiod::line::direction::INPUT:
-            return iqrf::gpio::GpioDirection::Input;
-        default:
-            throw ::std::out_of_range("Unknown direction");
+    std::unique_lock<std::mutex> lock(stateMutex);
+    std::vector<GpioLineInfoEvent> infoEvents;
+    if (!request && infoChip) {
+        // The changes made by someone else are reported by the watch only
+        infoEvents = drainLineInfoEvents();
+    }
+    std::optional<GpioDirection> result;
+    if ((request || infoChip) && direction) {
+        stats.directionHits++;
+        result = direction;
+    } else {
+        // Get line direction, the line may be requested by someone else
+        stats.directionQueries++;
+        result = toDirection(chip->get_line_info(line).direction());
+        if (infoChip) {
+            direction = result;
+        }
     }
+    lock.unlock();
+    notifyLineInfo(infoEvents);
+    return *result;
 }
 
-void Gpiod::setValue(const bool value) {
-    const auto val = value ? ::gpiod::line::value::ACTIVE : ::gpiod::line::value::INACTIVE;
-    request->set_value(line, val);
+void Gpiod::writeValue(const bool value) {
+    request->set_value(line, value ? ::gpiod::line::value::ACTIVE : ::gpiod::line::value::INACTIVE);
+    stats.writes++;
+    outputValue = value;
 }
 
-bool Gpiod::getValue() {
+bool Gpiod::readValue() {
     return request->get_value(line) == ::gpiod::line::value::ACTIVE;
 }
 
+void Gpiod::watchLineInfo() {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (infoChip) {
+        return;
+    }
+    auto watcher = std::make_unique<::gpiod::chip>(chipPath);
+    const auto info = watcher->watch_line_info(line);
+    if (!request) {
+        direction = toDirection(info.direction());
+    }
+    infoChip = std::move(watcher);
+}
+
+std::size_t Gpiod::registerLineInfoCallback(const GpioLineInfoCallback& callback) {
+    watchLineInfo();
+    std::lock_guard<std::mutex> lock(stateMutex);
+    const std::size_t id = nextCallbackId++;
+    infoCallbacks.emplace_back(id, callback);
+    return id;
+}
+
+void Gpiod::unregisterLineInfoCallback(const std::size_t id) {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    for (auto it = infoCallbacks.begin(); it != infoCallbacks.end(); ++it) {
+        if (it->first == id) {
+            infoCallbacks.erase(it);
+            return;
+        }
+    }
+}
+
+int Gpiod::getLineInfoFd() {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (!infoChip) {
+        throw std::logic_error("GPIO line information is not watched");
+    }
+    return infoChip->fd();
+}
+
+std::size_t Gpiod::readLineInfoEvents(const std::chrono::nanoseconds timeout) {
+    ::gpiod::chip* watcher;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        if (!infoChip) {
+            throw std::logic_error("GPIO line information is not watched");
+        }
+        watcher = infoChip.get();
+    }
+    // Waits without the state mutex, the watch handle is kept until the instance is destroyed
+    if (timeout.count() != 0 && !watcher->wait_info_event(timeout)) {
+        return 0;
+    }
+    std::vector<GpioLineInfoEvent> infoEvents;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        infoEvents = drainLineInfoEvents();
+    }
+    notifyLineInfo(infoEvents);
+    return infoEvents.size();
+}
+
+std::vector<GpioLineInfoEvent> Gpiod::drainLineInfoEvents() {
+    std::vector<GpioLineInfoEvent> infoEvents;
+    while (infoChip->wait_info_event(std::chrono::nanoseconds(0))) {
+        const auto event = infoChip->read_info_event();
+        const auto& info = event.get_line_info();
+        GpioLineInfoEvent infoEvent;
+        switch (event.type()) {
+            case ::gpiod::info_event::event_type::LINE_REQUESTED:
+                infoEvent.change = GpioLineChange::Requested;
+                break;
+            case ::gpiod::info_event::event_type::LINE_RELEASED:
+                infoEvent.change = GpioLineChange::Released;
+                break;
+            default:
+                infoEvent.change = GpioLineChange::Reconfigured;
+                break;
+        }
+        infoEvent.direction = toDirection(info.direction());
+        infoEvent.used = info.used();
+        infoEvent.consumer = info.consumer();
+        infoEvents.push_back(std::move(infoEvent));
+    }
+    if (!infoEvents.empty()) {
+        // Queried again on the next access, the event may describe an older state
+        stats.infoEvents += infoEvents.size();
+        direction.reset();
+        outputValue.reset();
+    }
+    return infoEvents;
+}
+
+void Gpiod::notifyLineInfo(const std::vector<GpioLineInfoEvent>& infoEvents) {
+    if (infoEvents.empty()) {
+        return;
+    }
+    std::vector<std::pair<std::size_t, GpioLineInfoCallback>> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        callbacks = infoCallbacks;
+    }
+    for (const auto& infoEvent : infoEvents) {
+        for (const auto& [id, callback] : callbacks) {
+            callback(infoEvent);
+        }
+    }
+}
+
+GpioLineStats Gpiod::getStats() const {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return stats;
+}
+
+void Gpiod::initEdgeInput(const GpioEventConfig& config) {
+    ::gpiod::line::edge edge;
+    switch (config.edge) {
+        case GpioEdge::Rising:
+            edge = ::gpiod::line::edge::RISING;
+            break;
+        case GpioEdge::Falling:
+            edge = ::gpiod::line::edge::FALLING;
+            break;
+        default:
+            edge = ::gpiod::line::edge::BOTH;
+            break;
+    }
+    const auto clock = config.hardwareTimestamps ? ::gpiod::line::clock::HTE : ::gpiod::line::clock::MONOTONIC;
+
+    std::lock_guard<std::mutex> eventLock(eventMutex);
+    std::lock_guard<std::mutex> lock(stateMutex);
+    // Release the previous request first, the line would be busy otherwise
+    request.reset();
+    direction.reset();
+    outputValue.reset();
+    eventCount = 0;
+    eventIndex = 0;
+    request = std::make_unique<::gpiod::line_request>(
+        chip->prepare_request()
+            .set_consumer(name)
+            .add_line_settings(
+                line,
+                ::gpiod::line_settings()
+                    .set_direction(::gpiod::line::direction::INPUT)
+                    .set_edge_detection(edge)
+                    .set_debounce_period(config.debounce)
+                    .set_event_clock(clock)
+            )
+            .do_request());
+    direction = GpioDirection::Input;
+}
+
+std::optional<GpioEvent> Gpiod::waitEvent(const std::chrono::nanoseconds timeout) {
+    // Held for the whole wait, the request and the event buffer are replaced under it
+    std::lock_guard<std::mutex> eventLock(eventMutex);
+    if (!request) {
+        throw std::logic_error("GPIO line is not initialized");
+    }
+    if (eventIndex >= eventCount) {
+        if (!request->wait_edge_events(timeout)) {
+            return std::nullopt;
+        }
+        // Drain all pending events by a single read
+        eventCount = request->read_edge_events(events);
+        eventIndex = 0;
+        if (eventCount == 0) {
+            return std::nullopt;
+        }
+    }
+    const auto& event = events.get_event(eventIndex++);
+    GpioEvent result;
+    result.edge = event.type() == ::gpiod::edge_event::event_type::RISING_EDGE ? GpioEdge::Rising : GpioEdge::Falling;
+    result.timestamp = std::chrono::nanoseconds(static_cast<uint64_t>(event.timestamp_ns()));
+    return result;
+}
+
+int Gpiod::getEventFd() {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (!request) {
+        throw std::logic_error("GPIO line is not initialized");
+    }
+    return request->fd();
+}
+
+GpiodGroup::GpiodGroup(const std::vector<GpioConfig>& configs) {
+    if (configs.empty()) {
+        throw std::invalid_argument("GPIO group is empty");
+    }
+    chip = acquireChip(configs.front().chip);
+    for (const auto& config : configs) {
+        if (config.chip != configs.front().chip) {
+            throw std::invalid_argument("GPIO group lines have to be on the same chip");
+        }
+        if (config.line_name.empty()) {
+            offsets.push_back(config.line);
+            continue;
+        }
+        int offset = findLineOffset(*chip, config);
+        if (offset < 0) {
+            throw std::runtime_error("No line '" + config.line_name + "' found at chip '" + config.chip + "'");
+        }
+        offsets.push_back(offset);
+    }
+    values.resize(offsets.size(), ::gpiod::line::value::INACTIVE);
+    name = configs.front().consumer_name;
+}
+
+GpiodGroup::~GpiodGroup() {
+    request.reset();
+    chip.reset();
+}
+
+void GpiodGroup::initInput() {
+    // Release the previous request first, the lines would be busy otherwise
+    request.reset();
+    outputValues.reset();
+    request = std::make_unique<::gpiod::line_request>(
+        chip->prepare_request()
+            .set_consumer(name)
+            .add_line_settings(
+                offsets,
+                ::gpiod::line_settings()
+                    .set_direction(::gpiod::line::direction::INPUT)
+            )
+            .do_request());
+}
+
+void GpiodGroup::initOutput(const uint64_t initialValues) {
+    request.reset();
+    outputValues.reset();
+    auto builder = chip->prepare_request();
+    builder.set_consumer(name);
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        const bool active = (initialValues >> i) & 1U;
+        builder.add_line_settings(
+            offsets[i],
+            ::gpiod::line_settings()
+                .set_direction(::gpiod::line::direction::OUTPUT)
+                .set_output_value(active ? ::gpiod::line::value::ACTIVE : ::gpiod::line::value::INACTIVE)
+        );
+    }
+    request = std::make_unique<::gpiod::line_request>(builder.do_request());
+    outputValues = initialValues & mask();
+}
+
+void GpiodGroup::setValues(const uint64_t newValues) {
+    if (outputValues == (newValues & mask())) {
+        stats.skippedWrites++;
+        return;
+    }
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        values[i] = ((newValues >> i) & 1U) ? ::gpiod::line::value::ACTIVE : ::gpiod::line::value::INACTIVE;
+    }
+    // Single ioctl for all lines
+    request->set_values(offsets, values);
+    stats.writes++;
+    outputValues = newValues & mask();
+}
+
+uint64_t GpiodGroup::getValues() {
+    if (outputValues) {
+        stats.valueHits++;
+        return *outputValues;
+    }
+    request->get_values(offsets, values);
+    uint64_t result = 0;
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        if (values[i] == ::gpiod::line::value::ACTIVE) {
+            result |= uint64_t{1} << i;
+        }
+    }
+    return result;
+}
+
+GpioLineStats GpiodGroup::getStats() const {
+    return stats;
+}
+
+uint64_t GpiodGroup::mask() const {
+    return offsets.size() >= 64 ? ~uint64_t{0} : (uint64_t{1} << offsets.size()) - 1;
+}
+
 }  // namespace iqrf::gpio
@@ -0,0 +1,130 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: Waveform.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-26
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include "iqrf/gpio/Waveform.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace iqrf::gpio {
+
+/**
+ * Returns the current time of the monotonic clock
+ * @return Time since the clock epoch
+ */
+static std::chrono::nanoseconds monotonicNow() {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+/**
+ * Blocks the calling thread until the deadline of the monotonic clock
+ * @param deadline Time since the clock epoch
+ */
+static void monotonicSleepUntil(const std::chrono::nanoseconds deadline) {
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(deadline);
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(seconds.count());
+    ts.tv_nsec = static_cast<long>((deadline - seconds).count());
+    // The deadline is absolute, so an interrupted sleep is simply restarted
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+    }
+}
+
+WaveformEngine::WaveformEngine(WaveformConfig config) : config(config) {}
+
+WaveformEngine::~WaveformEngine() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->condition.notify_all();
+    if (this->worker.joinable()) {
+        this->worker.join();
+    }
+}
+
+std::future<WaveformResult> WaveformEngine::submit(Waveform waveform) {
+    if (!waveform.writer) {
+        throw std::invalid_argument("GPIO waveform has no writer");
+    }
+    std::future<WaveformResult> future;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        Job job{std::move(waveform), std::promise<WaveformResult>()};
+        future = job.promise.get_future();
+        this->jobs.push_back(std::move(job));
+        if (!this->worker.joinable()) {
+            this->worker = std::thread(&WaveformEngine::run, this);
+        }
+    }
+    this->condition.notify_one();
+    return future;
+}
+
+void WaveformEngine::run() {
+    if (this->config.realtime) {
+        sched_param param{};
+        param.sched_priority = this->config.priority;
+        const bool applied = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->realtime = applied;
+    }
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->condition.wait(lock, [this] {
+                return this->stopping || !this->jobs.empty();
+            });
+            if (this->stopping) {
+                return;
+            }
+            job = std::move(this->jobs.front());
+            this->jobs.pop_front();
+        }
+        try {
+            job.promise.set_value(this->play(job.waveform));
+        } catch (...) {
+            job.promise.set_exception(std::current_exception());
+        }
+    }
+}
+
+WaveformResult WaveformEngine::play(const Waveform& waveform) const {
+    const auto now = waveform.timer.now ? waveform.timer.now : monotonicNow;
+    const auto sleepUntil = waveform.timer.sleepUntil ? waveform.timer.sleepUntil : monotonicSleepUntil;
+    WaveformResult result;
+    result.realtime = this->realtime;
+    result.jitter.reserve(waveform.steps.size());
+    // The first step is due immediately, so its lateness is the time spent by the writer only
+    std::chrono::nanoseconds deadline = now();
+    for (const auto& step : waveform.steps) {
+        sleepUntil(deadline);
+        waveform.writer(step.values, step.mask);
+        const auto jitter = std::max(now() - deadline, std::chrono::nanoseconds::zero());
+        result.jitter.push_back(jitter);
+        result.maxJitter = std::max(result.maxJitter, jitter);
+        deadline += step.hold;
+    }
+    sleepUntil(deadline);
+    return result;
+}
+
+}  // namespace iqrf::gpio
@@ -0,0 +1,206 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: AsyncLog.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-27
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include "iqrf/log/AsyncLog.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace iqrf::log {
+
+/**
+ * Rounds the queue capacity up to a power of two.
+ *
+ * @param capacity is the requested capacity.
+ * @return Queue capacity.
+ * @throws std::invalid_argument if the capacity is zero
+ */
+static std::size_t queueCapacity(const std::size_t capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Log queue capacity cannot be zero");
+    }
+    std::size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    return rounded;
+}
+
+AsyncLog::AsyncLog(std::unique_ptr<ILog> sink, const AsyncLogConfig &config):
+    sink(std::move(sink)),
+    overflow(config.overflow),
+    maxBatch(std::max<std::size_t>(config.maxBatch, 1)),
+    slots(queueCapacity(config.capacity)),
+    mask(this->slots.size() - 1) {
+    if (!this->sink) {
+        throw std::invalid_argument("Log sink cannot be null");
+    }
+    for (std::size_t i = 0; i < this->slots.size(); ++i) {
+        this->slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    this->worker = std::thread(&AsyncLog::run, this);
+}
+
+AsyncLog::~AsyncLog() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->queued.notify_all();
+    this->worker.join();
+}
+
+void AsyncLog::append(const std::string& msg) {
+    this->append(msg, Level::Info);
+}
+
+void AsyncLog::append(const std::string& msg, const Level& severity) {
+    if (!this->push(msg, severity)) {
+        return;
+    }
+    this->wake();
+    if (severity == Level::Fatal) {
+        // The process is likely to end right after a fatal message
+        this->flush();
+    }
+}
+
+void AsyncLog::flush() {
+    const std::size_t target = this->enqueuePosition.load();
+    this->wake();
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->flushed.wait(lock, [this, target] {
+        return this->writtenPosition.load() >= target;
+    });
+}
+
+AsyncLogStats AsyncLog::getStats() const {
+    AsyncLogStats stats;
+    stats.written = this->written.load();
+    stats.dropped = this->dropped.load();
+    stats.batches = this->batches.load();
+    return stats;
+}
+
+bool AsyncLog::push(const std::string& msg, const Level severity) {
+    std::size_t position = this->enqueuePosition.load(std::memory_order_relaxed);
+    while (true) {
+        Slot &slot = this->slots[position & this->mask];
+        const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+        if (difference == 0) {
+            // The slot is free, claim the position
+            if (this->enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                slot.severity = severity;
+                slot.message.assign(msg);
+                slot.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (difference < 0) {
+            // The queue is full, fatal messages are never dropped
+            if (this->overflow == OverflowPolicy::Drop && severity != Level::Fatal) {
+                this->dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            this->wake();
+            std::this_thread::yield();
+            position = this->enqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            // Another thread has claimed the position
+            position = this->enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void AsyncLog::wake() {
+    // Pairs with the fence of the background thread going idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (this->idle.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->queued.notify_one();
+    }
+}
+
+void AsyncLog::run() {
+    const auto ready = [this] {
+        const Slot &slot = this->slots[this->dequeuePosition & this->mask];
+        return slot.sequence.load(std::memory_order_acquire) == this->dequeuePosition + 1;
+    };
+    std::vector<std::string_view> batch;
+    batch.reserve(this->maxBatch);
+    Level batchSeverity = Level::Info;
+    std::size_t releasePosition = this->dequeuePosition;
+    const auto write = [this, &batch, &batchSeverity, &releasePosition] {
+        this->sink->appendBatch(batch, batchSeverity);
+        this->batches.fetch_add(1, std::memory_order_relaxed);
+        batch.clear();
+        // The batch refers to the messages in their slots, release them once written
+        for (; releasePosition != this->dequeuePosition; ++releasePosition) {
+            this->slots[releasePosition & this->mask].sequence.store(
+                releasePosition + this->slots.size(), std::memory_order_release
+            );
+        }
+    };
+    uint64_t reportedDrops = 0;
+    while (true) {
+        std::size_t count = 0;
+        while (count < this->maxBatch && ready()) {
+            const Slot &slot = this->slots[this->dequeuePosition & this->mask];
+            if (!batch.empty() && slot.severity != batchSeverity) {
+                write();
+            }
+            batchSeverity = slot.severity;
+            batch.emplace_back(slot.message);
+            ++this->dequeuePosition;
+            ++count;
+        }
+        if (!batch.empty()) {
+            write();
+        }
+        const uint64_t drops = this->dropped.load(std::memory_order_relaxed);
+        if (drops != reportedDrops) {
+            this->sink->append(
+                "[" + std::string(levelName(Level::Warning)) + "] " + std::to_string(drops - reportedDrops)
+                    + " log messages dropped, the log queue is full\n",
+                Level::Warning
+            );
+            reportedDrops = drops;
+        }
+        if (count > 0) {
+            this->written.fetch_add(count, std::memory_order_relaxed);
+            this->writtenPosition.store(this->dequeuePosition);
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->flushed.notify_all();
+            continue;
+        }
+        if (this->stopping) {
+            if (this->enqueuePosition.load() == this->dequeuePosition) {
+                return;
+            }
+            // A message is being copied into its slot
+            std::this_thread::yield();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->idle.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        this->queued.wait(lock, [this, &ready] {
+            return this->stopping || ready();
+        });
+        this->idle.store(false, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace iqrf::log
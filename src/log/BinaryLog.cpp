@@ -0,0 +1,496 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: BinaryLog.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-28
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include "iqrf/log/BinaryLog.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "iqrf/log/Hex.h"
+
+namespace iqrf::log {
+
+/// Binary stream magic
+static constexpr char MAGIC[4] = {'I', 'Q', 'B', 'L'};
+/// Binary stream version
+static constexpr uint32_t VERSION = 1;
+/// Byte order mark, the values are stored in the native byte order
+static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+/// Binary stream entry with a call site description
+static constexpr char FORMAT_ENTRY = 'F';
+/// Binary stream entry with a record
+static constexpr char RECORD_ENTRY = 'R';
+/// Size of the record header in a thread buffer: timestamp, format identifier and arguments size
+static constexpr std::size_t RECORD_HEADER_SIZE = sizeof(uint64_t) + 2 * sizeof(uint32_t);
+
+/**
+ * Records of a logging thread.
+ */
+struct ThreadBuffer {
+    /// Guards the records, contended only while the buffer is collected
+    std::mutex mutex;
+    /// Records, see RECORD_HEADER_SIZE
+    std::vector<uint8_t> data;
+};
+
+/**
+ * Process-wide binary logging state.
+ */
+struct BinaryLogState {
+    /// Guards the registered call sites
+    std::mutex formatMutex;
+    /// Registered call sites by their identifiers
+    std::vector<BinaryFormat> formats;
+    /// Guards the thread buffers
+    std::mutex bufferMutex;
+    /// Thread buffers, owned also by their threads
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    /// Whether a binary log is running
+    std::atomic<bool> running{false};
+    /// Maximal number of bytes buffered by a thread
+    std::atomic<std::size_t> bufferLimit{0};
+    /// Number of dropped records
+    std::atomic<uint64_t> dropped{0};
+};
+
+/**
+ * Returns the process-wide binary logging state.
+ *
+ * @return Binary logging state.
+ */
+static BinaryLogState& state() {
+    static BinaryLogState instance;
+    return instance;
+}
+
+/**
+ * Reads a value from the encoded bytes.
+ *
+ * @param data is the current position, advanced past the value.
+ * @param end is the end of the encoded bytes.
+ *
+ * @return Value.
+ * @throws std::runtime_error if the bytes end before the value
+ */
+template<typename T>
+static T readValue(const uint8_t *&data, const uint8_t *end) {
+    if (static_cast<std::size_t>(end - data) < sizeof(T)) {
+        throw std::runtime_error("Malformed binary log arguments");
+    }
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    data += sizeof(T);
+    return value;
+}
+
+/**
+ * Reads a value from the binary stream.
+ *
+ * @param input is the binary stream.
+ *
+ * @return Value.
+ * @throws std::runtime_error if the stream ends before the value
+ */
+template<typename T>
+static T readValue(std::istream& input) {
+    T value;
+    if (!input.read(reinterpret_cast<char *>(&value), sizeof(T))) {
+        throw std::runtime_error("Truncated binary log");
+    }
+    return value;
+}
+
+/**
+ * Reads a string prefixed by its length from the binary stream.
+ *
+ * @param input is the binary stream.
+ *
+ * @return String.
+ * @throws std::runtime_error if the stream ends before the string
+ */
+static std::string readString(std::istream& input) {
+    std::string text(readValue<uint32_t>(input), '\0');
+    if (!input.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+        throw std::runtime_error("Truncated binary log");
+    }
+    return text;
+}
+
+/**
+ * Writes a value to the binary stream.
+ *
+ * @param output is the binary stream.
+ * @param value is the value.
+ */
+template<typename T>
+static void writeValue(std::ostream& output, const T value) {
+    output.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/**
+ * Writes a string prefixed by its length to the binary stream.
+ *
+ * @param output is the binary stream.
+ * @param text is the string.
+ */
+static void writeString(std::ostream& output, const std::string_view text) {
+    writeValue(output, static_cast<uint32_t>(text.size()));
+    output.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+/**
+ * Formats the next encoded argument.
+ *
+ * @param output is the text output.
+ * @param data is the current position, advanced past the argument.
+ * @param end is the end of the encoded arguments.
+ * @throws std::runtime_error if the argument is malformed
+ */
+static void formatArgument(std::ostream& output, const uint8_t *&data, const uint8_t *end) {
+    const auto type = static_cast<BinaryArgument>(readValue<uint8_t>(data, end));
+    switch (type) {
+        case BinaryArgument::Signed:
+            output << readValue<int64_t>(data, end);
+            return;
+        case BinaryArgument::Unsigned:
+            output << readValue<uint64_t>(data, end);
+            return;
+        case BinaryArgument::Floating:
+            output << readValue<double>(data, end);
+            return;
+        case BinaryArgument::Boolean:
+            output << (readValue<uint8_t>(data, end) != 0);
+            return;
+        case BinaryArgument::Character:
+            output << readValue<char>(data, end);
+            return;
+        case BinaryArgument::String:
+        case BinaryArgument::Bytes:
+            break;
+        default:
+            throw std::runtime_error("Malformed binary log arguments");
+    }
+    const auto size = readValue<uint32_t>(data, end);
+    if (static_cast<std::size_t>(end - data) < size) {
+        throw std::runtime_error("Malformed binary log arguments");
+    }
+    if (type == BinaryArgument::String) {
+        output.write(reinterpret_cast<const char *>(data), size);
+    } else {
+        output << HexView(data, size);
+    }
+    data += size;
+}
+
+BinaryLog::BinaryLog(std::unique_ptr<ILog> sink, const BinaryLogConfig& config): sink(std::move(sink)) {
+    if (!this->sink) {
+        throw std::invalid_argument("Binary log sink cannot be null");
+    }
+    this->start(config);
+}
+
+BinaryLog::BinaryLog(std::unique_ptr<std::ostream> output, const BinaryLogConfig& config):
+    output(std::move(output)) {
+    if (!this->output) {
+        throw std::invalid_argument("Binary log output cannot be null");
+    }
+    this->output->write(MAGIC, sizeof(MAGIC));
+    writeValue(*this->output, VERSION);
+    writeValue(*this->output, BYTE_ORDER_MARK);
+    this->start(config);
+}
+
+BinaryLog::~BinaryLog() {
+    // New records are formatted immediately from now on. The final collection below locks each
+    // buffer after this, so the records committed while the flag was still set are collected.
+    state().running.store(false);
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->wake.notify_all();
+    this->worker.join();
+}
+
+void BinaryLog::flush() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    const uint64_t ticket = ++this->requested;
+    this->wake.notify_all();
+    this->collected.wait(lock, [this, ticket] {
+        return this->finished >= ticket;
+    });
+}
+
+BinaryLogStats BinaryLog::getStats() const {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    BinaryLogStats stats;
+    stats.records = this->records;
+    stats.dropped = state().dropped.load() - this->droppedAtStart;
+    return stats;
+}
+
+uint32_t BinaryLog::registerFormat(const BinaryFormat& format) {
+    std::lock_guard<std::mutex> lock(state().formatMutex);
+    state().formats.push_back(format);
+    return static_cast<uint32_t>(state().formats.size() - 1);
+}
+
+BinaryFormat BinaryLog::getFormat(const uint32_t id) {
+    std::lock_guard<std::mutex> lock(state().formatMutex);
+    return state().formats.at(id);
+}
+
+void BinaryLog::commit(const uint32_t id, const std::vector<uint8_t>& arguments) {
+    BinaryLogState& binaryState = state();
+    if (!binaryState.running.load(std::memory_order_acquire) || !BinaryLog::append(id, arguments)) {
+        const BinaryFormat format = BinaryLog::getFormat(id);
+        Logger::log->append(BinaryLogDecoder::format(format, arguments.data(), arguments.size()), format.level);
+    }
+}
+
+bool BinaryLog::append(const uint32_t id, const std::vector<uint8_t>& arguments) {
+    BinaryLogState& binaryState = state();
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(binaryState.bufferMutex);
+        binaryState.buffers.push_back(buffer);
+    }
+    const auto timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count());
+    const auto size = static_cast<uint32_t>(arguments.size());
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    // Checked again under the buffer lock, the log may have stopped since the first check and its
+    // final collection would miss the record
+    if (!binaryState.running.load(std::memory_order_acquire)) {
+        return false;
+    }
+    std::vector<uint8_t>& data = buffer->data;
+    const std::size_t offset = data.size();
+    if (offset + RECORD_HEADER_SIZE + size > binaryState.bufferLimit.load(std::memory_order_relaxed)) {
+        binaryState.dropped.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    data.resize(offset + RECORD_HEADER_SIZE + size);
+    uint8_t *position = data.data() + offset;
+    std::memcpy(position, &timestamp, sizeof(timestamp));
+    std::memcpy(position + sizeof(timestamp), &id, sizeof(id));
+    std::memcpy(position + sizeof(timestamp) + sizeof(id), &size, sizeof(size));
+    std::copy(arguments.begin(), arguments.end(), position + RECORD_HEADER_SIZE);
+    return true;
+}
+
+void BinaryLog::start(const BinaryLogConfig& config) {
+    this->interval = config.interval;
+    BinaryLogState& binaryState = state();
+    binaryState.bufferLimit.store(config.threadBufferSize);
+    this->droppedAtStart = binaryState.dropped.load();
+    if (binaryState.running.exchange(true)) {
+        throw std::logic_error("Another binary log is running");
+    }
+    this->worker = std::thread(&BinaryLog::run, this);
+}
+
+void BinaryLog::run() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    while (true) {
+        this->wake.wait_for(lock, this->interval, [this] {
+            return this->stopping || this->requested > this->finished;
+        });
+        const uint64_t target = this->requested;
+        const bool stop = this->stopping;
+        lock.unlock();
+        this->collect();
+        lock.lock();
+        this->finished = std::max(this->finished, target);
+        this->collected.notify_all();
+        if (stop) {
+            return;
+        }
+    }
+}
+
+void BinaryLog::collect() {
+    BinaryLogState& binaryState = state();
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(binaryState.bufferMutex);
+        buffers = binaryState.buffers;
+    }
+    std::vector<Record> pending;
+    std::vector<uint8_t> data;
+    for (const auto& buffer : buffers) {
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            data.swap(buffer->data);
+        }
+        const uint8_t *position = data.data();
+        const uint8_t *end = position + data.size();
+        while (position < end) {
+            Record record;
+            record.timestamp = readValue<uint64_t>(position, end);
+            record.id = readValue<uint32_t>(position, end);
+            const auto size = readValue<uint32_t>(position, end);
+            record.arguments.assign(position, position + size);
+            position += size;
+            pending.push_back(std::move(record));
+        }
+        data.clear();
+    }
+    buffers.clear();
+    {
+        // Buffers of the finished threads are owned only by the state
+        std::lock_guard<std::mutex> lock(binaryState.bufferMutex);
+        auto &all = binaryState.buffers;
+        all.erase(std::remove_if(all.begin(), all.end(), [](const std::shared_ptr<ThreadBuffer>& buffer) {
+            if (buffer.use_count() > 1) {
+                return false;
+            }
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            return buffer->data.empty();
+        }), all.end());
+    }
+    std::stable_sort(pending.begin(), pending.end(), [](const Record& first, const Record& second) {
+        return first.timestamp < second.timestamp;
+    });
+    for (const Record& record : pending) {
+        if (this->sink) {
+            const BinaryFormat format = BinaryLog::getFormat(record.id);
+            this->sink->append(
+                BinaryLogDecoder::format(format, record.arguments.data(), record.arguments.size()),
+                format.level
+            );
+        } else {
+            this->writeRecord(record);
+        }
+    }
+    if (this->output) {
+        this->output->flush();
+    }
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->records += pending.size();
+}
+
+void BinaryLog::writeRecord(const Record& record) {
+    std::ostream& stream = *this->output;
+    if (record.id >= this->writtenFormats.size()) {
+        this->writtenFormats.resize(record.id + 1, false);
+    }
+    if (!this->writtenFormats[record.id]) {
+        const BinaryFormat format = BinaryLog::getFormat(record.id);
+        stream.put(FORMAT_ENTRY);
+        writeValue(stream, record.id);
+        writeValue(stream, static_cast<uint8_t>(format.level));
+        writeValue(stream, static_cast<int32_t>(format.line));
+        writeString(stream, format.file);
+        writeString(stream, format.format);
+        this->writtenFormats[record.id] = true;
+    }
+    stream.put(RECORD_ENTRY);
+    writeValue(stream, record.id);
+    writeValue(stream, record.timestamp);
+    writeValue(stream, static_cast<uint32_t>(record.arguments.size()));
+    stream.write(reinterpret_cast<const char *>(record.arguments.data()),
+        static_cast<std::streamsize>(record.arguments.size()));
+}
+
+std::string BinaryLogDecoder::format(const BinaryFormat& format, const uint8_t *arguments, const std::size_t size) {
+    std::ostringstream message;
+    message << '[' << levelName(format.level) << "] ";
+    const uint8_t *position = arguments;
+    const uint8_t *end = arguments + size;
+    const std::string_view text(format.format);
+    std::size_t start = 0;
+    while (true) {
+        const std::size_t placeholder = text.find("{}", start);
+        if (placeholder == std::string_view::npos || position >= end) {
+            message << text.substr(start);
+            break;
+        }
+        message << text.substr(start, placeholder - start);
+        formatArgument(message, position, end);
+        start = placeholder + 2;
+    }
+    // Arguments without a placeholder
+    while (position < end) {
+        message << ' ';
+        formatArgument(message, position, end);
+    }
+    message << '\n';
+    return message.str();
+}
+
+std::size_t BinaryLogDecoder::decode(std::istream& input, std::ostream& output, const bool timestamps) {
+    char magic[sizeof(MAGIC)];
+    if (!input.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC)) {
+        throw std::runtime_error("Not a binary log");
+    }
+    if (readValue<uint32_t>(input) != VERSION) {
+        throw std::runtime_error("Unsupported binary log version");
+    }
+    if (readValue<uint32_t>(input) != BYTE_ORDER_MARK) {
+        throw std::runtime_error("Binary log has been written with another byte order");
+    }
+    /**
+     * Decoded call site, owns the strings of its description.
+     */
+    struct DecodedFormat {
+        std::string file;
+        std::string format;
+        BinaryFormat description;
+    };
+    std::map<uint32_t, DecodedFormat> formats;
+    std::vector<uint8_t> arguments;
+    std::size_t count = 0;
+    char entry;
+    while (input.get(entry)) {
+        const auto id = readValue<uint32_t>(input);
+        if (entry == FORMAT_ENTRY) {
+            const auto level = static_cast<Level>(readValue<uint8_t>(input));
+            const auto line = readValue<int32_t>(input);
+            DecodedFormat &decoded = formats[id];
+            decoded.file = readString(input);
+            decoded.format = readString(input);
+            decoded.description = BinaryFormat{level, decoded.format.c_str(), decoded.file.c_str(), line};
+            continue;
+        }
+        if (entry != RECORD_ENTRY) {
+            throw std::runtime_error("Malformed binary log entry");
+        }
+        const auto timestamp = readValue<uint64_t>(input);
+        arguments.resize(readValue<uint32_t>(input));
+        if (!input.read(reinterpret_cast<char *>(arguments.data()), static_cast<std::streamsize>(arguments.size()))) {
+            throw std::runtime_error("Truncated binary log");
+        }
+        const auto it = formats.find(id);
+        if (it == formats.end()) {
+            throw std::runtime_error("Binary log record of an unknown format");
+        }
+        if (timestamps) {
+            char prefix[32];
+            std::snprintf(prefix, sizeof(prefix), "%llu.%09llu ",
+                static_cast<unsigned long long>(timestamp / 1000000000),
+                static_cast<unsigned long long>(timestamp % 1000000000));
+            output << prefix;
+        }
+        output << BinaryLogDecoder::format(it->second.description, arguments.data(), arguments.size());
+        count++;
+    }
+    return count;
+}
+
+}  // namespace iqrf::log
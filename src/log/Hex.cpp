@@ -0,0 +1,261 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: Hex.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-29
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include "iqrf/log/Hex.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IQRF_HEX_SSSE3 1
+#include <immintrin.h>
+#endif
+
+namespace iqrf::log {
+
+/// Lowercase hex digits
+alignas(16) static constexpr char DIGITS[] = "0123456789abcdef";
+
+/**
+ * Builds the table of the two digit hex representations of all bytes.
+ *
+ * @return Digits of the byte `b` at the indices `2 * b` and `2 * b + 1`.
+ */
+static constexpr std::array<char, 512> hexPairs() {
+    std::array<char, 512> pairs{};
+    for (std::size_t byte = 0; byte < 256; ++byte) {
+        pairs[2 * byte] = DIGITS[byte >> 4];
+        pairs[2 * byte + 1] = DIGITS[byte & 0x0F];
+    }
+    return pairs;
+}
+
+/// Two digit hex representations of all bytes
+static constexpr std::array<char, 512> HEX_PAIRS = hexPairs();
+
+/**
+ * Builds the table of the hex digit values.
+ *
+ * @return Values of the hex digits by their characters, -1 for the other characters.
+ */
+static constexpr std::array<int8_t, 256> nibbleValues() {
+    std::array<int8_t, 256> values{};
+    for (std::size_t character = 0; character < 256; ++character) {
+        values[character] = -1;
+    }
+    for (int8_t value = 0; value < 10; ++value) {
+        values['0' + value] = value;
+    }
+    for (int8_t value = 0; value < 6; ++value) {
+        values['a' + value] = static_cast<int8_t>(10 + value);
+        values['A' + value] = static_cast<int8_t>(10 + value);
+    }
+    return values;
+}
+
+/// Values of the hex digits
+static constexpr std::array<int8_t, 256> NIBBLE_VALUES = nibbleValues();
+
+#ifdef IQRF_HEX_SSSE3
+
+/// Minimal number of bytes encoded by SIMD instructions, shorter dumps are faster with the lookup table
+static constexpr std::size_t SIMD_THRESHOLD = 32;
+
+/**
+ * Shuffle masks spreading the digit pairs of 16 bytes over 48 separated characters.
+ */
+struct SeparatedMasks {
+    /// Selects the digits of the bytes 0 to 7 for each 16 character chunk
+    uint8_t low[3][16];
+    /// Selects the digits of the bytes 8 to 15 for each 16 character chunk
+    uint8_t high[3][16];
+    /// Marks the separator positions of each 16 character chunk
+    uint8_t separators[3][16];
+};
+
+/**
+ * Builds the shuffle masks of the separated hex dump.
+ *
+ * @return Shuffle masks, 0x80 zeroes the character.
+ */
+static constexpr SeparatedMasks separatedMasks() {
+    SeparatedMasks masks{};
+    for (std::size_t position = 0; position < 48; ++position) {
+        const std::size_t chunk = position / 16;
+        const std::size_t index = position % 16;
+        const std::size_t byte = position / 3;
+        const std::size_t digit = position % 3;
+        const bool isSeparator = digit == 2;
+        masks.low[chunk][index] = !isSeparator && byte < 8 ? static_cast<uint8_t>(2 * byte + digit) : 0x80;
+        masks.high[chunk][index] = !isSeparator && byte >= 8 ? static_cast<uint8_t>(2 * (byte - 8) + digit) : 0x80;
+        masks.separators[chunk][index] = isSeparator ? 0xFF : 0x00;
+    }
+    return masks;
+}
+
+/// Shuffle masks of the separated hex dump
+alignas(16) static constexpr SeparatedMasks SEPARATED_MASKS = separatedMasks();
+
+/**
+ * Writes the hex dump using SSSE3 byte shuffles.
+ *
+ * Each block of 16 bytes is split into nibbles, which are translated to digits by a shuffle of the
+ * digit table, and the interleaved digits are spread over the separators by further shuffles.
+ *
+ * @param data is the first byte.
+ * @param size is the number of bytes.
+ * @param output is the output buffer.
+ * @param separator is the separator of the bytes, NoHexSeparator for none.
+ *
+ * @return Pointer past the last written character.
+ */
+__attribute__((target("ssse3")))
+static char *toHexSsse3(const uint8_t *data, std::size_t size, char *output, const char separator) {
+    const __m128i digits = _mm_load_si128(reinterpret_cast<const __m128i *>(DIGITS));
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i separators = _mm_set1_epi8(separator);
+    // Separated blocks end with a separator, so the last block is left to the lookup table
+    const std::size_t minimum = separator == NoHexSeparator ? 16 : 17;
+    while (size >= minimum) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+        const __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+        const __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, nibble));
+        const __m128i first = _mm_unpacklo_epi8(high, low);
+        const __m128i second = _mm_unpackhi_epi8(high, low);
+        if (separator == NoHexSeparator) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output), first);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 16), second);
+            output += 32;
+        } else {
+            for (std::size_t chunk = 0; chunk < 3; ++chunk) {
+                const __m128i characters = _mm_or_si128(
+                    _mm_or_si128(
+                        _mm_shuffle_epi8(first, _mm_load_si128(
+                            reinterpret_cast<const __m128i *>(SEPARATED_MASKS.low[chunk]))),
+                        _mm_shuffle_epi8(second, _mm_load_si128(
+                            reinterpret_cast<const __m128i *>(SEPARATED_MASKS.high[chunk])))
+                    ),
+                    _mm_and_si128(separators, _mm_load_si128(
+                        reinterpret_cast<const __m128i *>(SEPARATED_MASKS.separators[chunk])))
+                );
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 16 * chunk), characters);
+            }
+            output += 48;
+        }
+        data += 16;
+        size -= 16;
+    }
+    return toHexScalar(data, size, output, separator);
+}
+
+/**
+ * Checks whether the CPU supports SSSE3.
+ *
+ * @return true if SSSE3 is supported, false otherwise
+ */
+static bool hasSsse3() {
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+}
+
+#endif
+
+char *toHex(const uint8_t *data, const std::size_t size, char *output, const char separator) {
+#ifdef IQRF_HEX_SSSE3
+    if (size >= SIMD_THRESHOLD && hasSsse3()) {
+        return toHexSsse3(data, size, output, separator);
+    }
+#endif
+    return toHexScalar(data, size, output, separator);
+}
+
+char *toHexScalar(const uint8_t *data, const std::size_t size, char *output, const char separator) {
+    if (size == 0) {
+        return output;
+    }
+    std::memcpy(output, &HEX_PAIRS[2 * data[0]], 2);
+    output += 2;
+    if (separator == NoHexSeparator) {
+        for (std::size_t i = 1; i < size; ++i) {
+            std::memcpy(output, &HEX_PAIRS[2 * data[i]], 2);
+            output += 2;
+        }
+        return output;
+    }
+    for (std::size_t i = 1; i < size; ++i) {
+        output[0] = separator;
+        std::memcpy(output + 1, &HEX_PAIRS[2 * data[i]], 2);
+        output += 3;
+    }
+    return output;
+}
+
+void appendHex(std::string& output, const uint8_t *data, const std::size_t size, const char separator) {
+    const std::size_t offset = output.size();
+    output.resize(offset + hexLength(size, separator));
+    toHex(data, size, output.data() + offset, separator);
+}
+
+std::string toHex(const std::vector<uint8_t>& data, const char separator) {
+    std::string output;
+    appendHex(output, data.data(), data.size(), separator);
+    return output;
+}
+
+std::vector<uint8_t> hexToBytes(std::string_view text) {
+    static constexpr std::string_view WHITESPACE = " \t\r\n";
+    const std::size_t first = text.find_first_not_of(WHITESPACE);
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    text = text.substr(first, text.find_last_not_of(WHITESPACE) - first + 1);
+    std::vector<uint8_t> bytes;
+    bytes.reserve(text.size() / 2 + 1);
+    std::size_t position = 0;
+    while (position < text.size()) {
+        const char character = text[position];
+        if (!bytes.empty() && (character == '.' || character == ':' || character == '-' || character == ' ')) {
+            ++position;
+        }
+        if (text.size() - position < 2) {
+            throw std::invalid_argument("Incomplete hex byte at position " + std::to_string(first + position));
+        }
+        const int8_t high = NIBBLE_VALUES[static_cast<uint8_t>(text[position])];
+        const int8_t low = NIBBLE_VALUES[static_cast<uint8_t>(text[position + 1])];
+        if (high < 0 || low < 0) {
+            throw std::invalid_argument(
+                "Invalid hex digit at position " + std::to_string(first + position + (high < 0 ? 0 : 1))
+            );
+        }
+        bytes.push_back(static_cast<uint8_t>(high << 4 | low));
+        position += 2;
+    }
+    return bytes;
+}
+
+std::ostream& operator<<(std::ostream& stream, const HexView& view) {
+    // Encoded in chunks, so the characters stay on the stack
+    constexpr std::size_t CHUNK = 128;
+    char buffer[hexLength(CHUNK) + 1];
+    for (std::size_t offset = 0; offset < view.size; offset += CHUNK) {
+        char *end = buffer;
+        if (offset > 0 && view.separator != NoHexSeparator) {
+            *end++ = view.separator;
+        }
+        end = toHex(view.data + offset, std::min(CHUNK, view.size - offset), end, view.separator);
+        stream.write(buffer, end - buffer);
+    }
+    return stream;
+}
+
+}  // namespace iqrf::log
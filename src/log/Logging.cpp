@@ -11,10 +11,12 @@
 
 #include "iqrf/log/Logging.h"
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace iqrf::log {
 
@@ -23,8 +25,38 @@ std::unique_ptr<ILog> Logger::log = std::make_unique<StderrLog>();
 // Default Log Level is Error
 Level Logger::logLevel = Level::Error;
 
+/**
+ * Streams of the thread, one per nesting level of the loggers.
+ */
+thread_local std::vector<std::unique_ptr<std::ostringstream>> threadBuffers;
+
+/**
+ * Number of the loggers of the thread alive at once.
+ */
+thread_local std::size_t threadDepth = 0;
+
+/**
+ * Takes the reusable stream of the thread and resets it.
+ *
+ * @return String stream for the log message.
+ */
+static std::ostringstream& acquireBuffer() {
+    if (threadDepth == threadBuffers.size()) {
+        threadBuffers.push_back(std::make_unique<std::ostringstream>());
+    }
+    std::ostringstream& stream = *threadBuffers[threadDepth++];
+    // Keep the allocated storage, reset the formatting left by the previous message
+    stream.str(std::string());
+    stream.clear();
+    stream.flags(std::ios_base::dec | std::ios_base::skipws);
+    stream.width(0);
+    stream.precision(6);
+    stream.fill(' ');
+    return stream;
+}
+
 // Default Message Level is Info
-Logger::Logger(): messageLevel(Level::Info) {}
+Logger::Logger(): buffer(acquireBuffer()), messageLevel(Level::Info) {}
 
 std::ostringstream& Logger::stream(const Level level) {
     messageLevel = level;
@@ -32,8 +64,11 @@ std::ostringstream& Logger::stream(const Level level) {
 }
 
 Logger::~Logger() {
-    buffer << std::endl;
-    log->append(buffer.str(), messageLevel);
+    buffer << '\n';
+    const std::string message = buffer.str();
+    // The stream is free for the next logger even if the log fails
+    threadDepth--;
+    log->append(message, messageLevel);
 }
 
 void ILog::append(const std::string& msg, const Level& severity) {
@@ -41,8 +76,22 @@ void ILog::append(const std::string& msg, const Level& severity) {
     this->append(msg);
 }
 
+void ILog::appendBatch(const std::vector<std::string_view>& msgs, const Level& severity) {
+    for (const auto &msg : msgs) {
+        this->append(std::string(msg), severity);
+    }
+}
+
 void StderrLog::append(const std::string& msg) {
     std::cerr << msg << std::flush;
 }
 
+void StderrLog::appendBatch(const std::vector<std::string_view>& msgs, const Level& severity) {
+    (void)severity;
+    for (const auto &msg : msgs) {
+        std::cerr << msg;
+    }
+    std::cerr << std::flush;
+}
+
 }  // namespace iqrf::log
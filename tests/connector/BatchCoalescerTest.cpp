@@ -0,0 +1,322 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: BatchCoalescerTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-11
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "iqrf/connector/BatchCoalescer.h"
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/IConnector.h"
+
+namespace iqrf::connector {
+
+typedef std::vector<std::vector<uint8_t>> Frames;
+
+/**
+ * Connector recording the sent messages and exposing the receive path.
+ */
+class CoalescingConnector : public IConnector {
+ public:
+    State getState() const override { return State::Ready; }
+    std::vector<uint8_t> receive() override { return {}; }
+    TrInfo readTrInfo() override { return {}; }
+    void resetTr() override {}
+    void enterProgrammingMode() override {}
+    void awaitProgrammingMode() override {}
+    void exitProgrammingMode() override {}
+    void upload(const ProgrammingTarget, const std::vector<uint8_t> &) override {}
+    std::vector<uint8_t> download(const ProgrammingTarget) override { return {}; }
+    std::vector<uint8_t> download(const ProgrammingTarget, const uint16_t) override { return {}; }
+
+    using IConnector::notifyReceived;
+    using IConnector::send;
+
+    /**
+     * Returns the sent messages.
+     * @return Sent messages
+     */
+    Frames getSent() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->sent;
+    }
+
+    /**
+     * Makes the link reject the message.
+     * @param message Rejected message
+     */
+    void rejectMessage(const std::vector<uint8_t> &message) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->rejected = message;
+    }
+
+    /**
+     * Waits until the requests wait in the open batches.
+     * @param count Number of requests
+     */
+    void waitForPending(const std::size_t count) {
+        while (this->getCoalescingStats()->pendingRequests < count) {
+            std::this_thread::yield();
+        }
+    }
+
+ protected:
+    void send(const std::vector<uint8_t> &data) override {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (data == this->rejected) {
+            throw std::runtime_error("Link rejected the message");
+        }
+        this->sent.push_back(data);
+    }
+
+ private:
+    /// Messages written to the link
+    Frames sent;
+    /// Message rejected by the link
+    std::vector<uint8_t> rejected;
+    /// Guards the sent messages
+    std::mutex mutex;
+};
+
+class BatchCoalescerTest : public ::testing::Test {
+ protected:
+    /// Pulse red LED on node 1
+    const std::vector<uint8_t> ledr = {0x01, 0x00, 0x06, 0x03, 0xff, 0xff};
+    /// Set IO on node 1
+    const std::vector<uint8_t> io = {0x01, 0x00, 0x09, 0x01, 0xff, 0xff, 0x00, 0x01, 0x01};
+    /// Read IO on node 1, has response data
+    const std::vector<uint8_t> ioRead = {0x01, 0x00, 0x09, 0x02, 0xff, 0xff};
+    /// Read temperature on node 1, has response data
+    const std::vector<uint8_t> temperature = {0x01, 0x00, 0x0a, 0x00, 0xff, 0xff};
+    /// Pulse red LED on node 2
+    const std::vector<uint8_t> ledr2 = {0x02, 0x00, 0x06, 0x03, 0xff, 0xff};
+    /// Batch of the red LED pulse and IO set on node 1
+    const std::vector<uint8_t> batch = {
+        0x01, 0x00, 0x02, 0x05, 0xff, 0xff,
+        0x05, 0x06, 0x03, 0xff, 0xff,
+        0x08, 0x09, 0x01, 0xff, 0xff, 0x00, 0x01, 0x01,
+        0x00
+    };
+};
+
+TEST_F(BatchCoalescerTest, packsRequestsToSameNode) {
+    BatchCoalescer coalescer;
+    EXPECT_EQ(coalescer.add(ledr, OutboundQueue::Normal, 1), BatchCoalescer::Admission::Leader);
+    EXPECT_EQ(coalescer.add(io, OutboundQueue::Normal, 2), BatchCoalescer::Admission::Joined);
+    EXPECT_EQ(coalescer.add(ledr2, OutboundQueue::Normal, 1), BatchCoalescer::Admission::Leader);
+    EXPECT_EQ(coalescer.add(ledr, OutboundQueue::High, 1), BatchCoalescer::Admission::Leader);
+    EXPECT_EQ(coalescer.add(temperature, OutboundQueue::Normal, 1), BatchCoalescer::Admission::Bypass);
+    EXPECT_EQ(coalescer.getStats().pendingRequests, 4);
+
+    EXPECT_EQ(coalescer.flush(ledr, OutboundQueue::Normal), batch);
+    EXPECT_EQ(coalescer.flush(ledr, OutboundQueue::Normal), std::nullopt);
+    EXPECT_EQ(coalescer.flush(ledr2, OutboundQueue::Normal), ledr2);
+    EXPECT_EQ(coalescer.flush(ledr, OutboundQueue::High), ledr);
+
+    const auto &stats = coalescer.getStats();
+    EXPECT_EQ(stats.batches, 1);
+    EXPECT_EQ(stats.coalescedRequests, 2);
+    EXPECT_EQ(stats.singleRequests, 2);
+    EXPECT_EQ(stats.bypassedRequests, 1);
+    EXPECT_EQ(stats.maxBatchRequests, 2);
+    EXPECT_EQ(stats.pendingRequests, 0);
+}
+
+TEST_F(BatchCoalescerTest, flushesBatchBeforeBypassingRequest) {
+    BatchCoalescer coalescer;
+    const auto result = std::make_shared<SendResult>();
+    EXPECT_EQ(coalescer.add(ledr, OutboundQueue::Normal, 1, result), BatchCoalescer::Admission::Leader);
+    EXPECT_EQ(coalescer.add(io, OutboundQueue::Normal, 2), BatchCoalescer::Admission::Joined);
+    EXPECT_EQ(coalescer.getResult(io, OutboundQueue::Normal), result);
+    EXPECT_EQ(coalescer.add(ioRead, OutboundQueue::Normal, 2), BatchCoalescer::Admission::Bypass);
+
+    // Batches to other nodes and queues are kept open
+    EXPECT_EQ(coalescer.flushBefore(ledr2, OutboundQueue::Normal), std::nullopt);
+    EXPECT_EQ(coalescer.flushBefore(ioRead, OutboundQueue::High), std::nullopt);
+
+    const auto frame = coalescer.flushBefore(ioRead, OutboundQueue::Normal);
+    ASSERT_TRUE(frame.has_value());
+    EXPECT_EQ(frame->data, batch);
+    EXPECT_EQ(frame->sender, 1);
+    EXPECT_EQ(frame->result, result);
+    EXPECT_EQ(coalescer.flushBefore(ioRead, OutboundQueue::Normal), std::nullopt);
+
+    // The leader does not close a newer batch opened by another sender
+    EXPECT_EQ(coalescer.add(ledr, OutboundQueue::Normal, 2, std::make_shared<SendResult>()),
+        BatchCoalescer::Admission::Leader);
+    EXPECT_EQ(coalescer.flush(ledr, OutboundQueue::Normal, result), std::nullopt);
+    EXPECT_EQ(coalescer.getStats().pendingRequests, 1);
+}
+
+TEST_F(BatchCoalescerTest, bypassesUnsuitableRequests) {
+    CoalescingConfig config;
+    config.maxBatchData = 12;
+    BatchCoalescer coalescer(config);
+    // Coordinator, broadcast, OS peripheral and responses are never packed
+    EXPECT_EQ(coalescer.add({0x00, 0x00, 0x06, 0x03, 0xff, 0xff}, OutboundQueue::Normal, 1),
+        BatchCoalescer::Admission::Bypass);
+    EXPECT_EQ(coalescer.add({0xff, 0x00, 0x06, 0x03, 0xff, 0xff}, OutboundQueue::Normal, 1),
+        BatchCoalescer::Admission::Bypass);
+    EXPECT_EQ(coalescer.add({0x01, 0x00, 0x02, 0x05, 0xff, 0xff}, OutboundQueue::Normal, 1),
+        BatchCoalescer::Admission::Bypass);
+    EXPECT_EQ(coalescer.add({0x01, 0x00, 0x06, 0x83, 0xff, 0xff, 0x00, 0x00}, OutboundQueue::Normal, 1),
+        BatchCoalescer::Admission::Bypass);
+
+    // Second request does not fit into the batch data
+    EXPECT_EQ(coalescer.add(ledr, OutboundQueue::Normal, 1), BatchCoalescer::Admission::Leader);
+    EXPECT_EQ(coalescer.add(io, OutboundQueue::Normal, 1), BatchCoalescer::Admission::Bypass);
+    EXPECT_EQ(coalescer.add(ledr, OutboundQueue::Normal, 1), BatchCoalescer::Admission::Joined);
+
+    config.maxBatchData = 6;
+    EXPECT_THROW(BatchCoalescer invalid(config), std::invalid_argument);
+}
+
+TEST_F(BatchCoalescerTest, customFilter) {
+    CoalescingConfig config;
+    config.filter = [](const std::vector<uint8_t> &frame) { return frame[2] == 0x0a; };
+    BatchCoalescer coalescer(config);
+    EXPECT_EQ(coalescer.add(ledr, OutboundQueue::Normal, 1), BatchCoalescer::Admission::Bypass);
+    EXPECT_EQ(coalescer.add(temperature, OutboundQueue::Normal, 1), BatchCoalescer::Admission::Leader);
+}
+
+TEST_F(BatchCoalescerTest, splitsResponses) {
+    BatchCoalescer coalescer;
+    coalescer.add(ledr, OutboundQueue::Normal, 1);
+    coalescer.add(io, OutboundQueue::Normal, 1);
+    coalescer.flush(ledr, OutboundQueue::Normal);
+
+    const std::vector<uint8_t> confirmation = {0x01, 0x00, 0x02, 0x05, 0xff, 0xff, 0xff, 0x40, 0x01, 0x06, 0x01};
+    EXPECT_EQ(coalescer.split(confirmation), Frames({
+        {0x01, 0x00, 0x06, 0x03, 0xff, 0xff, 0xff, 0x40, 0x01, 0x06, 0x01},
+        {0x01, 0x00, 0x09, 0x01, 0xff, 0xff, 0xff, 0x40, 0x01, 0x06, 0x01},
+    }));
+
+    const std::vector<uint8_t> response = {0x01, 0x00, 0x02, 0x85, 0x02, 0x01, 0x00, 0x40};
+    EXPECT_EQ(coalescer.split(response), Frames({
+        {0x01, 0x00, 0x06, 0x83, 0x02, 0x01, 0x00, 0x40},
+        {0x01, 0x00, 0x09, 0x81, 0x02, 0x01, 0x00, 0x40},
+    }));
+    EXPECT_EQ(coalescer.getStats().splitResponses, 4);
+
+    // Batch responses not created by the coalescer are passed through
+    EXPECT_EQ(coalescer.split(response), Frames({response}));
+    EXPECT_EQ(coalescer.split(temperature), Frames({temperature}));
+}
+
+TEST_F(BatchCoalescerTest, connectorCoalescesConcurrentRequests) {
+    CoalescingConnector connector;
+    const auto clock = std::make_shared<VirtualClock>();
+    connector.setClock(clock);
+    CoalescingConfig config;
+    config.window = std::chrono::milliseconds(200);
+    connector.enableCoalescing(config);
+    const auto handler = [](const std::vector<uint8_t> &) { return 0; };
+    const AccessToken token = connector.registerResponseHandler(handler, AccessType::Normal);
+
+    std::thread leader([&] { connector.send(ledr, token); });
+    // The leader waits for the coalescing window, the joined sender for the batch
+    ASSERT_TRUE(clock->waitForSleepers(1));
+    std::thread joined([&] { connector.send(io, token); });
+    connector.waitForPending(2);
+    EXPECT_TRUE(connector.getSent().empty());
+    clock->advance(config.window);
+    leader.join();
+    joined.join();
+    EXPECT_EQ(connector.getSent(), Frames({batch}));
+
+    const std::vector<uint8_t> response = {0x01, 0x00, 0x02, 0x85, 0x02, 0x01, 0x00, 0x40};
+    EXPECT_EQ(connector.notifyReceived(response).size(), 2);
+
+    // Open batches are sent when the coalescing is disabled
+    std::thread disabled([&] { connector.send(ledr2, token); });
+    ASSERT_TRUE(clock->waitForSleepers(1));
+    connector.disableCoalescing();
+    EXPECT_EQ(connector.getSent(), Frames({batch, ledr2}));
+    clock->advance(config.window);
+    disabled.join();
+    EXPECT_EQ(connector.getCoalescingStats(), std::nullopt);
+    EXPECT_EQ(connector.notifyReceived(response), Frames({response}));
+}
+
+TEST_F(BatchCoalescerTest, connectorKeepsOrderOfBypassingRequest) {
+    CoalescingConnector connector;
+    const auto clock = std::make_shared<VirtualClock>();
+    connector.setClock(clock);
+    CoalescingConfig config;
+    config.window = std::chrono::milliseconds(200);
+    connector.enableCoalescing(config);
+    const auto handler = [](const std::vector<uint8_t> &) { return 0; };
+    const AccessToken writer = connector.registerResponseHandler(handler, AccessType::Normal);
+    const AccessToken reader = connector.registerResponseHandler(handler, AccessType::Normal);
+
+    std::thread leader([&] { connector.send(io, writer); });
+    ASSERT_TRUE(clock->waitForSleepers(1));
+    // The IO read must see the IO write still waiting for the coalescing window
+    connector.send(ioRead, reader);
+    EXPECT_EQ(connector.getSent(), Frames({io, ioRead}));
+    clock->advance(config.window);
+    leader.join();
+    EXPECT_EQ(connector.getSent(), Frames({io, ioRead}));
+    EXPECT_EQ(connector.getCoalescingStats()->singleRequests, 1);
+    EXPECT_EQ(connector.getCoalescingStats()->bypassedRequests, 1);
+}
+
+TEST_F(BatchCoalescerTest, stopListenKeepsCoalescingWindow) {
+    CoalescingConnector connector;
+    const auto clock = std::make_shared<VirtualClock>();
+    connector.setClock(clock);
+    CoalescingConfig config;
+    config.window = std::chrono::milliseconds(200);
+    connector.enableCoalescing(config);
+    const auto handler = [](const std::vector<uint8_t> &) { return 0; };
+    const AccessToken token = connector.registerResponseHandler(handler, AccessType::Normal);
+
+    std::thread leader([&] { connector.send(ledr, token); });
+    connector.listen();
+    // The leader waits for the window and the listening loop for the next poll
+    ASSERT_TRUE(clock->waitForSleepers(2));
+    connector.stopListen();
+    EXPECT_TRUE(clock->waitForSleepers(1));
+    EXPECT_TRUE(connector.getSent().empty());
+    clock->advance(config.window);
+    leader.join();
+    EXPECT_EQ(connector.getSent(), Frames({ledr}));
+}
+
+TEST_F(BatchCoalescerTest, connectorReportsBatchFailureToAllSenders) {
+    CoalescingConnector connector;
+    const auto clock = std::make_shared<VirtualClock>();
+    connector.setClock(clock);
+    CoalescingConfig config;
+    config.window = std::chrono::milliseconds(200);
+    connector.enableCoalescing(config);
+    connector.rejectMessage(batch);
+    const auto handler = [](const std::vector<uint8_t> &) { return 0; };
+    const AccessToken token = connector.registerResponseHandler(handler, AccessType::Normal);
+
+    std::thread leader([&] { EXPECT_THROW(connector.send(ledr, token), std::runtime_error); });
+    ASSERT_TRUE(clock->waitForSleepers(1));
+    std::thread joined([&] { EXPECT_THROW(connector.send(io, token), std::runtime_error); });
+    connector.waitForPending(2);
+    clock->advance(config.window);
+    leader.join();
+    joined.join();
+    EXPECT_TRUE(connector.getSent().empty());
+}
+
+}  // namespace iqrf::connector
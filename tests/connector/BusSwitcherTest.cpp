@@ -11,10 +11,11 @@
 
 #include <gtest/gtest.h>
 
-#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
-#include <thread>
 #include <tuple>
 
 #include "iqrf/connector/BusSwitcher.h"
@@ -22,9 +23,9 @@
 namespace iqrf::connector {
 
 /**
- * GPIO value change event type.
+ * GPIO value change event type, the number of the group values setting and the GPIO change.
  */
-typedef std::tuple<std::chrono::milliseconds, std::string, bool, bool> GpioValueChangeEvent;
+typedef std::tuple<std::size_t, std::string, bool, bool> GpioValueChangeEvent;
 
 class BusSwitcherTest : public ::testing::Test {
  protected:
@@ -33,6 +34,7 @@ class BusSwitcherTest : public ::testing::Test {
      */
     void SetUp() override {
         this->history.clear();
+        this->groupSets.clear();
     }
 
     /**
@@ -44,43 +46,39 @@ class BusSwitcherTest : public ::testing::Test {
         config.use_mock = true;
         iqrf::gpio::Gpio gpio(config);
         gpio.registerValueCallback([this, config](bool oldValue, bool newValue) {
-            this->history.emplace_back(BusSwitcherTest::epochTime(), config.consumer_name, oldValue, newValue);
+            this->history.emplace_back(this->groupSets.size(), config.consumer_name, oldValue, newValue);
         });
         return gpio;
     }
 
     /**
-     * Returns epoch time in milliseconds.
-     * @return Current time in milliseconds since epoch.
+     * Records each setting of the bus enable GPIO group values.
+     * @param busSwitcher Bus switcher
      */
-    [[nodiscard]] static std::chrono::milliseconds epochTime() {
-        return std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch());
+    void watchGroup(const BusSwitcher &busSwitcher) {
+        ASSERT_TRUE(busSwitcher.getGroup().has_value());
+        busSwitcher.getGroup()->setValuesCallback([this](uint64_t oldValues, uint64_t newValues) {
+            this->groupSets.emplace_back(oldValues, newValues);
+        });
     }
 
     static void expectGpioChange(
         const GpioValueChangeEvent &currentEvent,
+        const std::size_t groupSet,
         const std::string& gpioName,
         const bool oldValue,
-        const bool newValue,
-        const std::optional<GpioValueChangeEvent> &previousEvent = std::nullopt,
-        const std::optional<std::chrono::milliseconds> timeDifference = std::nullopt,
-        const int timeTolerance = 5
+        const bool newValue
     ) {
+        EXPECT_EQ(std::get<0>(currentEvent), groupSet);
         EXPECT_EQ(std::get<1>(currentEvent), gpioName);
         EXPECT_EQ(std::get<2>(currentEvent), oldValue);
         EXPECT_EQ(std::get<3>(currentEvent), newValue);
-        if (previousEvent.has_value() && timeDifference.has_value()) {
-            EXPECT_NEAR(
-                std::get<0>(currentEvent).count() - std::get<0>(previousEvent.value()).count(),
-                timeDifference.value().count(),
-                timeTolerance
-            );
-        }
     }
 
     /// History of GPIO value changes
     std::vector<GpioValueChangeEvent> history;
+    /// Old and new values of each bus enable GPIO group setting
+    std::vector<std::pair<uint64_t, uint64_t>> groupSets;
 };
 
 TEST_F(BusSwitcherTest, busEnableGpioOnly) {
@@ -90,18 +88,19 @@ TEST_F(BusSwitcherTest, busEnableGpioOnly) {
     BusSwitcher busSwitcher(config);
 
     busSwitcher.init();
+    this->watchGroup(busSwitcher);
     EXPECT_EQ(busEnableGpio.getDirection(), iqrf::gpio::GpioDirection::Output);
     EXPECT_FALSE(busEnableGpio.getValue());
 
     busSwitcher.toggleUart(true);
     EXPECT_TRUE(busEnableGpio.getValue());
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
     busSwitcher.toggleSpi(false);
     EXPECT_FALSE(busEnableGpio.getValue());
 
+    EXPECT_EQ(groupSets.size(), 2);
     EXPECT_EQ(history.size(), 2);
-    BusSwitcherTest::expectGpioChange(history[0], "busEnable", false, true);
-    BusSwitcherTest::expectGpioChange(history[1], "busEnable", true, false, history[0], std::chrono::milliseconds(50));
+    BusSwitcherTest::expectGpioChange(history[0], 0, "busEnable", false, true);
+    BusSwitcherTest::expectGpioChange(history[1], 1, "busEnable", true, false);
 }
 
 TEST_F(BusSwitcherTest, enableGpios) {
@@ -117,6 +116,7 @@ TEST_F(BusSwitcherTest, enableGpios) {
     BusSwitcherConfig config(std::nullopt, i2cEnableGpio, spiEnableGpio, uartEnableGpio);
     BusSwitcher busSwitcher(config);
     busSwitcher.init();
+    this->watchGroup(busSwitcher);
 
     EXPECT_EQ(i2cEnableGpio.getDirection(), iqrf::gpio::GpioDirection::Output);
     EXPECT_EQ(spiEnableGpio.getDirection(), iqrf::gpio::GpioDirection::Output);
@@ -130,33 +130,38 @@ TEST_F(BusSwitcherTest, enableGpios) {
     EXPECT_TRUE(i2cEnableGpio.getValue());
     EXPECT_FALSE(spiEnableGpio.getValue());
     EXPECT_FALSE(uartEnableGpio.getValue());
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
 
     busSwitcher.toggleSpi(true);
     EXPECT_FALSE(i2cEnableGpio.getValue());
     EXPECT_TRUE(spiEnableGpio.getValue());
     EXPECT_FALSE(uartEnableGpio.getValue());
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
 
     busSwitcher.toggleUart(true);
     EXPECT_FALSE(i2cEnableGpio.getValue());
     EXPECT_FALSE(spiEnableGpio.getValue());
     EXPECT_TRUE(uartEnableGpio.getValue());
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
 
     busSwitcher.toggleUart(false);
     EXPECT_FALSE(i2cEnableGpio.getValue());
     EXPECT_FALSE(spiEnableGpio.getValue());
     EXPECT_FALSE(uartEnableGpio.getValue());
 
-    EXPECT_EQ(history.size(), 6);
+    // Each switch sets all enable lines at once, the lines are in the order of I2C, SPI and UART
+    const std::vector<std::pair<uint64_t, uint64_t>> expectedSets = {
+        {0b000, 0b001},
+        {0b001, 0b010},
+        {0b010, 0b100},
+        {0b100, 0b000},
+    };
+    EXPECT_EQ(groupSets, expectedSets);
 
-    BusSwitcherTest::expectGpioChange(history[0], "i2cEnable", false, true, std::nullopt, std::nullopt);
-    BusSwitcherTest::expectGpioChange(history[1], "i2cEnable", true, false, history[0], std::chrono::milliseconds(50));
-    BusSwitcherTest::expectGpioChange(history[2], "spiEnable", false, true, history[0], std::chrono::milliseconds(50));
-    BusSwitcherTest::expectGpioChange(history[3], "spiEnable", true, false, history[2], std::chrono::milliseconds(50));
-    BusSwitcherTest::expectGpioChange(history[4], "uartEnable", false, true, history[2], std::chrono::milliseconds(50));
-    BusSwitcherTest::expectGpioChange(history[5], "uartEnable", true, false, history[4], std::chrono::milliseconds(50));
+    EXPECT_EQ(history.size(), 6);
+    BusSwitcherTest::expectGpioChange(history[0], 0, "i2cEnable", false, true);
+    BusSwitcherTest::expectGpioChange(history[1], 1, "i2cEnable", true, false);
+    BusSwitcherTest::expectGpioChange(history[2], 1, "spiEnable", false, true);
+    BusSwitcherTest::expectGpioChange(history[3], 2, "spiEnable", true, false);
+    BusSwitcherTest::expectGpioChange(history[4], 2, "uartEnable", false, true);
+    BusSwitcherTest::expectGpioChange(history[5], 3, "uartEnable", true, false);
 }
 
 }  // namespace iqrf::connector
@@ -0,0 +1,129 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: ClockTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-17
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "iqrf/connector/Clock.h"
+
+namespace iqrf::connector {
+
+using std::chrono::milliseconds;
+
+class ClockTest : public ::testing::Test {
+ protected:
+    /// Virtual clock advanced by the test
+    VirtualClock clock;
+};
+
+TEST_F(ClockTest, autoAdvance) {
+    VirtualClock autoClock(true);
+    const auto start = autoClock.now();
+    autoClock.sleepFor(milliseconds(500));
+    autoClock.sleepUntil(start + milliseconds(800));
+    // Deadlines in the past do not sleep
+    autoClock.sleepUntil(start);
+    EXPECT_EQ(autoClock.now() - start, milliseconds(800));
+    EXPECT_EQ(autoClock.getSleeps(), 2);
+    EXPECT_EQ(autoClock.getSlept(), milliseconds(800));
+}
+
+TEST_F(ClockTest, sleeperWakesUpAtDeadline) {
+    std::atomic<bool> woken = false;
+    std::thread sleeper([this, &woken] {
+        this->clock.sleepFor(milliseconds(100));
+        woken = true;
+    });
+    ASSERT_TRUE(clock.waitForSleepers(1));
+    EXPECT_EQ(clock.nextDeadline(), clock.now() + milliseconds(100));
+
+    clock.advance(milliseconds(99));
+    EXPECT_TRUE(clock.waitForSleepers(1));
+    EXPECT_FALSE(woken);
+    clock.advance(milliseconds(1));
+    sleeper.join();
+    EXPECT_TRUE(woken);
+    EXPECT_EQ(clock.nextDeadline(), std::nullopt);
+}
+
+TEST_F(ClockTest, interruptWakesUpSleepersWithCondition) {
+    std::atomic_bool stopped = false;
+    std::thread stoppable([this, &stopped] {
+        this->clock.sleepForUnless(std::chrono::hours(1), [&stopped] { return stopped.load(); });
+    });
+    std::thread sleeper([this] { this->clock.sleepFor(milliseconds(100)); });
+    ASSERT_TRUE(clock.waitForSleepers(2));
+    const auto before = clock.now();
+    // Interrupt without the condition does not wake anybody up
+    clock.interrupt();
+    EXPECT_TRUE(clock.waitForSleepers(2));
+    stopped = true;
+    clock.interrupt();
+    stoppable.join();
+    EXPECT_EQ(clock.now(), before);
+    EXPECT_TRUE(clock.waitForSleepers(1));
+    clock.advance(milliseconds(100));
+    sleeper.join();
+
+    // The condition holding at the start does not sleep at all
+    clock.sleepForUnless(std::chrono::hours(1), [] { return true; });
+    EXPECT_EQ(clock.now(), before + milliseconds(100));
+}
+
+TEST_F(ClockTest, waitForSleepersTimesOut) {
+    EXPECT_FALSE(clock.waitForSleepers(1, milliseconds(10)));
+    EXPECT_EQ(clock.getSleeps(), 0);
+    // The time never goes back
+    const auto before = clock.now();
+    clock.advanceTo(before - milliseconds(10));
+    EXPECT_EQ(clock.now(), before);
+}
+
+TEST_F(ClockTest, steadyClockIsShared) {
+    EXPECT_EQ(SteadyClock::instance(), SteadyClock::instance());
+    const auto start = SteadyClock::instance()->now();
+    SteadyClock::instance()->sleepFor(milliseconds(1));
+    EXPECT_GE(SteadyClock::instance()->now() - start, milliseconds(1));
+
+    std::atomic_bool stopped = false;
+    std::thread stoppable([&stopped] {
+        SteadyClock::instance()->sleepForUnless(std::chrono::hours(1), [&stopped] { return stopped.load(); });
+    });
+    stopped = true;
+    SteadyClock::instance()->interrupt();
+    stoppable.join();
+}
+
+TEST_F(ClockTest, gpioTimer) {
+    VirtualClock autoClock(true);
+    const auto start = autoClock.now();
+    std::vector<IClock::TimePoint> writes;
+    gpio::Waveform waveform;
+    waveform.steps = {{0, 1, milliseconds(200)}, {1, 1, milliseconds(0)}};
+    waveform.writer = [&autoClock, &writes](uint64_t, uint64_t) {
+        writes.push_back(autoClock.now());
+    };
+    waveform.timer = makeGpioTimer(autoClock);
+    gpio::WaveformEngine engine;
+    const auto result = engine.submit(std::move(waveform)).get();
+    ASSERT_EQ(writes.size(), 2);
+    EXPECT_EQ(writes[0], start);
+    EXPECT_EQ(writes[1], start + milliseconds(200));
+    EXPECT_EQ(result.maxJitter.count(), 0);
+}
+
+}  // namespace iqrf::connector
@@ -0,0 +1,240 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: OutboundSchedulerTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-04
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "iqrf/connector/IConnector.h"
+#include "iqrf/connector/OutboundScheduler.h"
+
+namespace iqrf::connector {
+
+/**
+ * Connector recording the sent messages.
+ */
+class RecordingConnector : public IConnector {
+ public:
+    State getState() const override { return State::Ready; }
+    std::vector<uint8_t> receive() override { return {}; }
+    TrInfo readTrInfo() override { return {}; }
+    void resetTr() override {}
+    void enterProgrammingMode() override {}
+    void awaitProgrammingMode() override {}
+    void exitProgrammingMode() override {}
+    void upload(const ProgrammingTarget, const std::vector<uint8_t> &) override {}
+    std::vector<uint8_t> download(const ProgrammingTarget) override { return {}; }
+    std::vector<uint8_t> download(const ProgrammingTarget, const uint16_t) override { return {}; }
+
+    using IConnector::send;
+
+    /// Messages written to the link
+    std::vector<std::vector<uint8_t>> sent;
+
+ protected:
+    void send(const std::vector<uint8_t> &data) override {
+        this->sent.push_back(data);
+    }
+};
+
+/**
+ * Connector whose link blocks until released and fails the messages starting with 0xEE.
+ */
+class FailingConnector : public RecordingConnector {
+ public:
+    using RecordingConnector::send;
+
+    /**
+     * Releases the blocked link.
+     */
+    void release() {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->blocked = false;
+        }
+        this->changed.notify_all();
+    }
+
+    /**
+     * Waits until a thread writes to the link.
+     */
+    void waitEntered() {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->changed.wait(lock, [this] { return this->entered; });
+    }
+
+ protected:
+    void send(const std::vector<uint8_t> &data) override {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->entered = true;
+        this->changed.notify_all();
+        this->changed.wait(lock, [this] { return !this->blocked; });
+        if (data.front() == 0xEE) {
+            throw std::runtime_error("Link failure");
+        }
+        this->sent.push_back(data);
+    }
+
+ private:
+    bool blocked = true;
+    bool entered = false;
+    std::mutex mutex;
+    std::condition_variable changed;
+};
+
+class OutboundSchedulerTest : public ::testing::Test {
+ protected:
+    /**
+     * Pops all frames and returns the first byte of each.
+     * @param exclusiveActive Whether exclusive access is active
+     * @return First bytes of the popped frames
+     */
+    std::vector<uint8_t> drain(const bool exclusiveActive = false) {
+        std::vector<uint8_t> order;
+        while (auto frame = this->scheduler.pop(exclusiveActive)) {
+            order.push_back(frame->data.front());
+        }
+        return order;
+    }
+
+    /// Scheduler under test
+    OutboundScheduler scheduler;
+};
+
+TEST_F(OutboundSchedulerTest, strictPriority) {
+    scheduler.enqueue(OutboundQueue::Normal, 1, {0x01});
+    scheduler.enqueue(OutboundQueue::High, 1, {0x02});
+    scheduler.enqueue(OutboundQueue::Exclusive, 2, {0x03});
+    scheduler.enqueue(OutboundQueue::Normal, 1, {0x04});
+
+    EXPECT_EQ(drain(), std::vector<uint8_t>({0x03, 0x02, 0x01, 0x04}));
+    EXPECT_EQ(scheduler.size(), 0);
+}
+
+TEST_F(OutboundSchedulerTest, deficitRoundRobinBetweenSenders) {
+    // Sender 1 floods the queue with 64 B frames, sender 2 sends small frames
+    for (uint8_t i = 0; i < 4; ++i) {
+        scheduler.enqueue(OutboundQueue::Normal, 1, std::vector<uint8_t>(64, 0x10 + i));
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+        scheduler.enqueue(OutboundQueue::Normal, 2, std::vector<uint8_t>(16, 0x20 + i));
+    }
+
+    // Quantum of 64 B lets sender 2 send all four small frames in its first round
+    EXPECT_EQ(drain(), std::vector<uint8_t>({0x10, 0x20, 0x21, 0x22, 0x23, 0x11, 0x12, 0x13}));
+}
+
+TEST_F(OutboundSchedulerTest, oversizedFrameAccumulatesDeficit) {
+    scheduler.configure({16, 16});
+    scheduler.enqueue(OutboundQueue::Normal, 1, std::vector<uint8_t>(40, 0x10));
+    scheduler.enqueue(OutboundQueue::Normal, 2, std::vector<uint8_t>(8, 0x20));
+    scheduler.enqueue(OutboundQueue::Normal, 2, std::vector<uint8_t>(8, 0x21));
+    scheduler.enqueue(OutboundQueue::Normal, 2, std::vector<uint8_t>(8, 0x22));
+
+    EXPECT_EQ(drain(), std::vector<uint8_t>({0x20, 0x21, 0x22, 0x10}));
+}
+
+TEST_F(OutboundSchedulerTest, exclusiveHoldsOtherQueues) {
+    scheduler.enqueue(OutboundQueue::Normal, 1, {0x01});
+    scheduler.enqueue(OutboundQueue::High, 1, {0x02});
+    scheduler.enqueue(OutboundQueue::Exclusive, 2, {0x03});
+
+    EXPECT_TRUE(scheduler.hasPending(true));
+    EXPECT_EQ(drain(true), std::vector<uint8_t>({0x03}));
+    EXPECT_FALSE(scheduler.hasPending(true));
+    EXPECT_EQ(scheduler.getStats().held, 2);
+
+    EXPECT_EQ(drain(false), std::vector<uint8_t>({0x02, 0x01}));
+    EXPECT_EQ(scheduler.getStats().held, 0);
+}
+
+TEST_F(OutboundSchedulerTest, queueLimit) {
+    scheduler.configure({64, 2});
+    scheduler.enqueue(OutboundQueue::Normal, 1, {0x01});
+    scheduler.enqueue(OutboundQueue::Normal, 1, {0x02});
+    EXPECT_THROW(scheduler.enqueue(OutboundQueue::Normal, 1, {0x03}), std::length_error);
+    scheduler.enqueue(OutboundQueue::High, 1, {0x04});
+
+    const auto &stats = scheduler.getStats();
+    EXPECT_EQ(stats.rejected[static_cast<std::size_t>(OutboundQueue::Normal)], 1);
+    EXPECT_EQ(stats.maxDepth[static_cast<std::size_t>(OutboundQueue::Normal)], 2);
+    EXPECT_THROW(scheduler.configure({0, 2}), std::invalid_argument);
+}
+
+TEST_F(OutboundSchedulerTest, connectorDrainsHeldTrafficAfterExclusiveAccess) {
+    RecordingConnector connector;
+    const auto handler = [](const std::vector<uint8_t> &) { return 0; };
+    const AccessToken normal = connector.registerResponseHandler(handler, AccessType::Normal);
+    AccessToken exclusive = connector.registerResponseHandler(handler, AccessType::Exclusive);
+    const AccessToken sniffer = connector.registerResponseHandler(handler, AccessType::Sniffer);
+    EXPECT_NE(normal.getSenderId(), exclusive.getSenderId());
+
+    // Normal traffic is held back instead of being rejected
+    EXPECT_NO_THROW(connector.send({0x01}, normal));
+    EXPECT_NO_THROW(connector.send({0x02}, normal, SendPriority::High));
+    connector.send({0x03}, exclusive);
+    EXPECT_EQ(connector.sent, std::vector<std::vector<uint8_t>>({{0x03}}));
+    EXPECT_EQ(connector.getOutboundStats().held, 2);
+    EXPECT_THROW(connector.send({0x04}, sniffer), std::runtime_error);
+
+    connector.unregisterResponseHandler(std::move(exclusive));
+    EXPECT_EQ(connector.sent, std::vector<std::vector<uint8_t>>({{0x03}, {0x02}, {0x01}}));
+
+    const auto stats = connector.getOutboundStats();
+    EXPECT_EQ(stats.dispatched[static_cast<std::size_t>(OutboundQueue::Exclusive)], 1);
+    EXPECT_EQ(stats.dispatched[static_cast<std::size_t>(OutboundQueue::High)], 1);
+    EXPECT_EQ(stats.dispatched[static_cast<std::size_t>(OutboundQueue::Normal)], 1);
+}
+
+TEST_F(OutboundSchedulerTest, connectorSendsBatch) {
+    RecordingConnector connector;
+    connector.configureOutbound({64, 2});
+    const auto handler = [](const std::vector<uint8_t> &) { return 0; };
+    const AccessToken token = connector.registerResponseHandler(handler, AccessType::Normal);
+
+    connector.sendBatch({{0x01}, {0x02}}, token, SendPriority::High);
+    EXPECT_EQ(connector.sent, std::vector<std::vector<uint8_t>>({{0x01}, {0x02}}));
+
+    // Messages enqueued before the queue overflowed are still sent
+    EXPECT_THROW(connector.sendBatch({{0x03}, {0x04}, {0x05}}, token), std::length_error);
+    EXPECT_EQ(connector.sent, std::vector<std::vector<uint8_t>>({{0x01}, {0x02}, {0x03}, {0x04}}));
+}
+
+TEST_F(OutboundSchedulerTest, failureReachesItsSender) {
+    FailingConnector connector;
+    const auto handler = [](const std::vector<uint8_t> &) { return 0; };
+    const AccessToken first = connector.registerResponseHandler(handler, AccessType::Normal);
+    const AccessToken second = connector.registerResponseHandler(handler, AccessType::Normal);
+
+    std::thread writer([&connector, &first] {
+        EXPECT_NO_THROW(connector.send({0x01}, first));
+    });
+    connector.waitEntered();
+    // Enqueued while the first sender writes, sent by the first sender's thread
+    std::thread failing([&connector, &second] {
+        EXPECT_THROW(connector.send({0xEE}, second), std::runtime_error);
+    });
+    while (connector.getOutboundStats().depth[static_cast<std::size_t>(OutboundQueue::Normal)] == 0) {
+        std::this_thread::yield();
+    }
+    connector.release();
+    writer.join();
+    failing.join();
+    EXPECT_EQ(connector.sent, std::vector<std::vector<uint8_t>>({{0x01}}));
+}
+
+}  // namespace iqrf::connector
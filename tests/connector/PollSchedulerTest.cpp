@@ -0,0 +1,232 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: PollSchedulerTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-08
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/PollScheduler.h"
+
+namespace iqrf::connector {
+
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+class PollSchedulerTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates the scheduler recording the batches.
+     * @param startJitter Start jitter of periodic jobs
+     */
+    void create(const double startJitter = 0) {
+        PollSchedulerConfig config;
+        config.tick = milliseconds(10);
+        config.startJitter = startJitter;
+        config.seed = 42;
+        this->scheduler = std::make_unique<PollScheduler>(
+            [this](const std::vector<std::vector<uint8_t>> &frames, const SendPriority priority) {
+                this->batches.emplace_back(frames, priority);
+            },
+            config,
+            this->epoch
+        );
+    }
+
+    /**
+     * Returns the time after the epoch.
+     * @param offset Offset from the epoch
+     * @return Time point
+     */
+    PollScheduler::Clock::time_point at(const PollScheduler::Clock::duration offset) const {
+        return this->epoch + offset;
+    }
+
+    /// Epoch of the scheduler
+    const PollScheduler::Clock::time_point epoch = PollScheduler::Clock::time_point(seconds(100));
+    /// Scheduler under test
+    std::unique_ptr<PollScheduler> scheduler;
+    /// Received batches
+    std::vector<std::pair<std::vector<std::vector<uint8_t>>, SendPriority>> batches;
+};
+
+TEST_F(PollSchedulerTest, oneShotJob) {
+    create();
+    scheduler->scheduleOnce({0x01}, milliseconds(25));
+
+    EXPECT_EQ(scheduler->advance(at(milliseconds(20))), 0);
+    EXPECT_EQ(scheduler->advance(at(milliseconds(30))), 1);
+    ASSERT_EQ(batches.size(), 1);
+    EXPECT_EQ(batches[0].first, std::vector<std::vector<uint8_t>>({{0x01}}));
+    EXPECT_EQ(scheduler->advance(at(seconds(10))), 0);
+    EXPECT_EQ(scheduler->getStats().jobs, 0);
+}
+
+TEST_F(PollSchedulerTest, periodicJobKeepsPhase) {
+    create();
+    scheduler->schedulePeriodic({0x01}, milliseconds(100));
+
+    // Runs at 0, 100, 200, ... ms even if the scheduler is advanced late
+    EXPECT_EQ(scheduler->advance(at(milliseconds(0))), 1);
+    EXPECT_EQ(scheduler->advance(at(milliseconds(150))), 1);
+    EXPECT_EQ(scheduler->advance(at(milliseconds(450))), 3);
+    EXPECT_EQ(scheduler->advance(at(milliseconds(499))), 0);
+    EXPECT_EQ(scheduler->advance(at(milliseconds(500))), 1);
+}
+
+TEST_F(PollSchedulerTest, jobsInSameTickAreBatched) {
+    create();
+    scheduler->scheduleOnce({0x01}, milliseconds(11));
+    scheduler->scheduleOnce({0x02}, milliseconds(20));
+    scheduler->scheduleOnce({0x03}, milliseconds(15), SendPriority::High);
+    scheduler->scheduleOnce({0x04}, milliseconds(30));
+
+    EXPECT_EQ(scheduler->advance(at(milliseconds(20))), 3);
+    ASSERT_EQ(batches.size(), 2);
+    EXPECT_EQ(batches[0].second, SendPriority::High);
+    EXPECT_EQ(batches[0].first, std::vector<std::vector<uint8_t>>({{0x03}}));
+    EXPECT_EQ(batches[1].second, SendPriority::Normal);
+    EXPECT_EQ(batches[1].first, std::vector<std::vector<uint8_t>>({{0x01}, {0x02}}));
+    EXPECT_EQ(scheduler->getStats().maxBatchSize, 2);
+}
+
+TEST_F(PollSchedulerTest, cancel) {
+    create();
+    const PollJobId first = scheduler->scheduleOnce({0x01}, milliseconds(10));
+    const PollJobId second = scheduler->schedulePeriodic({0x02}, milliseconds(10));
+    EXPECT_NE(first, 0);
+    EXPECT_TRUE(scheduler->cancel(first));
+    EXPECT_FALSE(scheduler->cancel(first));
+
+    // Reused slot does not match the old identifier
+    const PollJobId third = scheduler->scheduleOnce({0x03}, milliseconds(10));
+    EXPECT_NE(first, third);
+    EXPECT_FALSE(scheduler->cancel(first));
+
+    // Periodic job without jitter runs at once and then every tick
+    EXPECT_EQ(scheduler->advance(at(milliseconds(10))), 3);
+    EXPECT_TRUE(scheduler->cancel(second));
+    EXPECT_EQ(scheduler->advance(at(seconds(1))), 0);
+    EXPECT_EQ(scheduler->getStats().cancelled, 2);
+}
+
+TEST_F(PollSchedulerTest, longDelaysCascade) {
+    create();
+    // Level 0 covers 2.56 s, level 1 655.36 s, level 2 about 46 hours
+    scheduler->scheduleOnce({0x01}, milliseconds(2570));
+    scheduler->scheduleOnce({0x02}, seconds(700));
+    scheduler->scheduleOnce({0x03}, std::chrono::hours(50));
+
+    EXPECT_EQ(scheduler->advance(at(milliseconds(2560))), 0);
+    EXPECT_EQ(scheduler->advance(at(milliseconds(2570))), 1);
+    EXPECT_EQ(scheduler->advance(at(milliseconds(699990))), 0);
+    EXPECT_EQ(scheduler->advance(at(seconds(700))), 1);
+    EXPECT_EQ(scheduler->advance(at(std::chrono::hours(50) - milliseconds(10))), 0);
+    EXPECT_EQ(scheduler->advance(at(std::chrono::hours(50))), 1);
+    EXPECT_GT(scheduler->getStats().cascaded, 0);
+    // Only the ticks running or cascading a job are processed, not all 18M of them
+    EXPECT_LT(scheduler->getStats().ticks, 20);
+}
+
+TEST_F(PollSchedulerTest, startJitterSpreadsJobs) {
+    create(1.0);
+    for (uint8_t i = 0; i < 100; ++i) {
+        scheduler->schedulePeriodic({i}, seconds(1));
+    }
+
+    // 100 jobs over 100 ticks of the first period, none of them falls into the second one
+    EXPECT_EQ(scheduler->advance(at(milliseconds(990))), 100);
+    EXPECT_GT(batches.size(), 40);
+    EXPECT_LT(scheduler->getStats().maxBatchSize, 10);
+}
+
+TEST_F(PollSchedulerTest, manyJobs) {
+    create(1.0);
+    for (uint32_t i = 0; i < 100000; ++i) {
+        scheduler->schedulePeriodic({static_cast<uint8_t>(i)}, seconds(60));
+    }
+    EXPECT_EQ(scheduler->getStats().jobs, 100000);
+    EXPECT_EQ(scheduler->advance(at(seconds(60) - milliseconds(10))), 100000);
+    EXPECT_EQ(scheduler->advance(at(seconds(120) - milliseconds(10))), 100000);
+}
+
+TEST_F(PollSchedulerTest, thread) {
+    std::vector<std::vector<uint8_t>> sent;
+    std::mutex mutex;
+    PollScheduler threaded([&](const std::vector<std::vector<uint8_t>> &frames, const SendPriority) {
+        std::lock_guard<std::mutex> lock(mutex);
+        sent.insert(sent.end(), frames.begin(), frames.end());
+    });
+    threaded.start();
+    EXPECT_THROW(threaded.start(), std::logic_error);
+    threaded.scheduleOnce({0x01}, milliseconds(20));
+    std::this_thread::sleep_for(milliseconds(200));
+    threaded.stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(sent, std::vector<std::vector<uint8_t>>({{0x01}}));
+}
+
+TEST_F(PollSchedulerTest, threadSleepsUntilNextJob) {
+    PollScheduler threaded([](const std::vector<std::vector<uint8_t>> &, const SendPriority) {});
+    threaded.start();
+    threaded.scheduleOnce({0x01}, std::chrono::hours(1));
+    std::this_thread::sleep_for(milliseconds(200));
+    // Woken up by the job scheduled earlier than the thread sleeps, not on every tick
+    const uint64_t wakeups = threaded.getStats().wakeups;
+    threaded.stop();
+    EXPECT_LE(wakeups, 2);
+}
+
+TEST_F(PollSchedulerTest, threadRunsOnClock) {
+    const auto clock = std::make_shared<VirtualClock>();
+    std::vector<std::vector<uint8_t>> sent;
+    std::mutex mutex;
+    PollSchedulerConfig config;
+    config.clock = clock;
+    PollScheduler threaded([&](const std::vector<std::vector<uint8_t>> &frames, const SendPriority) {
+        std::lock_guard<std::mutex> lock(mutex);
+        sent.insert(sent.end(), frames.begin(), frames.end());
+    }, config);
+    threaded.start();
+    ASSERT_TRUE(clock->waitForSleepers(1));
+    // The idle thread is woken up by the job and sleeps until the tick it is due in
+    threaded.scheduleOnce({0x01}, milliseconds(20));
+    auto deadline = clock->nextDeadline();
+    while (!deadline.has_value() || *deadline > clock->now() + milliseconds(30)) {
+        std::this_thread::yield();
+        deadline = clock->nextDeadline();
+    }
+    EXPECT_GE(*deadline, clock->now() + milliseconds(20));
+    clock->advanceTo(*deadline);
+    ASSERT_TRUE(clock->waitForSleepers(1));
+    threaded.stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(sent, std::vector<std::vector<uint8_t>>({{0x01}}));
+}
+
+TEST_F(PollSchedulerTest, invalidArguments) {
+    PollSchedulerConfig config;
+    config.tick = milliseconds(0);
+    EXPECT_THROW(PollScheduler([](const auto &, SendPriority) {}, config), std::invalid_argument);
+    create();
+    EXPECT_THROW(scheduler->schedulePeriodic({0x01}, milliseconds(0)), std::invalid_argument);
+}
+
+}  // namespace iqrf::connector
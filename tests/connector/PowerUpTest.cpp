@@ -0,0 +1,125 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: PowerUpTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-18
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/PowerUp.h"
+
+namespace iqrf::connector {
+
+using std::chrono::milliseconds;
+
+class PowerUpTest : public ::testing::Test {
+ protected:
+    /**
+     * Returns the frame waiter of a TR module sending a frame once it is ready
+     * @param readyAfter Time since the start of the test the TR module becomes ready
+     * @param answersProbe The TR module sends a frame only as a response to a probe
+     * @return Frame waiter
+     */
+    PowerUpMonitor::FrameWaiter trModule(const milliseconds readyAfter, const bool answersProbe = false) {
+        return [this, readyAfter, answersProbe](const IClock::Duration timeout) {
+            this->slices.push_back(std::chrono::duration_cast<milliseconds>(timeout));
+            const IClock::TimePoint readyAt = this->start + readyAfter;
+            const bool pendingProbe = this->probes > this->answered;
+            if (answersProbe && !pendingProbe) {
+                this->clock.sleepFor(timeout);
+                return false;
+            }
+            if (this->clock.now() + timeout < readyAt) {
+                this->clock.sleepFor(timeout);
+                return false;
+            }
+            // The frame arrives once the TR module is ready
+            this->clock.sleepUntil(readyAt);
+            this->answered = this->probes;
+            return true;
+        };
+    }
+
+    /// Clock advanced by the sleeps
+    VirtualClock clock{true};
+    /// Start of the test
+    const IClock::TimePoint start = clock.now();
+    /// Waiting intervals
+    std::vector<milliseconds> slices;
+    /// Number of sent probes
+    unsigned probes = 0;
+    /// Number of answered probes
+    unsigned answered = 0;
+};
+
+TEST_F(PowerUpTest, endsOnFirstFrame) {
+    PowerUpMonitor monitor;
+    EXPECT_EQ(monitor.awaitReady(clock, trModule(milliseconds(5))), ReadySignal::Frame);
+    EXPECT_EQ(clock.now() - start, milliseconds(5));
+    EXPECT_EQ(monitor.getStats().lastTimeToReady, milliseconds(5));
+    EXPECT_EQ(monitor.getStats().lastSignal, ReadySignal::Frame);
+    EXPECT_EQ(monitor.getStats().probes, 0);
+}
+
+TEST_F(PowerUpTest, probesWithExponentialIntervals) {
+    PowerUpMonitor monitor;
+    const auto probe = [this]() { this->probes++; };
+    EXPECT_EQ(monitor.awaitReady(clock, trModule(milliseconds(50), true), probe), ReadySignal::Probe);
+    // Waiting 10 ms, 20 ms and the probe answered within the third interval
+    EXPECT_EQ(slices, std::vector<milliseconds>({milliseconds(10), milliseconds(20), milliseconds(40)}));
+    EXPECT_EQ(clock.now() - start, milliseconds(50));
+    EXPECT_EQ(monitor.getStats().probes, 2);
+}
+
+TEST_F(PowerUpTest, timeoutIsUpperBound) {
+    PowerUpConfig config;
+    config.readyTimeout = milliseconds(200);
+    PowerUpMonitor monitor(config);
+    const auto probe = [this]() { this->probes++; };
+    EXPECT_EQ(monitor.awaitReady(clock, trModule(milliseconds(1000)), probe), ReadySignal::Timeout);
+    EXPECT_EQ(clock.now() - start, milliseconds(200));
+    // 10 + 20 + 40 + 80 + 50 ms, no probe after the last interval
+    EXPECT_EQ(slices.size(), 5);
+    EXPECT_EQ(slices.back(), milliseconds(50));
+    EXPECT_EQ(probes, 4);
+
+    const PowerUpStats stats = monitor.getStats();
+    EXPECT_EQ(stats.powerUps, 1);
+    EXPECT_EQ(stats.timeouts, 1);
+    EXPECT_EQ(stats.maxTimeToReady, milliseconds(200));
+}
+
+TEST_F(PowerUpTest, readyGpio) {
+    PowerUpConfig config;
+    config.probe = false;
+    PowerUpMonitor monitor(config);
+    const auto readyLine = [this]() { return this->clock.now() - this->start >= milliseconds(25); };
+    const auto probe = [this]() { this->probes++; };
+    EXPECT_EQ(monitor.awaitReady(clock, trModule(milliseconds(1000)), probe, readyLine), ReadySignal::Gpio);
+    EXPECT_EQ(clock.now() - start, milliseconds(30));
+    EXPECT_EQ(probes, 0);
+
+    // The statistics accumulate over the power-ups
+    EXPECT_EQ(monitor.awaitReady(clock, trModule(milliseconds(0)), probe, readyLine), ReadySignal::Gpio);
+    EXPECT_EQ(monitor.getStats().powerUps, 2);
+    EXPECT_EQ(monitor.getStats().totalTimeToReady, milliseconds(30));
+}
+
+TEST_F(PowerUpTest, invalidConfig) {
+    PowerUpConfig config;
+    config.probeInterval = milliseconds(0);
+    EXPECT_THROW(PowerUpMonitor{config}, std::invalid_argument);
+    EXPECT_STREQ(PowerUpMonitor::signalName(ReadySignal::Timeout), "timeout");
+}
+
+}  // namespace iqrf::connector
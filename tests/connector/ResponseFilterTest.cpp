@@ -0,0 +1,302 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: ResponseFilterTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-15
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/IConnector.h"
+#include "iqrf/connector/ResponseFilter.h"
+
+namespace iqrf::connector {
+
+/**
+ * Connector receiving the queued messages.
+ */
+class QueueConnector : public IConnector {
+ public:
+    State getState() const override { return State::Ready; }
+    TrInfo readTrInfo() override { return {}; }
+    void resetTr() override {}
+    void enterProgrammingMode() override {}
+    void awaitProgrammingMode() override {}
+    void exitProgrammingMode() override {}
+    void upload(const ProgrammingTarget, const std::vector<uint8_t> &) override {}
+    std::vector<uint8_t> download(const ProgrammingTarget) override { return {}; }
+    std::vector<uint8_t> download(const ProgrammingTarget, const uint16_t) override { return {}; }
+
+    std::vector<uint8_t> receive() override {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->incoming.empty()) {
+            return {};
+        }
+        auto message = this->incoming.front();
+        this->incoming.pop_front();
+        return message;
+    }
+
+    /**
+     * Queues the message to be received.
+     * @param message Message
+     */
+    void push(const std::vector<uint8_t> &message) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->incoming.push_back(message);
+    }
+
+ protected:
+    void send(const std::vector<uint8_t> &) override {}
+
+ private:
+    /// Messages to be received
+    std::deque<std::vector<uint8_t>> incoming;
+    /// Guards the incoming messages
+    std::mutex mutex;
+};
+
+class ResponseFilterTest : public ::testing::Test {
+ protected:
+    /**
+     * Subscribes a handler counting the messages.
+     * @param id Subscriber identifier
+     * @param filter Message filter
+     */
+    void subscribe(const SenderId id, const ResponseFilter &filter) {
+        this->table.add(id, [this, id](const std::vector<uint8_t> &) {
+            this->received.push_back(id);
+            return 0;
+        }, filter);
+    }
+
+    /**
+     * Dispatches the message and returns the subscribers which received it.
+     * @param message Message
+     * @return Subscriber identifiers
+     */
+    std::vector<SenderId> dispatch(const std::vector<uint8_t> &message) {
+        this->received.clear();
+        this->table.dispatch(message);
+        return this->received;
+    }
+
+    /// Table under test
+    SubscriptionTable table;
+    /// Subscribers which received the last message
+    std::vector<SenderId> received;
+    /// LEDR Pulse response from node 1
+    const std::vector<uint8_t> ledrNode1 = {0x01, 0x00, 0x06, 0x83, 0xff, 0xff, 0x00, 0x40};
+    /// LEDR Pulse confirmation for node 1
+    const std::vector<uint8_t> ledrConfirmation = {0x01, 0x00, 0x06, 0x03, 0xff, 0xff, 0xff, 0x40, 0x01, 0x06, 0x01};
+    /// Thermometer response from node 5 with HWPID 0x1234
+    const std::vector<uint8_t> thermometerNode5 = {0x05, 0x00, 0x0a, 0x80, 0x34, 0x12, 0x00, 0x40, 0x17, 0x70, 0x01};
+    /// Asynchronous response from node 300
+    const std::vector<uint8_t> asyncNode300 = {0x2c, 0x01, 0x20, 0x80, 0xff, 0xff, 0x80, 0x00};
+};
+
+TEST_F(ResponseFilterTest, emptyFilterMatchesEverything) {
+    subscribe(1, ResponseFilter());
+    EXPECT_TRUE(ResponseFilter().empty());
+    EXPECT_EQ(dispatch(ledrNode1), std::vector<SenderId>({1}));
+    // Messages which are not DPA messages go only to unfiltered handlers
+    subscribe(2, ResponseFilter().pnum(dpa::pnum::LEDR));
+    EXPECT_EQ(dispatch({0x01, 0x02}), std::vector<SenderId>({1}));
+}
+
+TEST_F(ResponseFilterTest, nodeAddresses) {
+    subscribe(1, ResponseFilter().nadr(0x0001));
+    subscribe(2, ResponseFilter().nadrRange(0x0002, 0x0010).nadr(0x012c));
+    subscribe(3, ResponseFilter().nadrRange(0x0100, 0x0200));
+    EXPECT_EQ(dispatch(ledrNode1), std::vector<SenderId>({1}));
+    EXPECT_EQ(dispatch(thermometerNode5), std::vector<SenderId>({2}));
+    EXPECT_EQ(dispatch(asyncNode300), std::vector<SenderId>({2, 3}));
+    EXPECT_THROW(ResponseFilter().nadrRange(2, 1), std::invalid_argument);
+}
+
+TEST_F(ResponseFilterTest, peripheralCommandKindAndHwpid) {
+    subscribe(1, ResponseFilter().pnum(dpa::pnum::LEDR).pnum(dpa::pnum::LEDG));
+    subscribe(2, ResponseFilter().pnum(dpa::pnum::THERMOMETER).hwpid(0x1234));
+    subscribe(3, ResponseFilter().pnum(dpa::pnum::THERMOMETER).hwpid(0x4321));
+    subscribe(4, ResponseFilter().kind(MessageKind::Asynchronous));
+    subscribe(5, ResponseFilter().kind(MessageKind::Confirmation | MessageKind::Asynchronous));
+    subscribe(6, ResponseFilter().pcmd(0x7f, 0x03));
+
+    EXPECT_EQ(dispatch(ledrNode1), std::vector<SenderId>({1, 6}));
+    EXPECT_EQ(dispatch(ledrConfirmation), std::vector<SenderId>({1, 5, 6}));
+    EXPECT_EQ(dispatch(thermometerNode5), std::vector<SenderId>({2}));
+    EXPECT_EQ(dispatch(asyncNode300), std::vector<SenderId>({4, 5}));
+}
+
+TEST_F(ResponseFilterTest, pnumJumpTableLimitsEvaluations) {
+    for (SenderId id = 1; id <= 100; ++id) {
+        subscribe(id, ResponseFilter().pnum(static_cast<uint8_t>(0x20 + id)));
+    }
+    subscribe(101, ResponseFilter().pnum(dpa::pnum::LEDR).nadr(0x0002));
+    EXPECT_TRUE(dispatch(ledrNode1).empty());
+
+    const auto &stats = table.getStats();
+    // Only the single subscription of LEDR has been evaluated
+    EXPECT_EQ(stats.evaluations, 1);
+    EXPECT_EQ(stats.messages, 1);
+    EXPECT_EQ(stats.unmatched, 1);
+    EXPECT_EQ(stats.deliveries, 0);
+    EXPECT_GE(stats.evaluationTime.count(), 0);
+
+    EXPECT_TRUE(table.remove(101));
+    EXPECT_FALSE(table.remove(101));
+}
+
+TEST_F(ResponseFilterTest, handlerCanUnsubscribeItself) {
+    table.add(1, [this](const std::vector<uint8_t> &) {
+        this->table.remove(1);
+        return 0;
+    }, ResponseFilter());
+    subscribe(2, ResponseFilter());
+    EXPECT_EQ(table.dispatch(ledrNode1), 2);
+    EXPECT_EQ(table.dispatch(ledrNode1), 1);
+}
+
+TEST_F(ResponseFilterTest, batchDelivery) {
+    std::vector<std::size_t> batches;
+    BatchDeliveryConfig config;
+    config.maxBatchSize = 3;
+    config.maxLinger = std::chrono::milliseconds(10);
+    table.addBatch(1, [&batches](const std::vector<std::vector<uint8_t>> &messages) {
+        batches.push_back(messages.size());
+        return 0;
+    }, ResponseFilter().pnum(dpa::pnum::LEDR), config);
+    subscribe(2, ResponseFilter());
+
+    // Full batch is delivered immediately, plain handlers get every message
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(dispatch(ledrNode1), std::vector<SenderId>({2}));
+    }
+    EXPECT_EQ(batches, std::vector<std::size_t>({3}));
+    EXPECT_TRUE(table.hasPending());
+
+    // The remaining message waits for the linger time
+    const auto now = std::chrono::steady_clock::now();
+    EXPECT_EQ(table.flushExpired(now - std::chrono::seconds(1)), 0);
+    EXPECT_EQ(table.flushExpired(now + std::chrono::seconds(1)), 1);
+    EXPECT_EQ(batches, std::vector<std::size_t>({3, 1}));
+    EXPECT_FALSE(table.hasPending());
+
+    // Removal delivers the pending messages
+    table.dispatch(ledrNode1);
+    table.dispatch(ledrNode1);
+    EXPECT_EQ(table.flush(), 1);
+    table.dispatch(ledrNode1);
+    EXPECT_TRUE(table.remove(1));
+    EXPECT_EQ(batches, std::vector<std::size_t>({3, 1, 2, 1}));
+
+    const auto &stats = table.getStats();
+    EXPECT_EQ(stats.batches, 4);
+    EXPECT_EQ(stats.batchSizes[DispatchStats::batchSizeBucket(1)], 2);
+    EXPECT_EQ(stats.batchSizes[DispatchStats::batchSizeBucket(2)], 1);
+    EXPECT_EQ(stats.batchSizes[DispatchStats::batchSizeBucket(3)], 1);
+    EXPECT_THROW(table.addBatch(3, nullptr, ResponseFilter(), BatchDeliveryConfig{0}), std::invalid_argument);
+}
+
+TEST_F(ResponseFilterTest, batchSizeBuckets) {
+    EXPECT_EQ(DispatchStats::batchSizeBucket(1), 0);
+    EXPECT_EQ(DispatchStats::batchSizeBucket(2), 1);
+    EXPECT_EQ(DispatchStats::batchSizeBucket(3), 2);
+    EXPECT_EQ(DispatchStats::batchSizeBucket(4), 2);
+    EXPECT_EQ(DispatchStats::batchSizeBucket(5), 3);
+    EXPECT_EQ(DispatchStats::batchSizeBucket(64), 6);
+    EXPECT_EQ(DispatchStats::batchSizeBucket(65), 7);
+    EXPECT_EQ(DispatchStats::batchSizeBucket(1000), 7);
+}
+
+TEST_F(ResponseFilterTest, connectorDeliversToMatchingHandlers) {
+    QueueConnector connector;
+    const auto clock = std::make_shared<VirtualClock>();
+    connector.setClock(clock);
+    std::mutex mutex;
+    std::vector<std::vector<uint8_t>> node1;
+    std::vector<std::vector<uint8_t>> node5;
+    std::vector<std::vector<uint8_t>> sniffed;
+    const auto record = [&mutex](std::vector<std::vector<uint8_t>> &target) {
+        return [&mutex, &target](const std::vector<uint8_t> &message) {
+            std::lock_guard<std::mutex> lock(mutex);
+            target.push_back(message);
+            return 0;
+        };
+    };
+    const AccessToken first = connector.registerResponseHandler(
+        record(node1), AccessType::Normal, ResponseFilter().nadr(0x0001)
+    );
+    const AccessToken second = connector.registerResponseHandler(
+        record(node5), AccessType::Normal, ResponseFilter().nadr(0x0005)
+    );
+    const AccessToken sniffer = connector.registerResponseHandler(record(sniffed), AccessType::Sniffer);
+
+    connector.push(ledrNode1);
+    connector.push(thermometerNode5);
+    connector.listen();
+    // The listening loop sleeps once all queued messages are processed
+    ASSERT_TRUE(clock->waitForSleepers(1));
+    connector.stopListen();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(node1, std::vector<std::vector<uint8_t>>({ledrNode1}));
+    EXPECT_EQ(node5, std::vector<std::vector<uint8_t>>({thermometerNode5}));
+    EXPECT_EQ(sniffed.size(), 2);
+    EXPECT_EQ(connector.getDispatchStats(AccessType::Normal).deliveries, 2);
+    // Each subscription is a handler of its own
+    EXPECT_NE(first.getSenderId(), second.getSenderId());
+    EXPECT_EQ(sniffer.getAccessType(), AccessType::Sniffer);
+}
+
+TEST_F(ResponseFilterTest, connectorDeliversBurstInBatches) {
+    QueueConnector connector;
+    const auto clock = std::make_shared<VirtualClock>();
+    connector.setClock(clock);
+    std::mutex mutex;
+    std::vector<std::size_t> batches;
+    BatchDeliveryConfig config;
+    config.maxBatchSize = 4;
+    AccessToken sniffer = connector.registerBatchResponseHandler(
+        [&mutex, &batches](const std::vector<std::vector<uint8_t>> &messages) {
+            std::lock_guard<std::mutex> lock(mutex);
+            batches.push_back(messages.size());
+            return 0;
+        },
+        AccessType::Sniffer,
+        config
+    );
+    EXPECT_THROW(connector.registerBatchResponseHandler(nullptr, AccessType::Exclusive), std::runtime_error);
+
+    for (int i = 0; i < 6; ++i) {
+        connector.push(thermometerNode5);
+    }
+    connector.listen();
+    // The listening loop sleeps once all queued messages are processed
+    ASSERT_TRUE(clock->waitForSleepers(1));
+    connector.stopListen();
+    connector.unregisterResponseHandler(std::move(sniffer));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // The burst is split by the maximal batch size, the rest is delivered once the link is idle
+    EXPECT_EQ(batches, std::vector<std::size_t>({4, 2}));
+    const auto stats = connector.getDispatchStats(AccessType::Sniffer);
+    EXPECT_EQ(stats.messages, 6);
+    EXPECT_EQ(stats.batches, 2);
+}
+
+}  // namespace iqrf::connector
@@ -0,0 +1,141 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: SendPacerTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-06
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "iqrf/connector/SendPacer.h"
+
+namespace iqrf::connector {
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+class SendPacerTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates pacing configuration with round numbers.
+     */
+    void SetUp() override {
+        this->config.trBufferSize = 32;
+        this->config.frameOverhead = 0;
+        // 10 us per RF bit, the TR buffer is emptied at 80 us per byte
+        this->config.rfBitRate = 100000;
+        this->config.rfOverhead = 0;
+        this->config.dutyCycle = 0.5;
+        this->config.airtimeBurst = microseconds(0);
+        this->config.confirmationTimeout = milliseconds(100);
+    }
+
+    /// Pacing configuration
+    PacingConfig config;
+    /// Start of the test time
+    const SendPacer::Clock::time_point start = SendPacer::Clock::time_point(std::chrono::seconds(1));
+    /// DPA request to the coordinator (no RF)
+    const std::vector<uint8_t> localRequest = std::vector<uint8_t>(16, 0x00);
+    /// DPA request to node 1
+    const std::vector<uint8_t> remoteRequest = {0x01, 0x00, 0x06, 0x01, 0xff, 0xff};
+    /// DPA confirmation from the coordinator
+    const std::vector<uint8_t> confirmation = {0x01, 0x00, 0x06, 0x01, 0xff, 0xff, 0xff, 0x00, 0x01, 0x06, 0x01};
+};
+
+TEST_F(SendPacerTest, trBufferBurstThenDrainRate) {
+    SendPacer pacer(config, start);
+
+    // Two 16 B frames fit into the 32 B buffer
+    EXPECT_EQ(pacer.reserve(localRequest, start), microseconds(0));
+    EXPECT_EQ(pacer.reserve(localRequest, start), microseconds(0));
+    // The third one has to wait until the TR empties 16 B of the buffer
+    EXPECT_EQ(pacer.reserve(localRequest, start), microseconds(1280));
+    // After 1 ms the deficit of the third frame is 3.5 B
+    EXPECT_EQ(pacer.reserve(localRequest, start + milliseconds(1)), microseconds(1560));
+
+    const auto &stats = pacer.getStats();
+    EXPECT_EQ(stats.frames, 4);
+    EXPECT_EQ(stats.delayedFrames, 2);
+    EXPECT_EQ(stats.delayedByTrBuffer, 2);
+    EXPECT_EQ(stats.delayedByAirtime, 0);
+    EXPECT_EQ(stats.maxDelay, microseconds(1560));
+    EXPECT_EQ(stats.totalDelay, microseconds(2840));
+    EXPECT_EQ(stats.lastReason, PacingReason::TrBuffer);
+}
+
+TEST_F(SendPacerTest, trBufferLimitsRemoteBurst) {
+    config.airtimeBurst = milliseconds(100);
+    SendPacer pacer(config, start);
+
+    // Five 6 B requests fit into the 32 B buffer, the airtime burst allows many more
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(pacer.reserve(remoteRequest, start), microseconds(0));
+    }
+    // The sixth one waits until the TR transmits the missing 4 B
+    EXPECT_EQ(pacer.reserve(remoteRequest, start), microseconds(320));
+    EXPECT_EQ(pacer.getStats().lastReason, PacingReason::TrBuffer);
+    EXPECT_EQ(pacer.getStats().delayedByAirtime, 0);
+}
+
+TEST_F(SendPacerTest, airtimeEstimate) {
+    const SendPacer pacer(config, start);
+    EXPECT_EQ(pacer.estimateAirtime(localRequest), microseconds(0));
+    // Request and response, 6 B each, 10 us per bit
+    EXPECT_EQ(pacer.estimateAirtime(remoteRequest), microseconds(960));
+    // Broadcast has no response
+    EXPECT_EQ(pacer.estimateAirtime({0xff, 0x00, 0x06, 0x01, 0xff, 0xff}), microseconds(480));
+    // Local device address does not use RF
+    EXPECT_EQ(pacer.estimateAirtime({0xfc, 0x00, 0x06, 0x01, 0xff, 0xff}), microseconds(0));
+}
+
+TEST_F(SendPacerTest, dutyCycle) {
+    SendPacer pacer(config, start);
+
+    // 960 us of airtime at 50 % duty cycle
+    EXPECT_EQ(pacer.reserve(remoteRequest, start), microseconds(1920));
+    EXPECT_EQ(pacer.getStats().lastReason, PacingReason::Airtime);
+    EXPECT_EQ(pacer.getStats().totalAirtime, microseconds(960));
+}
+
+TEST_F(SendPacerTest, missingConfirmationSlowsDown) {
+    SendPacer pacer(config, start);
+
+    EXPECT_EQ(pacer.reserve(remoteRequest, start), microseconds(1920));
+    pacer.onSent(remoteRequest, start + microseconds(1920));
+
+    // No confirmation within 100 ms halves the rate, the same frame now waits twice as long
+    auto now = start + milliseconds(200);
+    EXPECT_EQ(pacer.reserve(remoteRequest, now), microseconds(3840));
+    EXPECT_EQ(pacer.getStats().confirmationTimeouts, 1);
+    EXPECT_DOUBLE_EQ(pacer.getStats().rateFactor, 0.5);
+    pacer.onSent(remoteRequest, now);
+
+    // Confirmation increases the rate again
+    pacer.onReceived(confirmation, now + milliseconds(10));
+    EXPECT_EQ(pacer.getStats().confirmations, 1);
+    EXPECT_DOUBLE_EQ(pacer.getStats().rateFactor, 0.625);
+
+    // Confirmation which is not expected does not change the rate
+    pacer.onReceived(confirmation, now + milliseconds(20));
+    EXPECT_EQ(pacer.getStats().confirmations, 2);
+    EXPECT_DOUBLE_EQ(pacer.getStats().rateFactor, 0.625);
+}
+
+TEST_F(SendPacerTest, invalidConfig) {
+    config.dutyCycle = 0;
+    EXPECT_THROW(SendPacer pacer(config), std::invalid_argument);
+    config.dutyCycle = 0.01;
+    config.rfBitRate = 0;
+    EXPECT_THROW(SendPacer pacer(config), std::invalid_argument);
+}
+
+}  // namespace iqrf::connector
@@ -0,0 +1,143 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: DpaFrameTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-13
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "iqrf/connector/dpa/DpaBuilder.h"
+#include "iqrf/connector/dpa/DpaFrame.h"
+#include "iqrf/connector/dpa/DpaPayload.h"
+
+namespace iqrf::connector::dpa {
+
+// Builders are usable in constant expressions
+static_assert(LedrPulse::build(0x0001)[PNUM_OFFSET] == pnum::LEDR);
+static_assert(IoSet<2>::SIZE == REQUEST_HEADER_SIZE + 6);
+
+TEST(DpaFrameTest, requestView) {
+    const std::vector<uint8_t> frame = {0x05, 0x00, 0x09, 0x01, 0x34, 0x12, 0x00, 0x01, 0x01};
+    const DpaRequestView request(frame);
+    EXPECT_EQ(request.nadr(), 0x0005);
+    EXPECT_EQ(request.pnum(), pnum::IO);
+    EXPECT_EQ(request.pcmd(), pcmd::IO_SET);
+    EXPECT_EQ(request.hwpid(), 0x1234);
+    EXPECT_EQ(request.pdata().toVector(), std::vector<uint8_t>({0x00, 0x01, 0x01}));
+    // The view does not copy the frame
+    EXPECT_EQ(request.pdata().data(), frame.data() + REQUEST_PDATA_OFFSET);
+    EXPECT_TRUE(request.isRemote());
+    EXPECT_FALSE(request.isBroadcast());
+
+    EXPECT_THROW(DpaRequestView(std::vector<uint8_t>({0x00, 0x00, 0x06})), std::invalid_argument);
+    EXPECT_EQ(DpaRequestView::tryParse(std::vector<uint8_t>({0x00, 0x00})), std::nullopt);
+    EXPECT_EQ(DpaRequestView::tryParse(std::vector<uint8_t>({0x00, 0x00, 0x06, 0x81, 0xff, 0xff})), std::nullopt);
+}
+
+TEST(DpaFrameTest, responseView) {
+    const std::vector<uint8_t> frame = {0x01, 0x00, 0x0a, 0x80, 0x02, 0x01, 0x00, 0x40, 0x17, 0x70, 0x01};
+    const auto response = DpaResponseView::tryParse(frame);
+    ASSERT_TRUE(response.has_value());
+    EXPECT_EQ(response->nadr(), 0x0001);
+    EXPECT_EQ(response->pnum(), pnum::THERMOMETER);
+    EXPECT_EQ(response->pcmd(), 0x80);
+    EXPECT_EQ(response->requestPcmd(), pcmd::THERMOMETER_READ);
+    EXPECT_EQ(response->hwpid(), 0x0102);
+    EXPECT_EQ(response->responseCode(), ResponseCode::NoError);
+    EXPECT_EQ(response->dpaValue(), 0x40);
+    EXPECT_TRUE(response->isResponse());
+    EXPECT_TRUE(response->isSuccess());
+    EXPECT_FALSE(response->isConfirmation());
+    EXPECT_FALSE(response->isAsynchronous());
+
+    const ThermometerView thermometer(*response);
+    EXPECT_EQ(thermometer.celsius(), 23);
+    EXPECT_EQ(thermometer.sixteenths(), 0x170);
+
+    const std::vector<uint8_t> async = {0x01, 0x00, 0x20, 0x80, 0xff, 0xff, 0x80, 0x00};
+    EXPECT_TRUE(DpaResponseView(async).isAsynchronous());
+    const std::vector<uint8_t> error = {0x01, 0x00, 0x06, 0x83, 0xff, 0xff, 0x03, 0x00};
+    EXPECT_EQ(DpaResponseView(error).responseCode(), ResponseCode::ErrorPnum);
+    EXPECT_THROW(ThermometerView{DpaResponseView(error)}, std::invalid_argument);
+
+    // Requests are not responses
+    EXPECT_EQ(DpaResponseView::tryParse(std::vector<uint8_t>({0x01, 0x00, 0x06, 0x03, 0xff, 0xff, 0x00, 0x00})),
+        std::nullopt);
+}
+
+TEST(DpaFrameTest, confirmationView) {
+    const std::vector<uint8_t> frame = {0x01, 0x00, 0x06, 0x03, 0xff, 0xff, 0xff, 0x40, 0x01, 0x06, 0x02};
+    const auto confirmation = DpaResponseView::tryParse(frame);
+    ASSERT_TRUE(confirmation.has_value());
+    EXPECT_TRUE(confirmation->isConfirmation());
+    EXPECT_EQ(confirmation->responseCode(), ResponseCode::StatusConfirmation);
+    EXPECT_EQ(confirmation->hops(), 1);
+    EXPECT_EQ(confirmation->timeslot(), 6);
+    EXPECT_EQ(confirmation->hopsResponse(), 2);
+    EXPECT_TRUE(confirmation->pdata().empty());
+
+    // Confirmation has a fixed length
+    EXPECT_EQ(DpaResponseView::tryParse(std::vector<uint8_t>(frame.begin(), frame.begin() + 8)), std::nullopt);
+}
+
+TEST(DpaFrameTest, builders) {
+    EXPECT_EQ(LedrPulse::toVector(0x0001), std::vector<uint8_t>({0x01, 0x00, 0x06, 0x03, 0xff, 0xff}));
+    EXPECT_EQ(LedgSetOn::toVector(0x0000, {}, 0x1234), std::vector<uint8_t>({0x00, 0x00, 0x07, 0x01, 0x34, 0x12}));
+    EXPECT_EQ(
+        IoSet<1>::toVector(0x0002, {0x00, 0x01, 0x01}),
+        std::vector<uint8_t>({0x02, 0x00, 0x09, 0x01, 0xff, 0xff, 0x00, 0x01, 0x01})
+    );
+
+    uint8_t buffer[8] = {};
+    EXPECT_EQ(OsRead::serialize(buffer, sizeof(buffer), 0x0003), 6);
+    EXPECT_EQ(buffer[PNUM_OFFSET], pnum::OS);
+    EXPECT_THROW(OsRead::serialize(buffer, 4, 0x0003), std::length_error);
+}
+
+TEST(DpaFrameTest, osBatch) {
+    const auto ledr = LedrPulse::build(0x0001);
+    const auto io = IoSet<1>::build(0x0001, {0x00, 0x01, 0x01});
+
+    OsBatchBuilder<16> builder(0x0001);
+    EXPECT_TRUE(builder.add(DpaRequestView(ByteView(ledr.data(), ledr.size()))));
+    EXPECT_TRUE(builder.add(DpaRequestView(ByteView(io.data(), io.size()))));
+    EXPECT_FALSE(builder.add(DpaRequestView(ByteView(ledr.data(), ledr.size()))));
+    EXPECT_EQ(builder.size(), 2);
+    EXPECT_EQ(builder.bytes().toVector(), std::vector<uint8_t>({
+        0x01, 0x00, 0x02, 0x05, 0xff, 0xff,
+        0x05, 0x06, 0x03, 0xff, 0xff,
+        0x08, 0x09, 0x01, 0xff, 0xff, 0x00, 0x01, 0x01,
+        0x00
+    }));
+
+    const DpaRequestView request(builder.bytes());
+    const OsBatchView batch(request);
+    ASSERT_EQ(batch.size(), 2);
+    auto it = batch.begin();
+    EXPECT_EQ(it->pnum, pnum::LEDR);
+    EXPECT_EQ(it->pcmd, pcmd::LED_PULSE);
+    EXPECT_TRUE(it->pdata.empty());
+    ++it;
+    EXPECT_EQ(it->pnum, pnum::IO);
+    const IoTripletsView triplets(DpaRequestView(ByteView(io.data(), io.size())));
+    ASSERT_EQ(triplets.size(), 1);
+    EXPECT_EQ(triplets.at(0).mask, 0x01);
+    EXPECT_EQ(it->pdata.size(), 3);
+    ++it;
+    EXPECT_EQ(it, batch.end());
+
+    const std::vector<uint8_t> malformed = {0x01, 0x00, 0x02, 0x05, 0xff, 0xff, 0x09, 0x06, 0x03, 0x00};
+    EXPECT_THROW(OsBatchView{DpaRequestView(malformed)}, std::invalid_argument);
+    EXPECT_THROW(OsBatchView{DpaRequestView(ByteView(ledr.data(), ledr.size()))}, std::invalid_argument);
+}
+
+}  // namespace iqrf::connector::dpa
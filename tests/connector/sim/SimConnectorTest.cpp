@@ -0,0 +1,215 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: SimConnectorTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-16
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#if IQRF_TESTING_SUPPORT
+#include "iqrf/connector/dpa/DpaBuilder.h"
+#include "iqrf/connector/dpa/DpaFrame.h"
+#include "iqrf/connector/sim/SimConnector.h"
+#endif
+
+namespace iqrf::connector::sim {
+
+#if IQRF_TESTING_SUPPORT
+using std::chrono::milliseconds;
+
+class SimConnectorTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates the simulated network.
+     * @param config Simulated network configuration
+     */
+    void start(const SimConfig &config) {
+        this->sim = std::make_unique<SimConnector>(config);
+        this->token = std::make_unique<AccessToken>(this->sim->registerResponseHandler(
+            [](const std::vector<uint8_t> &) { return 0; }, AccessType::Normal
+        ));
+    }
+
+    /**
+     * Sends the request and receives the messages until the response or the network is idle.
+     * @param request DPA request
+     * @return DPA response or std::nullopt if the response is lost
+     */
+    std::optional<std::vector<uint8_t>> transact(const std::vector<uint8_t> &request) {
+        this->sim->send(request, *this->token);
+        while (true) {
+            const auto message = this->sim->receive();
+            if (message.empty()) {
+                return std::nullopt;
+            }
+            const auto response = dpa::DpaResponseView::tryParse(message);
+            if (response.has_value() && !response->isConfirmation()) {
+                return message;
+            }
+        }
+    }
+
+    /// Simulated network
+    std::unique_ptr<SimConnector> sim;
+    /// Access token of the test
+    std::unique_ptr<AccessToken> token;
+};
+
+TEST_F(SimConnectorTest, confirmationAndResponseTiming) {
+    SimConfig config;
+    config.nodeCount = 40;
+    config.nodesPerHop = 10;
+    start(config);
+
+    sim->send(dpa::LedrPulse::toVector(25), *token);
+    const std::vector<uint8_t> confirmed = sim->receive();
+    const auto confirmation = dpa::DpaResponseView(confirmed);
+    ASSERT_TRUE(confirmation.isConfirmation());
+    EXPECT_EQ(confirmation.hops(), 3);
+    EXPECT_EQ(confirmation.timeslot(), 4);
+    EXPECT_EQ(confirmation.hopsResponse(), 3);
+    EXPECT_EQ(sim->now(), milliseconds(5));
+
+    const std::vector<uint8_t> message = sim->receive();
+    const auto response = dpa::DpaResponseView(message);
+    EXPECT_EQ(response.nadr(), 25);
+    EXPECT_TRUE(response.isSuccess());
+    // Request and response routed over 3 hops in 40 ms timeslots
+    EXPECT_EQ(sim->now(), milliseconds(5 + 4 * 40 + 4 * 40));
+    EXPECT_TRUE(sim->receive().empty());
+
+    // The next request waits for the previous one
+    sim->send(dpa::LedrPulse::toVector(1), *token);
+    sim->receive();
+    EXPECT_EQ(sim->now(), milliseconds(330));
+    EXPECT_EQ(sim->getStats().confirmations, 2);
+}
+
+TEST_F(SimConnectorTest, peripherals) {
+    start(SimConfig());
+
+    EXPECT_TRUE(transact(dpa::LedgSetOn::toVector(2)).has_value());
+    EXPECT_TRUE(sim->getNode(2).ledg);
+
+    const std::vector<uint8_t> write = {0x02, 0x00, dpa::pnum::RAM, dpa::pcmd::MEMORY_WRITE, 0xff, 0xff, 0x04, 0xaa, 0xbb};
+    EXPECT_TRUE(dpa::DpaResponseView(*transact(write)).isSuccess());
+    const std::vector<uint8_t> read = {0x02, 0x00, dpa::pnum::RAM, dpa::pcmd::MEMORY_READ, 0xff, 0xff, 0x04, 0x02};
+    const auto data = transact(read);
+    EXPECT_EQ(dpa::DpaResponseView(*data).pdata().toVector(), std::vector<uint8_t>({0xaa, 0xbb}));
+    const std::vector<uint8_t> outside = {0x02, 0x00, dpa::pnum::RAM, dpa::pcmd::MEMORY_READ, 0xff, 0xff, 0x2f, 0x02};
+    EXPECT_EQ(dpa::DpaResponseView(*transact(outside)).responseCode(), dpa::ResponseCode::ErrorAddress);
+
+    sim->updateNode(3, [](SimNode &node) { node.temperature = -5; });
+    const auto temperature = transact(dpa::ThermometerRead::toVector(3));
+    EXPECT_EQ(static_cast<int8_t>(dpa::DpaResponseView(*temperature).pdata()[0]), -5);
+
+    EXPECT_EQ(
+        dpa::DpaResponseView(*transact({0x02, 0x00, 0x30, 0x00, 0xff, 0xff})).responseCode(),
+        dpa::ResponseCode::ErrorPnum
+    );
+    EXPECT_EQ(
+        dpa::DpaResponseView(*transact(dpa::LedrPulse::toVector(2, {}, 0x1234))).responseCode(),
+        dpa::ResponseCode::ErrorHwpid
+    );
+    // Node 20 is not bonded
+    EXPECT_EQ(
+        dpa::DpaResponseView(*transact(dpa::LedrPulse::toVector(20))).responseCode(),
+        dpa::ResponseCode::ErrorNadr
+    );
+
+    const std::vector<uint8_t> bonded = {0x00, 0x00, dpa::pnum::COORDINATOR, dpa::pcmd::COORDINATOR_BONDED_DEVICES, 0xff, 0xff};
+    const auto devices = transact(bonded);
+    const auto bitmap = dpa::DpaResponseView(*devices).pdata();
+    ASSERT_EQ(bitmap.size(), 32);
+    EXPECT_EQ(bitmap[0], 0xfe);
+    EXPECT_EQ(bitmap[1], 0x07);
+    EXPECT_THROW(sim->send({0x01}, *token), std::invalid_argument);
+}
+
+TEST_F(SimConnectorTest, frcPing) {
+    SimConfig config;
+    config.nodeCount = 100;
+    start(config);
+    sim->updateNode(7, [](SimNode &node) { node.linkLoss = 1.0; });
+
+    const std::vector<uint8_t> ping = {0x00, 0x00, dpa::pnum::FRC, dpa::pcmd::FRC_SEND, 0xff, 0xff, dpa::frc::PING};
+    const auto response = transact(ping);
+    ASSERT_TRUE(response.has_value());
+    const auto pdata = dpa::DpaResponseView(*response).pdata();
+    EXPECT_EQ(pdata[0], 99);
+    EXPECT_EQ(pdata[1], 0x7e);
+    EXPECT_EQ(pdata[1 + 12], 0x1f);
+    EXPECT_EQ(sim->getStats().frcRounds, 1);
+    // 100 slots of 10 ms and the distribution over 7 hops
+    EXPECT_EQ(sim->now(), milliseconds(5 + 100 * 10 + 2 * 8 * 40));
+}
+
+TEST_F(SimConnectorTest, lossIsDeterministic) {
+    SimConfig config;
+    config.nodeCount = 50;
+    config.nodesPerHop = 5;
+    config.linkLoss = 0.05;
+    config.seed = 42;
+
+    std::vector<bool> first;
+    start(config);
+    for (uint16_t address = 1; address <= 50; ++address) {
+        first.push_back(transact(dpa::OsRead::toVector(address)).has_value());
+    }
+    const SimStats stats = sim->getStats();
+    EXPECT_GT(stats.lostRequests + stats.lostResponses, 0);
+    EXPECT_EQ(stats.responses + stats.lostRequests + stats.lostResponses, 50);
+
+    std::vector<bool> second;
+    start(config);
+    for (uint16_t address = 1; address <= 50; ++address) {
+        second.push_back(transact(dpa::OsRead::toVector(address)).has_value());
+    }
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(SimConnectorTest, hourOfPollingOnVirtualTime) {
+    SimConfig config;
+    config.nodeCount = dpa::MAX_NODE_ADDRESS;
+    start(config);
+
+    // Every node is read once per minute for an hour
+    const auto wallStart = std::chrono::steady_clock::now();
+    uint64_t responses = 0;
+    for (int minute = 0; minute < 60; ++minute) {
+        for (uint16_t address = 1; address <= dpa::MAX_NODE_ADDRESS; ++address) {
+            responses += transact(dpa::ThermometerRead::toVector(address)).has_value();
+        }
+        const auto nextMinute = milliseconds(60000) * (minute + 1);
+        if (sim->now() < nextMinute) {
+            sim->advance(nextMinute - sim->now());
+        }
+    }
+    EXPECT_EQ(responses, 60 * dpa::MAX_NODE_ADDRESS);
+    EXPECT_GE(sim->now(), std::chrono::hours(1));
+    EXPECT_LT(std::chrono::steady_clock::now() - wallStart, std::chrono::seconds(30));
+}
+
+TEST_F(SimConnectorTest, invalidConfig) {
+    SimConfig config;
+    config.nodeCount = 240;
+    EXPECT_THROW(SimConnector{config}, std::invalid_argument);
+    config.nodeCount = 10;
+    config.linkLoss = 1.5;
+    EXPECT_THROW(SimConnector{config}, std::invalid_argument);
+}
+#endif
+
+}  // namespace iqrf::connector::sim
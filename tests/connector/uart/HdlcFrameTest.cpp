@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <vector>
@@ -121,6 +122,18 @@ TEST_F(HdlcFrameTest, getData) {
     EXPECT_THROW(frame.getData(), std::logic_error);
 }
 
+TEST_F(HdlcFrameTest, isComplete) {
+    for (const auto& [rawData, encodedData] : testData) {
+        HdlcFrame frame;
+        EXPECT_FALSE(frame.isComplete());
+        for (std::size_t i = 0; i < encodedData.size(); ++i) {
+            EXPECT_FALSE(frame.isComplete());
+            frame.decodeByte(encodedData[i]);
+        }
+        EXPECT_TRUE(frame.isComplete());
+    }
+}
+
 TEST_F(HdlcFrameTest, calculateCrc) {
     const std::map<uint8_t, std::vector<uint8_t>> values = {
         {
@@ -0,0 +1,137 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: UartBringUpTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-19
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "iqrf/connector/Clock.h"
+#include "iqrf/connector/uart/UartBringUp.h"
+
+namespace iqrf::connector::uart {
+
+#if IQRF_TESTING_SUPPORT
+class UartBringUpTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates a mock GPIO line
+     * @param line GPIO line offset
+     * @return Mock GPIO line
+     */
+    static Gpio createGpio(const std::size_t line) {
+        gpio::GpioConfig config("gpiochip0", line, "test:" + std::to_string(line));
+        config.use_mock = true;
+        return Gpio(config);
+    }
+
+    /**
+     * Creates the configuration of a module with its own power and UART enable
+     * @param device UART device name
+     * @param power Power enable line offset
+     * @param busEnable Bus enable line offset
+     * @return UART connector configuration
+     */
+    static UartConfig module(const std::string &device, const std::size_t power, const std::size_t busEnable) {
+        UartConfig config(device);
+        config.powerEnableGpio = createGpio(power);
+        config.busEnableGpio = createGpio(busEnable);
+        return config;
+    }
+
+    /**
+     * Counts the steps of the action
+     * @param plan GPIO bring-up sequence
+     * @param action Step action
+     * @return Number of the steps
+     */
+    static std::size_t count(const std::vector<GpioStep> &plan, const GpioAction action) {
+        std::size_t result = 0;
+        for (const auto &step : plan) {
+            result += step.action == action;
+        }
+        return result;
+    }
+
+    /// Clock advanced by the sleeps
+    std::shared_ptr<VirtualClock> clock = std::make_shared<VirtualClock>(true);
+};
+
+TEST_F(UartBringUpTest, sharedLinesAreInitializedOnce) {
+    UartConfig first = module("/dev/ttyS0", 1, 10);
+    UartConfig second = module("/dev/ttyS1", 2, 10);
+    second.powerUp.resetHold = std::chrono::milliseconds(400);
+    UartBringUp bringUp({first, second}, clock);
+
+    const auto &plan = bringUp.getPlan();
+    // Two power lines and one shared bus enable
+    EXPECT_EQ(count(plan, GpioAction::InitOutput), 3);
+    EXPECT_EQ(count(plan, GpioAction::SetValue), 5);
+    EXPECT_EQ(count(plan, GpioAction::Wait), 2);
+
+    const auto &configs = bringUp.getConfigs();
+    EXPECT_TRUE(configs[0].gpioPrepared);
+    EXPECT_EQ(configs[1].busEnableGpio->getConfig().consumer_name, "test:10");
+
+    bringUp.prepareGpio();
+    // Both modules power cycled at once, the longest hold
+    EXPECT_EQ(clock->getSlept(), std::chrono::milliseconds(401));
+    EXPECT_TRUE(configs[0].powerEnableGpio->getValue());
+    EXPECT_TRUE(configs[1].powerEnableGpio->getValue());
+    EXPECT_TRUE(configs[0].busEnableGpio->getValue());
+}
+
+TEST_F(UartBringUpTest, separateBusEnables) {
+    UartConfig first("/dev/ttyS0");
+    first.uartEnableGpio = createGpio(20);
+    first.spiEnableGpio = createGpio(21);
+    first.trModuleReset = false;
+    UartConfig second("/dev/ttyS1");
+    // UART enable of the first module enables all buses of the second one
+    second.busEnableGpio = createGpio(20);
+    second.pgmSwitchGpio = createGpio(21);
+    second.trReadyGpio = createGpio(22);
+    UartBringUp bringUp({first, second}, clock);
+
+    const auto &plan = bringUp.getPlan();
+    EXPECT_EQ(count(plan, GpioAction::InitOutput), 2);
+    EXPECT_EQ(count(plan, GpioAction::InitInput), 1);
+    bringUp.prepareGpio();
+    EXPECT_EQ(clock->getSlept(), std::chrono::milliseconds(1));
+    EXPECT_TRUE(bringUp.getConfigs()[1].busEnableGpio->getValue());
+    EXPECT_FALSE(bringUp.getConfigs()[1].pgmSwitchGpio->getValue());
+}
+
+TEST_F(UartBringUpTest, conflictingRoles) {
+    UartConfig first = module("/dev/ttyS0", 1, 10);
+    UartConfig second = module("/dev/ttyS1", 10, 11);
+    EXPECT_THROW(UartBringUp({first, second}, clock), std::invalid_argument);
+
+    UartConfig uart("/dev/ttyS0");
+    uart.uartEnableGpio = createGpio(20);
+    UartConfig spi("/dev/ttyS1");
+    spi.spiEnableGpio = createGpio(20);
+    EXPECT_THROW(UartBringUp({uart, spi}, clock), std::invalid_argument);
+}
+
+TEST_F(UartBringUpTest, noGpio) {
+    UartBringUp bringUp({UartConfig("/dev/ttyS0")}, clock);
+    EXPECT_TRUE(bringUp.getPlan().empty());
+    bringUp.prepareGpio();
+    EXPECT_EQ(clock->getSleeps(), 0);
+}
+#endif
+
+}  // namespace iqrf::connector::uart
@@ -0,0 +1,61 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: BasicGpioTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-23
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <type_traits>
+
+#include "iqrf/gpio/BasicGpio.h"
+
+namespace iqrf::gpio {
+
+#if defined(__linux__) || defined(__FreeBSD__)
+static_assert(std::is_final_v<NativeGpio::BackendType>);
+#endif
+
+#if IQRF_TESTING_SUPPORT
+class BasicGpioTest : public ::testing::Test {
+ protected:
+    /// GPIO configuration
+    GpioConfig config = GpioConfig("gpiochip0", 1, "test:basic");
+};
+
+TEST_F(BasicGpioTest, output) {
+    BasicGpio<GpioMock> gpio(this->config);
+    gpio.initOutput(true);
+    EXPECT_EQ(gpio.getDirection(), GpioDirection::Output);
+    EXPECT_TRUE(gpio.getValue());
+    gpio.setValue(false);
+    EXPECT_FALSE(gpio.getValue());
+    EXPECT_EQ(gpio.getConfig().consumer_name, "test:basic");
+}
+
+TEST_F(BasicGpioTest, copiesShareDriver) {
+    BasicGpio<GpioMock> gpio(this->config);
+    const auto copy = gpio;
+    gpio.initInput();
+    gpio.getBackend().setInputValue(true);
+    EXPECT_TRUE(copy.getValue());
+    EXPECT_EQ(&gpio.getBackend(), &copy.getBackend());
+}
+
+TEST_F(BasicGpioTest, edgeEvents) {
+    BasicGpio<GpioMock> gpio(this->config);
+    gpio.initEdgeInput();
+    gpio.getBackend().injectEvent(GpioEdge::Falling, std::chrono::milliseconds(1));
+    const auto event = gpio.waitEvent(std::chrono::nanoseconds(0));
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->edge, GpioEdge::Falling);
+}
+#endif
+
+}  // namespace iqrf::gpio
@@ -0,0 +1,89 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: ChipRegistryTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-21
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "iqrf/gpio/ChipRegistry.h"
+
+namespace iqrf::gpio {
+
+/**
+ * Fake GPIO chip handle
+ */
+struct FakeChip {
+    /// Chip name
+    std::string name;
+};
+
+class ChipRegistryTest : public ::testing::Test {
+ protected:
+    /**
+     * Returns the opener of the fake chip counting the opened chips
+     * @param name Chip name
+     * @return Chip opener
+     */
+    ChipRegistry<FakeChip>::Opener opener(const std::string& name) {
+        return [this, name]() {
+            this->opened++;
+            return std::make_shared<FakeChip>(FakeChip{name});
+        };
+    }
+
+    /// Chip registry
+    ChipRegistry<FakeChip> registry;
+    /// Number of opened chips
+    int opened = 0;
+};
+
+TEST_F(ChipRegistryTest, sharedWhileAlive) {
+    auto first = registry.acquire("gpiochip0", opener("gpiochip0"));
+    auto second = registry.acquire("gpiochip0", opener("gpiochip0"));
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(opened, 1);
+    EXPECT_EQ(registry.size(), 1);
+
+    auto other = registry.acquire("gpiochip1", opener("gpiochip1"));
+    EXPECT_NE(first, other);
+    EXPECT_EQ(other->name, "gpiochip1");
+    EXPECT_EQ(registry.size(), 2);
+
+    const auto stats = registry.getStats();
+    EXPECT_EQ(stats.opened, 2);
+    EXPECT_EQ(stats.reused, 1);
+}
+
+TEST_F(ChipRegistryTest, reopenedAfterRelease) {
+    auto chip = registry.acquire("gpiochip0", opener("gpiochip0"));
+    auto copy = chip;
+    chip.reset();
+    EXPECT_EQ(registry.size(), 1);
+    copy.reset();
+    EXPECT_EQ(registry.size(), 0);
+
+    chip = registry.acquire("gpiochip0", opener("gpiochip0"));
+    EXPECT_EQ(opened, 2);
+    EXPECT_EQ(registry.getStats().reused, 0);
+}
+
+TEST_F(ChipRegistryTest, openFailure) {
+    auto failing = []() -> std::shared_ptr<FakeChip> {
+        throw std::runtime_error("No GPIO chip 'gpiochip9' found");
+    };
+    EXPECT_THROW(registry.acquire("gpiochip9", failing), std::runtime_error);
+    EXPECT_EQ(registry.size(), 0);
+    EXPECT_EQ(registry.getStats().opened, 0);
+}
+
+}  // namespace iqrf::gpio
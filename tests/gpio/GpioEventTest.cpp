@@ -0,0 +1,115 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioEventTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-22
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <poll.h>
+
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include "iqrf/gpio/Gpio.h"
+#include "iqrf/gpio/Config.h"
+
+namespace iqrf::gpio {
+
+#if IQRF_TESTING_SUPPORT
+class GpioEventTest : public ::testing::Test {
+ protected:
+    /**
+     * Set up the test environment.
+     */
+    void SetUp() override {
+        this->config.use_mock = true;
+    }
+
+    /// GPIO configuration
+    GpioConfig config = GpioConfig("gpiochip0", 1, "test:event");
+};
+
+TEST_F(GpioEventTest, bothEdges) {
+    Gpio gpio(this->config);
+    gpio.initEdgeInput();
+    gpio.injectEvent(GpioEdge::Rising, std::chrono::milliseconds(1));
+    EXPECT_TRUE(gpio.getValue());
+    gpio.injectEvent(GpioEdge::Falling, std::chrono::milliseconds(2));
+    EXPECT_FALSE(gpio.getValue());
+
+    auto event = gpio.waitEvent(std::chrono::nanoseconds(0));
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->edge, GpioEdge::Rising);
+    EXPECT_EQ(event->timestamp, std::chrono::milliseconds(1));
+    event = gpio.waitEvent(std::chrono::nanoseconds(0));
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->edge, GpioEdge::Falling);
+    EXPECT_FALSE(gpio.waitEvent(std::chrono::milliseconds(1)).has_value());
+}
+
+TEST_F(GpioEventTest, edgeFilterAndDebounce) {
+    Gpio gpio(this->config);
+    GpioEventConfig eventConfig;
+    eventConfig.edge = GpioEdge::Falling;
+    eventConfig.debounce = std::chrono::milliseconds(5);
+    gpio.initEdgeInput(eventConfig);
+
+    gpio.injectEvent(GpioEdge::Falling, std::chrono::milliseconds(10));
+    // Rising edge is not detected, the falling one is a bounce
+    gpio.injectEvent(GpioEdge::Rising, std::chrono::milliseconds(11));
+    gpio.injectEvent(GpioEdge::Falling, std::chrono::milliseconds(12));
+    gpio.injectEvent(GpioEdge::Falling, std::chrono::milliseconds(20));
+
+    auto event = gpio.waitEvent(std::chrono::nanoseconds(0));
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->timestamp, std::chrono::milliseconds(10));
+    event = gpio.waitEvent(std::chrono::nanoseconds(0));
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->timestamp, std::chrono::milliseconds(20));
+    EXPECT_FALSE(gpio.waitEvent(std::chrono::nanoseconds(0)).has_value());
+}
+
+TEST_F(GpioEventTest, blockingWait) {
+    Gpio gpio(this->config);
+    gpio.initEdgeInput();
+    std::thread injector([&gpio]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        gpio.injectEvent(GpioEdge::Rising);
+    });
+    const auto event = gpio.waitEvent();
+    injector.join();
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->edge, GpioEdge::Rising);
+}
+
+TEST_F(GpioEventTest, eventFd) {
+    Gpio gpio(this->config);
+    gpio.initEdgeInput();
+    struct pollfd pfd = {gpio.getEventFd(), POLLIN, 0};
+    EXPECT_EQ(poll(&pfd, 1, 0), 0);
+
+    gpio.injectEvent(GpioEdge::Rising);
+    EXPECT_EQ(poll(&pfd, 1, 0), 1);
+    EXPECT_TRUE(gpio.waitEvent(std::chrono::nanoseconds(0)).has_value());
+    EXPECT_EQ(poll(&pfd, 1, 0), 0);
+}
+
+TEST_F(GpioEventTest, notInitialized) {
+    Gpio gpio(this->config);
+    EXPECT_THROW(gpio.injectEvent(GpioEdge::Rising), std::runtime_error);
+    gpio.initInput();
+    EXPECT_THROW((void)gpio.waitEvent(std::chrono::nanoseconds(0)), std::runtime_error);
+    gpio.initEdgeInput();
+    EXPECT_THROW(gpio.injectEvent(GpioEdge::Both), std::invalid_argument);
+}
+#endif
+
+}  // namespace iqrf::gpio
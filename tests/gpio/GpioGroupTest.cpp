@@ -0,0 +1,87 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioGroupTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-20
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "iqrf/gpio/GpioGroup.h"
+
+namespace iqrf::gpio {
+
+#if IQRF_TESTING_SUPPORT
+class GpioGroupTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates mock GPIO lines recording their value changes
+     * @param count Number of lines
+     * @return Mock GPIO lines
+     */
+    std::vector<Gpio> createLines(const std::size_t count) {
+        std::vector<Gpio> lines;
+        for (std::size_t i = 0; i < count; ++i) {
+            GpioConfig config("gpiochip0", i, "line" + std::to_string(i));
+            config.use_mock = true;
+            Gpio gpio(config);
+            gpio.registerValueCallback([this, i](bool, bool newValue) {
+                this->changes.emplace_back(i, newValue);
+            });
+            lines.push_back(gpio);
+        }
+        return lines;
+    }
+
+    /// Value changes of the lines
+    std::vector<std::pair<std::size_t, bool>> changes;
+};
+
+TEST_F(GpioGroupTest, initAndValues) {
+    GpioGroup group(createLines(3));
+    EXPECT_EQ(group.size(), 3);
+    group.initOutput(0b101);
+    // Mock lines are switched one by one
+    EXPECT_FALSE(group.isAtomic());
+    EXPECT_EQ(group.getValues(), 0b101);
+    EXPECT_EQ(group.getLines()[1].getDirection(), GpioDirection::Output);
+
+    group.setValues(0b010);
+    EXPECT_EQ(group.getValues(), 0b010);
+    group.setValues(0b001, 0b011);
+    EXPECT_EQ(group.getValues(), 0b001);
+}
+
+TEST_F(GpioGroupTest, breakBeforeMake) {
+    GpioGroup group(createLines(3));
+    group.initOutput(0b100);
+    group.setValues(0b001);
+    ASSERT_EQ(changes.size(), 2);
+    EXPECT_EQ(changes[0], std::make_pair(std::size_t{2}, false));
+    EXPECT_EQ(changes[1], std::make_pair(std::size_t{0}, true));
+}
+
+TEST_F(GpioGroupTest, inputs) {
+    GpioGroup group(createLines(2));
+    group.initInput();
+    group.getLines()[1].setInputValue(true);
+    EXPECT_EQ(group.getValues(), 0b10);
+}
+
+TEST_F(GpioGroupTest, invalidSize) {
+    EXPECT_THROW(GpioGroup({}), std::invalid_argument);
+    EXPECT_THROW(GpioGroup(createLines(GpioGroup::MAX_LINES + 1)), std::invalid_argument);
+}
+#endif
+
+}  // namespace iqrf::gpio
@@ -0,0 +1,116 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioMapTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-24
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "iqrf/gpio/GpioMap.h"
+
+namespace iqrf::gpio {
+
+class GpioMapTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates the map of the test chips counting the opened chips
+     * @return GPIO map
+     */
+    GpioMap createMap() {
+        return GpioMap(
+            [this]() {
+                this->listed++;
+                return std::vector<std::string>{"gpiochip0", "gpiochip1", "gpiochip2", "gpiochip3"};
+            },
+            [this](const std::string& name) -> std::size_t {
+                this->counted.push_back(name);
+                if (name == "gpiochip2") {
+                    throw std::runtime_error("Failed to open " + name);
+                }
+                return this->lineCounts.at(name);
+            },
+            [this](const std::string& name) {
+                this->named[name]++;
+                return std::vector<std::string>{"", "TR_RESET", "TR_PGM", "TR_RESET"};
+            });
+    }
+
+    /// Line counts of the chips
+    std::map<std::string, std::size_t> lineCounts = {{"gpiochip0", 8}, {"gpiochip1", 4}, {"gpiochip3", 16}};
+    /// Number of chip listings
+    int listed = 0;
+    /// Chips whose lines have been counted
+    std::vector<std::string> counted;
+    /// Number of line name listings by the chip
+    std::map<std::string, int> named;
+};
+
+TEST_F(GpioMapTest, lazyEnumeration) {
+    const GpioMap map = this->createMap();
+    EXPECT_EQ(listed, 0);
+
+    auto record = map.findPin(3);
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->chip, "gpiochip0");
+    EXPECT_EQ(record->line, 3);
+    EXPECT_EQ(map.getLoadedChipCount(), 1);
+
+    record = map.findPin(11);
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->chip, "gpiochip1");
+    EXPECT_EQ(record->line, 3);
+    EXPECT_EQ(counted, (std::vector<std::string>{"gpiochip0", "gpiochip1"}));
+    EXPECT_EQ(listed, 1);
+}
+
+TEST_F(GpioMapTest, failedChipSkipped) {
+    const GpioMap map = this->createMap();
+    auto record = map.findPin(12);
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->chip, "gpiochip3");
+    EXPECT_EQ(record->line, 0);
+    record = map.findPin(27);
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->line, 15);
+    EXPECT_FALSE(map.findPin(28).has_value());
+
+    const auto chips = map.getChips();
+    ASSERT_EQ(chips.size(), 3);
+    EXPECT_EQ(chips[2].name, "gpiochip3");
+    EXPECT_EQ(chips[2].firstPin, 12);
+    EXPECT_EQ(chips[2].lineCount, 16);
+}
+
+TEST_F(GpioMapTest, lineNameIndex) {
+    const GpioMap map = this->createMap();
+    EXPECT_EQ(map.findLine("gpiochip1", "TR_PGM"), 2);
+    // The first line of a duplicate name
+    EXPECT_EQ(map.findLine("gpiochip1", "TR_RESET"), 1);
+    EXPECT_FALSE(map.findLine("gpiochip1", "LED").has_value());
+    EXPECT_FALSE(map.findLine("gpiochip1", "").has_value());
+    EXPECT_EQ(named["gpiochip1"], 1);
+    // Line names do not open the chips for the pin lookup
+    EXPECT_EQ(map.getLoadedChipCount(), 0);
+}
+
+TEST_F(GpioMapTest, fixedTable) {
+    const GpioMap map({{"gpiochip0", 2}, {"gpiochip1", 3}});
+    const GpioMap copy(map);
+    EXPECT_EQ(copy.findPin(4)->chip, "gpiochip1");
+    EXPECT_EQ(copy.findPin(4)->line, 2);
+    EXPECT_FALSE(copy.findPin(5).has_value());
+    EXPECT_FALSE(copy.findLine("gpiochip0", "TR_RESET").has_value());
+}
+
+}  // namespace iqrf::gpio
@@ -11,7 +11,11 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "iqrf/gpio/Gpio.h"
 #include "iqrf/gpio/Config.h"
@@ -82,6 +86,8 @@ TEST_F(GpioMockTest, swap) {
 
     EXPECT_EQ(gpio1.impl, expected1);
     EXPECT_EQ(gpio2.impl, expected2);
+    EXPECT_EQ(gpio1.getConfig().line, 2);
+    EXPECT_EQ(gpio2.getConfig().consumer_name, "test:mock");
 }
 
 TEST_F(GpioMockTest, uninitializedGpio) {
@@ -164,4 +170,111 @@ TEST_F(GpioMockTest, registerValueCallback) {
     EXPECT_EQ(newValue, false);
 }
 
+#if IQRF_TESTING_SUPPORT
+TEST_F(GpioMockTest, multipleCallbacks) {
+    Gpio gpio(this->config);
+    int first = 0;
+    int second = 0;
+    const auto id = gpio.registerValueCallback([&first](bool, bool) { first++; });
+    gpio.registerValueCallback([&second](bool, bool) { second++; });
+    gpio.initOutput(false);
+    gpio.setValue(true);
+    gpio.getMock()->unregisterCallback(id);
+    gpio.setValue(false);
+    EXPECT_EQ(first, 1);
+    EXPECT_EQ(second, 2);
+}
+
+TEST_F(GpioMockTest, timeline) {
+    Gpio gpio(this->config);
+    std::chrono::nanoseconds time{100};
+    gpio.getMock()->setClock({[&time] { return time; }, nullptr});
+    gpio.initOutput(false);
+    time += std::chrono::nanoseconds(50);
+    gpio.setValue(true);
+    // Writes not changing the value are not recorded
+    gpio.setValue(true);
+    time += std::chrono::nanoseconds(50);
+    gpio.setDirection(GpioDirection::Input);
+    const auto timeline = gpio.getMock()->getTimeline();
+    ASSERT_EQ(timeline.size(), 3);
+    EXPECT_EQ(timeline[0].timestamp.count(), 100);
+    EXPECT_FALSE(timeline[0].value);
+    EXPECT_EQ(timeline[1].timestamp.count(), 150);
+    EXPECT_TRUE(timeline[1].value);
+    EXPECT_EQ(timeline[2].direction, GpioDirection::Input);
+    gpio.getMock()->clearTimeline();
+    EXPECT_TRUE(gpio.getMock()->getTimeline().empty());
+}
+
+TEST_F(GpioMockTest, latency) {
+    Gpio gpio(this->config);
+    std::chrono::nanoseconds time{0};
+    gpio.getMock()->setClock({
+        [&time] { return time; },
+        [&time](const std::chrono::nanoseconds deadline) { time = deadline; },
+    });
+    gpio.getMock()->setLatency({std::chrono::microseconds(3), std::chrono::microseconds(10)});
+    gpio.initOutput(false);
+    gpio.setValue(true);
+    EXPECT_TRUE(gpio.getValue());
+    EXPECT_EQ(time, std::chrono::microseconds(13));
+    // The line changes at the end of the write
+    EXPECT_EQ(gpio.getMock()->getTimeline().back().timestamp, std::chrono::microseconds(10));
+}
+
+TEST_F(GpioMockTest, playInput) {
+    using namespace std::chrono_literals;
+    Gpio gpio(this->config);
+    gpio.initEdgeInput(GpioEventConfig{GpioEdge::Rising});
+    const auto start = std::chrono::steady_clock::now().time_since_epoch();
+    auto done = gpio.getMock()->playInput({{1, 1, 1ms}, {0, 1, 1ms}, {1, 1, 0ms}});
+    // Consumed by another thread while the waveform is being played
+    std::vector<GpioEvent> events;
+    for (int i = 0; i < 2; ++i) {
+        const auto event = gpio.waitEvent(1s);
+        ASSERT_TRUE(event.has_value());
+        events.push_back(*event);
+    }
+    done.get();
+    EXPECT_EQ(events[0].edge, GpioEdge::Rising);
+    // The deadlines are relative to the start, the first edge may be late
+    EXPECT_GE(events[1].timestamp - start, 2ms);
+    EXPECT_TRUE(gpio.getValue());
+    EXPECT_EQ(gpio.getMock()->getTimeline().size(), 4);
+}
+
+TEST_F(GpioMockTest, setInputValueEdgeEvent) {
+    Gpio gpio(this->config);
+    gpio.initEdgeInput(GpioEventConfig{GpioEdge::Both});
+    gpio.setInputValue(true);
+    gpio.setInputValue(true);
+    const auto event = gpio.waitEvent(std::chrono::nanoseconds(0));
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->edge, GpioEdge::Rising);
+    EXPECT_FALSE(gpio.waitEvent(std::chrono::nanoseconds(0)).has_value());
+    EXPECT_TRUE(gpio.getValue());
+}
+
+TEST_F(GpioMockTest, concurrentAccess) {
+    Gpio gpio(this->config);
+    gpio.initOutput(false);
+    std::atomic<int> changes{0};
+    gpio.registerValueCallback([&changes](bool, bool) { changes++; });
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&gpio] {
+            for (int i = 0; i < 1000; ++i) {
+                gpio.setValue(i % 2 == 0);
+                (void)gpio.getValue();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(gpio.getMock()->getTimeline().size(), static_cast<std::size_t>(changes) + 1);
+}
+#endif
+
 }  // namespace iqrf::gpio
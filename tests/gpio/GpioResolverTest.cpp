@@ -11,10 +11,10 @@
 
 #include <gtest/gtest.h>
 
-#include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "iqrf/gpio/GpioResolver.h"
 
@@ -23,19 +23,12 @@ namespace iqrf::gpio {
 class GpioResolverTest : public ::testing::Test {
  protected:
     void SetUp() override {
-        GpioMap map;
-        std::shared_ptr<std::string> chip_name = std::make_shared<std::string>(chip0_name);
-        int64_t pin_num = 0;
-        for (size_t line_num = 0; line_num < chip0_num_lines; ++line_num) {
-            map.insert_or_assign(pin_num++, std::make_pair(chip_name, line_num));
-        }
+        std::vector<std::pair<std::string, size_t>> chips;
+        chips.emplace_back(chip0_name, chip0_num_lines);
 #if defined(__linux__)
-        chip_name = std::make_shared<std::string>(chip1_name);
-        for (size_t line_num = 0; line_num < chip1_num_lines; ++line_num) {
-            map.insert_or_assign(pin_num++, std::make_pair(chip_name, line_num));
-        }
+        chips.emplace_back(chip1_name, chip1_num_lines);
 #endif
-        this->resolver = GpioResolver::GetResolver(map);
+        this->resolver = GpioResolver::GetResolver(GpioMap(chips));
     }
 
     /// GPIO resolver instance
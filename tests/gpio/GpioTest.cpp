@@ -11,9 +11,12 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "iqrf/gpio/BasicGpio.h"
 #include "iqrf/gpio/Gpio.h"
 #include "iqrf/gpio/Config.h"
 
@@ -109,4 +112,90 @@ TEST_F(GpioTest, TestOutput_GPIO) {
 #endif
 }
 
+#if defined(__linux__)
+TEST_F(GpioTest, CachedLineState_GPIO) {
+    const iqrf::gpio::GpioConfig config("gpiochip0", 3, "libiqrf:test:cache");
+    const NativeGpio gpio(config);
+    // Not requested yet, the kernel is asked each time, the direction is left by the last consumer
+    const auto initialDirection = gpio.getDirection();
+    EXPECT_EQ(gpio.getDirection(), initialDirection);
+    gpio.initOutput(false);
+
+    gpio.setValue(false);
+    gpio.setValue(true);
+    gpio.setValue(true);
+    EXPECT_TRUE(gpio.getValue());
+    EXPECT_EQ(gpio.getDirection(), GpioDirection::Output);
+    gpio.setDirection(GpioDirection::Output);
+
+    const auto stats = gpio.getBackend().getStats();
+    EXPECT_EQ(stats.directionQueries, 2);
+    EXPECT_EQ(stats.directionHits, 1);
+    EXPECT_EQ(stats.valueHits, 1);
+    EXPECT_EQ(stats.writes, 1);
+    EXPECT_EQ(stats.skippedWrites, 3);
+}
+
+TEST_F(GpioTest, ExternalLineState_GPIO) {
+    const iqrf::gpio::GpioConfig config("gpiochip0", 4, "libiqrf:test:external");
+    const NativeGpio observer(config);
+    const NativeGpio owner(config);
+    // A released line keeps its direction, so the line is set to a known state first
+    owner.initInput();
+    EXPECT_EQ(observer.getDirection(), GpioDirection::Input);
+    owner.initOutput(true);
+    // The line requested by someone else is always queried
+    EXPECT_EQ(observer.getDirection(), GpioDirection::Output);
+    EXPECT_EQ(observer.getBackend().getStats().directionQueries, 2);
+}
+
+#if libgpiod_VERSION_MAJOR >= 2
+TEST_F(GpioTest, WatchedLineState_GPIO) {
+    const iqrf::gpio::GpioConfig config("gpiochip0", 5, "libiqrf:test:watch");
+    const NativeGpio observer(config);
+    auto owner = std::make_unique<NativeGpio>(config);
+    owner->initInput();
+
+    std::vector<GpioLineInfoEvent> changes;
+    auto& backend = observer.getBackend();
+    const auto id = backend.registerLineInfoCallback([&changes](const GpioLineInfoEvent& event) {
+        changes.push_back(event);
+    });
+    // The direction reported by the watch is cached until a change
+    EXPECT_EQ(observer.getDirection(), GpioDirection::Input);
+    EXPECT_EQ(observer.getDirection(), GpioDirection::Input);
+    EXPECT_EQ(backend.getStats().directionQueries, 0);
+    EXPECT_EQ(backend.getStats().directionHits, 2);
+
+    // Reconfigured by someone else, the change invalidates the cached direction
+    owner->setDirection(GpioDirection::Output);
+    EXPECT_EQ(backend.readLineInfoEvents(std::chrono::seconds(1)), 1);
+    EXPECT_EQ(observer.getDirection(), GpioDirection::Output);
+    EXPECT_EQ(observer.getDirection(), GpioDirection::Output);
+    const auto stats = backend.getStats();
+    EXPECT_EQ(stats.infoEvents, 1);
+    EXPECT_EQ(stats.directionQueries, 1);
+    EXPECT_EQ(stats.directionHits, 3);
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes[0].change, GpioLineChange::Reconfigured);
+    EXPECT_EQ(changes[0].direction, GpioDirection::Output);
+    EXPECT_TRUE(changes[0].used);
+
+    owner.reset();
+    EXPECT_EQ(backend.readLineInfoEvents(std::chrono::seconds(1)), 1);
+    ASSERT_EQ(changes.size(), 2);
+    EXPECT_EQ(changes[1].change, GpioLineChange::Released);
+    EXPECT_FALSE(changes[1].used);
+
+    backend.unregisterLineInfoCallback(id);
+    observer.initInput();
+    EXPECT_EQ(backend.readLineInfoEvents(std::chrono::seconds(1)), 1);
+    EXPECT_EQ(changes.size(), 2);
+    // Changes made by the instance itself invalidate the cached state as well
+    EXPECT_EQ(observer.getDirection(), GpioDirection::Input);
+    EXPECT_EQ(backend.getStats().directionQueries, 2);
+}
+#endif
+#endif
+
 }  // namespace iqrf::gpio
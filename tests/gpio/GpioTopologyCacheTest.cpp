@@ -0,0 +1,97 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: GpioTopologyCacheTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-25
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "iqrf/gpio/GpioTopologyCache.h"
+
+namespace iqrf::gpio {
+
+class GpioTopologyCacheTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates the directory with fake chip device nodes
+     */
+    void SetUp() override {
+        this->directory = std::filesystem::temp_directory_path()
+            / ("libiqrf-topology-" + std::to_string(getpid()));
+        std::filesystem::create_directories(this->directory / "dev");
+        std::ofstream(this->directory / "dev" / "gpiochip0").put('0');
+        std::ofstream(this->directory / "dev" / "gpiochip1").put('1');
+    }
+
+    /**
+     * Removes the directory
+     */
+    void TearDown() override {
+        std::filesystem::remove_all(this->directory);
+    }
+
+    /**
+     * Creates the cache of the fake chips
+     * @return Topology cache
+     */
+    GpioTopologyCache createCache() const {
+        return GpioTopologyCache((this->directory / "run" / "topology.bin").string(), (this->directory / "dev").string());
+    }
+
+    /// Test directory
+    std::filesystem::path directory;
+};
+
+TEST_F(GpioTopologyCacheTest, warmStart) {
+    auto cold = this->createCache();
+    EXPECT_FALSE(cold.find("gpiochip0").has_value());
+    cold.store("gpiochip0", 54);
+    cold.store("gpiochip1", 8);
+    EXPECT_EQ(cold.find("gpiochip0"), 54);
+
+    auto warm = this->createCache();
+    EXPECT_EQ(warm.find("gpiochip0"), 54);
+    EXPECT_EQ(warm.find("gpiochip1"), 8);
+    EXPECT_EQ(warm.getStats().hits, 2);
+    EXPECT_EQ(warm.getStats().misses, 0);
+}
+
+TEST_F(GpioTopologyCacheTest, invalidatedByNodeChange) {
+    auto cache = this->createCache();
+    cache.store("gpiochip0", 54);
+    cache.store("gpiochip1", 8);
+
+    // Coarse filesystem timestamps would not tell the change otherwise
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::filesystem::permissions(this->directory / "dev" / "gpiochip0", std::filesystem::perms::owner_read);
+    std::filesystem::remove(this->directory / "dev" / "gpiochip1");
+
+    auto reloaded = this->createCache();
+    EXPECT_FALSE(reloaded.find("gpiochip0").has_value());
+    EXPECT_FALSE(reloaded.find("gpiochip1").has_value());
+    EXPECT_EQ(reloaded.getStats().misses, 2);
+}
+
+TEST_F(GpioTopologyCacheTest, invalidFileIgnored) {
+    std::filesystem::create_directories(this->directory / "run");
+    std::ofstream(this->directory / "run" / "topology.bin") << "IQGT garbage";
+    auto cache = this->createCache();
+    EXPECT_FALSE(cache.find("gpiochip0").has_value());
+    cache.store("gpiochip0", 32);
+    EXPECT_EQ(this->createCache().find("gpiochip0"), 32);
+}
+
+}  // namespace iqrf::gpio
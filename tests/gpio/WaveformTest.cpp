@@ -0,0 +1,126 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: WaveformTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-26
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "iqrf/gpio/Waveform.h"
+
+namespace iqrf::gpio {
+
+using namespace std::chrono_literals;
+
+class WaveformTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates the waveform writing into the recorded writes, timed by the virtual time
+     * @param steps Waveform steps
+     * @return GPIO waveform
+     */
+    Waveform createWaveform(std::vector<WaveformStep> steps) {
+        Waveform waveform;
+        waveform.steps = std::move(steps);
+        waveform.writer = [this](const uint64_t values, const uint64_t mask) {
+            this->writes.push_back({values, mask, this->time});
+            // Each write takes 2 us
+            this->time += 2us;
+        };
+        waveform.timer.now = [this] {
+            return this->time;
+        };
+        waveform.timer.sleepUntil = [this](const std::chrono::nanoseconds deadline) {
+            // Each sleep oversleeps by 5 us
+            this->time = std::max(this->time, deadline + 5us);
+        };
+        return waveform;
+    }
+
+    /**
+     * Recorded write
+     */
+    struct Write {
+        /// GPIO line output values
+        uint64_t values;
+        /// Lines set
+        uint64_t mask;
+        /// Virtual time of the write
+        std::chrono::nanoseconds time;
+    };
+
+    /// Recorded writes
+    std::vector<Write> writes;
+    /// Virtual time
+    std::chrono::nanoseconds time{1s};
+};
+
+TEST_F(WaveformTest, stepsAndJitter) {
+    WaveformEngine engine;
+    auto future = engine.submit(createWaveform({
+        {0b00, 0b01, 100us},
+        {0b01, 0b01, 50us},
+        {0b11, 0b10, 0us},
+    }));
+    const WaveformResult result = future.get();
+    ASSERT_EQ(writes.size(), 3);
+    EXPECT_EQ(writes[0].values, 0b00);
+    EXPECT_EQ(writes[1].values, 0b01);
+    EXPECT_EQ(writes[2].mask, 0b10);
+    // Deadlines are absolute, the lateness of a step does not shift the following ones
+    EXPECT_EQ(writes[1].time - writes[0].time, 100us);
+    EXPECT_EQ(writes[2].time - writes[1].time, 50us);
+    ASSERT_EQ(result.jitter.size(), 3);
+    EXPECT_EQ(result.jitter[0], 7us);
+    EXPECT_EQ(result.jitter[1], 7us);
+    EXPECT_EQ(result.maxJitter, 7us);
+    EXPECT_FALSE(result.realtime);
+}
+
+TEST_F(WaveformTest, monotonicClock) {
+    WaveformEngine engine;
+    std::vector<std::chrono::steady_clock::time_point> times;
+    Waveform waveform;
+    waveform.steps = {{1, 1, 2ms}, {0, 1, 1ms}};
+    waveform.writer = [&times](uint64_t, uint64_t) {
+        times.push_back(std::chrono::steady_clock::now());
+    };
+    const auto start = std::chrono::steady_clock::now();
+    const WaveformResult result = engine.submit(std::move(waveform)).get();
+    ASSERT_EQ(times.size(), 2);
+    EXPECT_GE(times[1] - times[0], 2ms - result.jitter[0]);
+    // The hold time of the last step is waited for
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 3ms);
+}
+
+TEST_F(WaveformTest, writerError) {
+    WaveformEngine engine;
+    Waveform waveform = createWaveform({{1, 1, 1us}, {0, 1, 1us}});
+    waveform.writer = [](uint64_t, uint64_t) {
+        throw std::runtime_error("write failed");
+    };
+    auto failed = engine.submit(std::move(waveform));
+    EXPECT_THROW(failed.get(), std::runtime_error);
+    // The engine keeps running the following waveforms
+    EXPECT_EQ(engine.submit(createWaveform({{1, 1, 1us}})).get().jitter.size(), 1);
+}
+
+TEST_F(WaveformTest, missingWriter) {
+    WaveformEngine engine;
+    EXPECT_THROW(engine.submit(Waveform()), std::invalid_argument);
+}
+
+}  // namespace iqrf::gpio
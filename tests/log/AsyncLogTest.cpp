@@ -0,0 +1,214 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: AsyncLogTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-27
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "iqrf/log/AsyncLog.h"
+
+namespace iqrf::log {
+
+/**
+ * Log recording the appended batches, optionally blocked until released.
+ */
+class RecordingLog : public ILog {
+ public:
+    void append(const std::string& msg) override {
+        this->append(msg, Level::Info);
+    }
+
+    void append(const std::string& msg, const Level& severity) override {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->entered++;
+        this->changed.notify_all();
+        this->changed.wait(lock, [this] { return !this->blocked; });
+        this->batches.emplace_back(severity, msg);
+        this->text += msg;
+    }
+
+    /**
+     * Blocks or releases the appending thread.
+     *
+     * @param block is whether the appending thread waits.
+     */
+    void block(const bool block) {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->blocked = block;
+        }
+        this->changed.notify_all();
+    }
+
+    /**
+     * Waits until the appending thread enters the log.
+     */
+    void waitEntered() {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->changed.wait(lock, [this] { return this->entered > 0; });
+    }
+
+    std::string getText() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->text;
+    }
+
+    std::vector<std::pair<Level, std::string>> getBatches() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->batches;
+    }
+
+ private:
+    std::vector<std::pair<Level, std::string>> batches;
+    std::string text;
+    bool blocked = false;
+    int entered = 0;
+    std::mutex mutex;
+    std::condition_variable changed;
+};
+
+/**
+ * Log forwarding the messages to the recording log owned by the test.
+ */
+class ForwardingLog : public ILog {
+ public:
+    explicit ForwardingLog(RecordingLog &target): target(target) {}
+
+    void append(const std::string& msg) override {
+        this->target.append(msg);
+    }
+
+    void append(const std::string& msg, const Level& severity) override {
+        this->target.append(msg, severity);
+    }
+
+ private:
+    RecordingLog &target;
+};
+
+class AsyncLogTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates the sink of the asynchronous log.
+     *
+     * @return Sink forwarding to the recording log.
+     */
+    std::unique_ptr<ILog> createSink() {
+        return std::make_unique<ForwardingLog>(this->recording);
+    }
+
+    /// Messages written by the asynchronous log
+    RecordingLog recording;
+};
+
+TEST_F(AsyncLogTest, writesInOrderOnFlush) {
+    AsyncLog log(createSink());
+    for (int i = 0; i < 100; ++i) {
+        log.append(std::to_string(i) + "\n", Level::Debug);
+    }
+    log.flush();
+    std::string expected;
+    for (int i = 0; i < 100; ++i) {
+        expected += std::to_string(i) + "\n";
+    }
+    EXPECT_EQ(recording.getText(), expected);
+    EXPECT_EQ(log.getStats().written, 100);
+    EXPECT_EQ(log.getStats().dropped, 0);
+}
+
+TEST_F(AsyncLogTest, batchesKeepSeverity) {
+    recording.block(true);
+    AsyncLog log(createSink());
+    // The first message is taken by the background thread blocked in the sink
+    log.append("first\n", Level::Info);
+    recording.waitEntered();
+    log.append("a\n", Level::Debug);
+    log.append("b\n", Level::Debug);
+    log.append("c\n", Level::Error);
+    recording.block(false);
+    log.flush();
+    const auto batches = recording.getBatches();
+    EXPECT_EQ(recording.getText(), "first\na\nb\nc\n");
+    // Each message is a record of its own
+    ASSERT_EQ(batches.size(), 4);
+    EXPECT_EQ(batches[1], std::make_pair(Level::Debug, std::string("a\n")));
+    EXPECT_EQ(batches[2], std::make_pair(Level::Debug, std::string("b\n")));
+    EXPECT_EQ(batches[3], std::make_pair(Level::Error, std::string("c\n")));
+    EXPECT_EQ(log.getStats().batches, 3);
+}
+
+TEST_F(AsyncLogTest, dropsOnOverflow) {
+    recording.block(true);
+    AsyncLogConfig config;
+    config.capacity = 4;
+    {
+        AsyncLog log(createSink(), config);
+        for (int i = 0; i < 100; ++i) {
+            log.append("message\n", Level::Debug);
+        }
+        EXPECT_GE(log.getStats().dropped, 100 - 4 - 1);
+        recording.block(false);
+    }
+    // The drops are reported once the queue is written
+    EXPECT_NE(recording.getText().find("log messages dropped"), std::string::npos);
+}
+
+TEST_F(AsyncLogTest, blocksOnOverflow) {
+    AsyncLogConfig config;
+    config.capacity = 2;
+    config.overflow = OverflowPolicy::Block;
+    AsyncLog log(createSink(), config);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&log] {
+            for (int i = 0; i < 250; ++i) {
+                log.append("x", Level::Debug);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    log.flush();
+    EXPECT_EQ(recording.getText().size(), 1000);
+    EXPECT_EQ(log.getStats().dropped, 0);
+}
+
+TEST_F(AsyncLogTest, fatalIsWritten) {
+    AsyncLog log(createSink());
+    log.append("fatal\n", Level::Fatal);
+    // Written before append returns
+    EXPECT_EQ(recording.getText(), "fatal\n");
+}
+
+TEST_F(AsyncLogTest, flushesOnDestruction) {
+    {
+        AsyncLog log(createSink());
+        log.append("last\n", Level::Info);
+    }
+    EXPECT_EQ(recording.getText(), "last\n");
+}
+
+TEST_F(AsyncLogTest, invalidConfig) {
+    EXPECT_THROW(AsyncLog(nullptr), std::invalid_argument);
+    AsyncLogConfig config;
+    config.capacity = 0;
+    EXPECT_THROW(AsyncLog(createSink(), config), std::invalid_argument);
+}
+
+}  // namespace iqrf::log
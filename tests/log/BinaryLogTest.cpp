@@ -0,0 +1,238 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: BinaryLogTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-28
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "iqrf/log/BinaryLog.h"
+
+namespace iqrf::log {
+
+/**
+ * Log recording the appended messages.
+ */
+class CollectingLog : public ILog {
+ public:
+    explicit CollectingLog(std::shared_ptr<std::vector<std::pair<Level, std::string>>> messages):
+        messages(std::move(messages)) {}
+
+    void append(const std::string& msg) override {
+        this->append(msg, Level::Info);
+    }
+
+    void append(const std::string& msg, const Level& severity) override {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->messages->emplace_back(severity, msg);
+    }
+
+ private:
+    std::shared_ptr<std::vector<std::pair<Level, std::string>>> messages;
+    std::mutex mutex;
+};
+
+class BinaryLogTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        if (!isCompiledIn(Level::Debug)) {
+            GTEST_SKIP() << "Debug statements are not compiled in";
+        }
+        Logger::logLevel = Level::Debug;
+    }
+
+    void TearDown() override {
+        Logger::log = std::make_unique<StderrLog>();
+        Logger::logLevel = Level::Error;
+    }
+
+    /**
+     * Formats the arguments as the background thread would.
+     *
+     * @param format is the message format.
+     * @param args are the message arguments.
+     * @return Formatted message.
+     */
+    template<typename... Args>
+    static std::string format(const char *format, const Args&... args) {
+        std::vector<uint8_t> arguments;
+        BinaryEncoder encoder(arguments);
+        (encoder.encode(args), ...);
+        return BinaryLogDecoder::format({Level::Info, format, "file", 1}, arguments.data(), arguments.size());
+    }
+
+    /**
+     * Creates the binary stream of the binary log.
+     *
+     * @param binary is the stream owned by the test.
+     * @return Stream writing to the buffer of the test stream.
+     */
+    static std::unique_ptr<std::ostream> output(std::stringstream &binary) {
+        return std::make_unique<std::ostream>(binary.rdbuf());
+    }
+
+    /// Messages appended to the sink
+    std::shared_ptr<std::vector<std::pair<Level, std::string>>> messages =
+        std::make_shared<std::vector<std::pair<Level, std::string>>>();
+};
+
+TEST_F(BinaryLogTest, formatsArguments) {
+    const std::vector<uint8_t> frame = {0x01, 0xab, 0xff};
+    EXPECT_EQ(format("int {} uint {} bool {}", -5, 7U, true), "[Info] int -5 uint 7 bool 1\n");
+    EXPECT_EQ(format("{}{} {}", 'a', std::string("bc"), 1.5), "[Info] abc 1.5\n");
+    EXPECT_EQ(format("frame {} ({} B)", hexBytes(frame), frame.size()), "[Info] frame 01.ab.ff (3 B)\n");
+    EXPECT_EQ(format("no arguments {}"), "[Info] no arguments {}\n");
+    EXPECT_EQ(format("extra", 1, "two"), "[Info] extra 1 two\n");
+}
+
+TEST_F(BinaryLogTest, malformedArguments) {
+    const std::vector<uint8_t> truncated = {static_cast<uint8_t>(BinaryArgument::Unsigned), 0x01};
+    const BinaryFormat description{Level::Info, "{}", "file", 1};
+    EXPECT_THROW(BinaryLogDecoder::format(description, truncated.data(), truncated.size()), std::runtime_error);
+    const std::vector<uint8_t> unknown = {'?'};
+    EXPECT_THROW(BinaryLogDecoder::format(description, unknown.data(), unknown.size()), std::runtime_error);
+}
+
+TEST_F(BinaryLogTest, formatsWithoutRunningLog) {
+    Logger::log = std::make_unique<CollectingLog>(this->messages);
+    IQRF_BLOG(Level::Warning, "value {}", 42);
+    IQRF_BLOG(Level::Trace, "filtered {}", 1);
+    ASSERT_EQ(this->messages->size(), 1);
+    EXPECT_EQ(this->messages->at(0), std::make_pair(Level::Warning, std::string("[Warning] value 42\n")));
+}
+
+TEST_F(BinaryLogTest, textMode) {
+    BinaryLog log(std::make_unique<CollectingLog>(this->messages));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < 50; ++i) {
+                IQRF_BLOG(Level::Debug, "thread {} message {}", t, i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    log.flush();
+    ASSERT_EQ(this->messages->size(), 200);
+    EXPECT_EQ(log.getStats().records, 200);
+    EXPECT_EQ(log.getStats().dropped, 0);
+    // Messages of a thread keep their order
+    int next = 0;
+    for (const auto &[level, message] : *this->messages) {
+        EXPECT_EQ(level, Level::Debug);
+        if (message.rfind("[Debug] thread 0 ", 0) == 0) {
+            EXPECT_EQ(message, "[Debug] thread 0 message " + std::to_string(next++) + "\n");
+        }
+    }
+    EXPECT_EQ(next, 50);
+}
+
+TEST_F(BinaryLogTest, binaryMode) {
+    std::stringstream binary;
+    const std::vector<uint8_t> frame = {0x00, 0x10, 0xfe};
+    {
+        BinaryLog log(output(binary));
+        IQRF_BLOG(Level::Info, "frame {}", hexBytes(frame));
+        for (int i = 0; i < 3; ++i) {
+            IQRF_BLOG(Level::Error, "error {}", i);
+        }
+    }
+    std::ostringstream text;
+    EXPECT_EQ(BinaryLogDecoder::decode(binary, text, false), 4);
+    EXPECT_EQ(text.str(), "[Info] frame 00.10.fe\n[Error] error 0\n[Error] error 1\n[Error] error 2\n");
+}
+
+TEST_F(BinaryLogTest, decodeTimestamps) {
+    std::stringstream binary;
+    {
+        BinaryLog log(output(binary));
+        IQRF_BLOG(Level::Info, "stamped");
+    }
+    std::ostringstream text;
+    EXPECT_EQ(BinaryLogDecoder::decode(binary, text), 1);
+    EXPECT_TRUE(std::regex_match(text.str(), std::regex("[0-9]+\\.[0-9]{9} \\[Info\\] stamped\n")));
+}
+
+TEST_F(BinaryLogTest, decodeMalformed) {
+    std::stringstream notLog("text");
+    std::ostringstream text;
+    EXPECT_THROW(BinaryLogDecoder::decode(notLog, text), std::runtime_error);
+    std::stringstream binary;
+    {
+        BinaryLog log(output(binary));
+        IQRF_BLOG(Level::Info, "value {}", 1);
+    }
+    std::string truncated = binary.str();
+    truncated.pop_back();
+    std::stringstream input(truncated);
+    EXPECT_THROW(BinaryLogDecoder::decode(input, text), std::runtime_error);
+}
+
+TEST_F(BinaryLogTest, singleInstance) {
+    BinaryLog log(std::make_unique<CollectingLog>(this->messages));
+    EXPECT_THROW(BinaryLog(std::make_unique<CollectingLog>(this->messages)), std::logic_error);
+    EXPECT_THROW(BinaryLog(std::unique_ptr<ILog>()), std::invalid_argument);
+    EXPECT_THROW(BinaryLog(std::unique_ptr<std::ostream>()), std::invalid_argument);
+}
+
+TEST_F(BinaryLogTest, dropsWhenBufferIsFull) {
+    BinaryLogConfig config;
+    config.threadBufferSize = 256;
+    config.interval = std::chrono::hours(1);
+    BinaryLog log(std::make_unique<CollectingLog>(this->messages), config);
+    for (int i = 0; i < 100; ++i) {
+        IQRF_BLOG(Level::Debug, "message {}", i);
+    }
+    log.flush();
+    const BinaryLogStats stats = log.getStats();
+    EXPECT_GT(stats.dropped, 0);
+    EXPECT_EQ(stats.records + stats.dropped, 100);
+    EXPECT_EQ(this->messages->size(), stats.records);
+}
+
+TEST_F(BinaryLogTest, noRecordsLostOnStop) {
+    const auto fallback = std::make_shared<std::vector<std::pair<Level, std::string>>>();
+    Logger::log = std::make_unique<CollectingLog>(fallback);
+    BinaryLogConfig config;
+    config.threadBufferSize = 16 * 1024 * 1024;
+    auto log = std::make_unique<BinaryLog>(std::make_unique<CollectingLog>(this->messages), config);
+    std::atomic<int> committed{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&committed] {
+            for (int i = 0; i < 2000; ++i) {
+                IQRF_BLOG(Level::Debug, "message {}", i);
+                committed++;
+            }
+        });
+    }
+    // Stopped while the threads are logging, each record is either collected or formatted
+    while (committed < 1000) {
+        std::this_thread::yield();
+    }
+    log.reset();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(this->messages->size() + fallback->size(), 8000);
+}
+
+}  // namespace iqrf::log
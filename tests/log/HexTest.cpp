@@ -0,0 +1,106 @@
+/**
+ * Copyright MICRORISC s.r.o.
+ * SPDX-License-Identifier: Apache-2.0
+ * File: HexTest.cpp
+ * Authors: Roman Ondráček <roman.ondracek@iqrf.com>
+ * Date: 2025-08-29
+ *
+ * This file is a part of the LIBIQRF. For the full license information, see the
+ * LICENSE file in the project root.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "iqrf/log/Hex.h"
+
+namespace iqrf::log {
+
+class HexTest : public ::testing::Test {
+ protected:
+    /**
+     * Creates varied test bytes.
+     *
+     * @param size is the number of bytes.
+     * @return Bytes.
+     */
+    static std::vector<uint8_t> sequence(const std::size_t size) {
+        std::vector<uint8_t> bytes(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+        }
+        return bytes;
+    }
+};
+
+TEST_F(HexTest, toHex) {
+    EXPECT_EQ(toHex({}), "");
+    EXPECT_EQ(toHex({0x01}), "01");
+    EXPECT_EQ(toHex({0x00, 0x1f, 0xa0, 0xff}), "00.1f.a0.ff");
+    EXPECT_EQ(toHex({0x00, 0x1f, 0xa0, 0xff}, NoHexSeparator), "001fa0ff");
+    EXPECT_EQ(toHex({0x00, 0x1f, 0xa0, 0xff}, ':'), "00:1f:a0:ff");
+    EXPECT_EQ(hexLength(0), 0);
+    EXPECT_EQ(hexLength(4), 11);
+    EXPECT_EQ(hexLength(4, NoHexSeparator), 8);
+}
+
+TEST_F(HexTest, simdMatchesLookupTable) {
+    for (const char separator : {HexSeparator, NoHexSeparator}) {
+        for (std::size_t size = 0; size <= 100; ++size) {
+            const std::vector<uint8_t> bytes = sequence(size);
+            std::string expected(hexLength(size, separator), '?');
+            std::string actual(hexLength(size, separator), '?');
+            EXPECT_EQ(toHexScalar(bytes.data(), size, expected.data(), separator), expected.data() + expected.size());
+            EXPECT_EQ(toHex(bytes.data(), size, actual.data(), separator), actual.data() + actual.size());
+            EXPECT_EQ(actual, expected) << "size " << size;
+        }
+    }
+}
+
+TEST_F(HexTest, appendHex) {
+    std::string text = "Frame: ";
+    const std::vector<uint8_t> bytes = {0xde, 0xad};
+    appendHex(text, bytes.data(), bytes.size());
+    EXPECT_EQ(text, "Frame: de.ad");
+}
+
+TEST_F(HexTest, hexView) {
+    const std::vector<uint8_t> bytes = sequence(300);
+    std::ostringstream stream;
+    stream << "[" << HexView(bytes) << "]";
+    EXPECT_EQ(stream.str(), "[" + toHex(bytes) + "]");
+    stream.str("");
+    stream << HexView(bytes, NoHexSeparator);
+    EXPECT_EQ(stream.str(), toHex(bytes, NoHexSeparator));
+    stream.str("");
+    stream << HexView(nullptr, 0);
+    EXPECT_EQ(stream.str(), "");
+}
+
+TEST_F(HexTest, hexToBytes) {
+    const std::vector<uint8_t> expected = {0x00, 0x1f, 0xa0, 0xff};
+    EXPECT_EQ(hexToBytes("00.1f.a0.ff"), expected);
+    EXPECT_EQ(hexToBytes("001FA0ff"), expected);
+    EXPECT_EQ(hexToBytes(" 00:1f-a0 ff\n"), expected);
+    EXPECT_EQ(hexToBytes(""), std::vector<uint8_t>());
+    EXPECT_EQ(hexToBytes("  "), std::vector<uint8_t>());
+    const std::vector<uint8_t> bytes = sequence(100);
+    EXPECT_EQ(hexToBytes(toHex(bytes)), bytes);
+}
+
+TEST_F(HexTest, hexToBytesInvalid) {
+    EXPECT_THROW(hexToBytes("0"), std::invalid_argument);
+    EXPECT_THROW(hexToBytes("001"), std::invalid_argument);
+    EXPECT_THROW(hexToBytes("00."), std::invalid_argument);
+    EXPECT_THROW(hexToBytes(".00"), std::invalid_argument);
+    EXPECT_THROW(hexToBytes("00..01"), std::invalid_argument);
+    EXPECT_THROW(hexToBytes("0g"), std::invalid_argument);
+    EXPECT_THROW(hexToBytes("00,01"), std::invalid_argument);
+}
+
+}  // namespace iqrf::log
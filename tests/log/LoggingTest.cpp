@@ -84,6 +84,9 @@ TEST_F(LoggingTest, SeverityLevels) {
 }
 
 TEST_F(LoggingTest, VerifyTraceInfo) {
+    if (!isCompiledIn(Level::Trace)) {
+        GTEST_SKIP() << "Trace statements are not compiled in";
+    }
     Logger::logLevel = Level::Trace;
     const std::regex trace_regex(
         "\\[Trace\\] LoggingTest.cpp:[0-9]+ - TestBody\\(\\): Tracing information.\n");
@@ -99,6 +102,9 @@ TEST_F(LoggingTest, VerifyTraceInfo) {
 }
 
 TEST_F(LoggingTest, AlternativeLog) {
+    if (!isCompiledIn(Level::Debug)) {
+        GTEST_SKIP() << "Debug statements are not compiled in";
+    }
     std::string message;
 
     Logger::log = std::make_unique<StdoutLog>();
@@ -116,4 +122,58 @@ TEST_F(LoggingTest, AlternativeLog) {
     ASSERT_STREQ(message.c_str(), "[Debug] Standard output.\n");
 }
 
+TEST_F(LoggingTest, ConstexprLevels) {
+    static_assert(levelName(Level::Warning) == "Warning");
+    static_assert(isCompiledIn(Level::Fatal));
+    static_assert(isCompiledIn(MinLevel));
+    EXPECT_EQ(isCompiledIn(Level::Trace), MinLevel == Level::Trace);
+}
+
+TEST_F(LoggingTest, DeprecatedLevelNames) {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    EXPECT_EQ(LevelNames.size(), 6);
+    EXPECT_EQ(LevelNames.at(Level::Warning), levelName(Level::Warning));
+#pragma GCC diagnostic pop
+}
+
+TEST_F(LoggingTest, StatementsBelowMinLevel) {
+    if (isCompiledIn(Level::Trace)) {
+        GTEST_SKIP() << "All statements are compiled in";
+    }
+    std::string message;
+
+    Logger::log = std::make_unique<StderrLog>();
+    Logger::logLevel = Level::Trace;
+
+    ::testing::internal::CaptureStderr();
+    IQRF_LOG(Level::Trace) << "Removed.";
+    message = ::testing::internal::GetCapturedStderr();
+    EXPECT_STREQ(message.c_str(), "");
+}
+
+/**
+ * Value logging a message of its own while being logged.
+ */
+struct NestedValue {};
+
+std::ostream& operator<<(std::ostream& os, const NestedValue&) {
+    IQRF_LOG(Level::Info) << "Nested.";
+    return os << "value";
+}
+
+TEST_F(LoggingTest, ReusedBuffers) {
+    std::string message;
+
+    Logger::log = std::make_unique<StderrLog>();
+    Logger::logLevel = Level::Info;
+
+    ::testing::internal::CaptureStderr();
+    IQRF_LOG(Level::Info) << std::hex << 255 << " " << NestedValue();
+    IQRF_LOG(Level::Info) << 255;
+    message = ::testing::internal::GetCapturedStderr();
+    // Formatting of a message does not leak into the next one
+    EXPECT_STREQ(message.c_str(), "[Info] Nested.\n[Info] ff value\n[Info] 255\n");
+}
+
 }  // namespace iqrf::log